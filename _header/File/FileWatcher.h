@@ -0,0 +1,66 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include <filesystem>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace process::file {
+	//Polls a set of files on its own thread and calls back, on that thread, with the
+	//name of each file whose last write time changed. A file which cannot be read mid
+	//save is skipped and checked again next poll, as is a file whose callback throws.
+	class FileWatcher {
+	private:
+		//typedefs
+		using FileTime = std::filesystem::file_time_type;
+		
+		struct WatchedFile {
+			std::wstring fileName {};
+			FileTime lastWriteTime {};
+		};
+		
+		//fields
+		std::mutex watchMutex {};	//guards watchedFiles; never held during the callback
+		std::vector<WatchedFile> watchedFiles {};	//only grows
+		std::chrono::milliseconds pollInterval {};
+		std::function<void(const std::wstring& fileName)> changeCallback {};
+		
+		std::mutex stopMutex {};
+		std::condition_variable stopCondition {};
+		bool stopFlag {};
+		
+		std::thread watchThread {};	//started last, once everything it uses exists
+	
+	public:
+		FileWatcher(
+			const std::vector<std::wstring>& fileNames,
+			std::chrono::milliseconds pollInterval,
+			std::function<void(const std::wstring& fileName)> changeCallback
+		);
+		
+		//delete copy constructor and assignment operator
+		FileWatcher(const FileWatcher& other) = delete;
+		
+		void operator=(const FileWatcher& other) = delete;
+		
+		//starts watching a file from its current last write time; may be called from
+		//any thread, and does nothing if the file is already watched
+		void watch(const std::wstring& fileName);
+		
+		//stops and joins the watch thread
+		~FileWatcher();
+	
+	private:
+		//helper functions
+		void watchLoop();
+		
+		void poll();
+		
+		//returns false if the file cannot be read right now
+		static bool tryGetLastWriteTime(const std::wstring& fileName, FileTime& time);
+	};
+}
\ No newline at end of file
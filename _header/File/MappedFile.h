@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+namespace process::file {
+	//A file mapped read only into memory for the lifetime of the object. Files which do
+	//not exist or cannot be mapped leave the object closed rather than throwing.
+	class MappedFile {
+	private:
+		//fields
+		void* fileHandle { nullptr };
+		void* mappingHandle { nullptr };
+		const std::uint8_t* dataPointer { nullptr };
+		std::size_t sizeBytes {};
+		bool open {};
+	
+	public:
+		MappedFile() = default;
+		explicit MappedFile(const std::wstring& fileName);
+		~MappedFile();
+		
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		
+		//true if the file was opened; an empty file is open with no data
+		bool isOpen() const {
+			return open;
+		}
+		
+		//page aligned, or null if the file is empty or closed
+		const std::uint8_t* data() const {
+			return dataPointer;
+		}
+		
+		std::size_t size() const {
+			return sizeBytes;
+		}
+		
+		//closes any file already mapped, then maps the given one
+		void map(const std::wstring& fileName);
+		
+		//unmaps the file so that it may be written to
+		void close();
+	};
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "ECS/Entity/EntityHandle.h"
+#include "ECS/Component/ChangeTracking.h"
+#include "ECS/Component/ComponentRegistry.h"
+#include "Utility/ValueHash.h"
 #include "Components/MenuCommand.h"
 #include "Components/ButtonData.h"
 #include "Graphics/SpriteDrawInstruction.h"
@@ -11,6 +14,7 @@
 #include "Components/ScriptList.h"
 #include "Components/PickupType.h"
 #include "Components/TwoFramePosition.h"
+#include "Game/Resources/ShapedText.h"
 #include "PolarVector.h"
 #include "AABB.h"
 #include "Rectangle.h"
@@ -58,9 +62,11 @@ namespace process::game {
 	struct TileScroll{
 		wasp::math::Vector2 pixelScroll{};
 	};
+    //glyphs shaped ahead of time, which live in a pool that outlives the component
     struct TextInstruction {
-        std::wstring text{};
-        int rightBound{};
+        const wasp::game::resources::ShapedGlyph* glyphs{};
+        std::uint32_t glyphCount{};
+        std::uint64_t textID{};     //see Dialogue::getTextID
     };
 
     struct RotateSpriteForwardMarker {};
@@ -191,4 +197,162 @@ namespace process::game {
             return *this;
         }
     };
+}
+
+namespace wasp::ecs::component {
+    //every component type, so each gets a fixed type index at compile time
+    template <>
+    struct RegisteredComponents<> {
+        using type = ComponentList<
+            process::game::MenuCommandUp,
+            process::game::MenuCommandDown,
+            process::game::MenuCommandLeft,
+            process::game::MenuCommandRight,
+            process::game::MenuCommandSelect,
+            process::game::NeighborElementUp,
+            process::game::NeighborElementDown,
+            process::game::NeighborElementLeft,
+            process::game::NeighborElementRight,
+            process::game::ButtonData,
+            process::game::VisibleMarker,
+            process::game::SpriteInstruction,
+            process::game::SubImage,
+            process::game::TilingInstruction,
+            process::game::TileScroll,
+            process::game::TextInstruction,
+            process::game::RotateSpriteForwardMarker,
+            process::game::SpriteSpin,
+            process::game::AnimationList,
+            process::game::Position,
+            process::game::Velocity,
+            process::game::CollidableMarker,
+            process::game::PlayerCollisions::Source,
+            process::game::PlayerCollisions::Target,
+            process::game::EnemyCollisions::Source,
+            process::game::EnemyCollisions::Target,
+            process::game::BulletCollisions::Source,
+            process::game::BulletCollisions::Target,
+            process::game::PickupCollisions::Source,
+            process::game::PickupCollisions::Target,
+            process::game::SpecialCollisions::Source,
+            process::game::SpecialCollisions::Target,
+            process::game::Hitbox,
+            process::game::Health,
+            process::game::Damage,
+            process::game::ClearMarker,
+            process::game::PickupType,
+            process::game::DeathCommand,
+            process::game::ScriptList,
+            process::game::DeathSpawn,
+            process::game::Inbound,
+            process::game::Outbound,
+            process::game::PlayerData
+        >;
+    };
+
+    //components which remember when they last changed, for changedSince
+    template <>
+    struct TracksChanges<process::game::Velocity> : std::true_type {};
+    template <>
+    struct TracksChanges<process::game::SpriteInstruction> : std::true_type {};
+}
+
+namespace wasp::utility {
+    //components which count towards DataStorage::getHash; those holding pointers or
+    //script state (sprites, text, animations, scripts) are left out
+
+    template <>
+    struct ValueHash<process::game::Position> {
+        static std::uint64_t hash(
+            std::uint64_t hash,
+            const process::game::Position& value
+        ) {
+            hash = hashValue(hash, value.x);
+            hash = hashValue(hash, value.y);
+            hash = hashValue(hash, value.getPast().x);
+            return hashValue(hash, value.getPast().y);
+        }
+    };
+    template <>
+    struct ValueHash<process::game::Velocity> {
+        static std::uint64_t hash(
+            std::uint64_t hash,
+            const process::game::Velocity& value
+        ) {
+            hash = hashValue(hash, value.getMagnitude());
+            return hashValue(hash, value.getAngle().getAngle());
+        }
+    };
+    template <>
+    struct ValueHash<process::game::Hitbox> {
+        static std::uint64_t hash(
+            std::uint64_t hash,
+            const process::game::Hitbox& value
+        ) {
+            hash = hashValue(hash, value.xLow);
+            hash = hashValue(hash, value.xHigh);
+            hash = hashValue(hash, value.yLow);
+            return hashValue(hash, value.yHigh);
+        }
+    };
+    template <>
+    struct ValueHash<process::game::Health> {
+        static std::uint64_t hash(
+            std::uint64_t hash,
+            const process::game::Health& value
+        ) {
+            return hashValue(hash, value.value);
+        }
+    };
+    template <>
+    struct ValueHash<process::game::Damage> {
+        static std::uint64_t hash(
+            std::uint64_t hash,
+            const process::game::Damage& value
+        ) {
+            return hashValue(hash, value.value);
+        }
+    };
+    template <>
+    struct ValueHash<process::game::SpriteSpin> {
+        static std::uint64_t hash(
+            std::uint64_t hash,
+            const process::game::SpriteSpin& value
+        ) {
+            return hashValue(hash, value.spin);
+        }
+    };
+    template <>
+    struct ValueHash<process::game::Inbound> {
+        static std::uint64_t hash(
+            std::uint64_t hash,
+            const process::game::Inbound& value
+        ) {
+            return hashValue(hash, value.bound);
+        }
+    };
+    template <>
+    struct ValueHash<process::game::Outbound> {
+        static std::uint64_t hash(
+            std::uint64_t hash,
+            const process::game::Outbound& value
+        ) {
+            return hashValue(hash, value.bound);
+        }
+    };
+    template <>
+    struct ValueHash<process::game::PlayerData> {
+        static std::uint64_t hash(
+            std::uint64_t hash,
+            const process::game::PlayerData& value
+        ) {
+            hash = hashValue(hash, value.shotType);
+            hash = hashValue(hash, value.lives);
+            hash = hashValue(hash, value.bombs);
+            hash = hashValue(hash, value.continues);
+            hash = hashValue(hash, value.power);
+            hash = hashValue(hash, value.stateMachine.playerState);
+            return hashValue(hash, value.stateMachine.timer);
+        }
+    };
 }
\ No newline at end of file
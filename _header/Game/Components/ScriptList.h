@@ -1,19 +1,56 @@
 #pragma once
 
 #include "Interpreter.h"
+#include "Container/ObjectPool.h"
 
 namespace process::game::components {
 	
 	template <typename... CustomTypes>
 	struct ScriptContainer{
+		//typedefs
+		using ScriptExecutionState
+			= typename darkness::Interpreter<CustomTypes...>::ScriptExecutionState;
+		using StatePool = wasp::container::ObjectPool<ScriptExecutionState>;
+		using StatePointer = typename StatePool::pointer_type;
+		
 		//constants
 		static constexpr int noTimer{ -1 };
 		
 		//fields
 		std::shared_ptr<darkness::AstNode> scriptPointer{};
 		std::string name{};
-		typename darkness::Interpreter<CustomTypes...>::ScriptExecutionState state{};
+		//acquired from the script system's pool when the script first runs; goes back to
+		//the pool however the container is destroyed, including with its entity
+		StatePointer statePointer{};
 		int timer{ noTimer };
+		
+		ScriptContainer() = default;
+		
+		ScriptContainer(std::shared_ptr<darkness::AstNode> scriptPointer, std::string name)
+			: scriptPointer{ std::move(scriptPointer) }
+			, name{ std::move(name) } {
+		}
+		
+		//a copy of a running script gets its own state from the same pool
+		ScriptContainer(const ScriptContainer& other)
+			: scriptPointer{ other.scriptPointer }
+			, name{ other.name }
+			, statePointer{ StatePool::acquireCopy(other.statePointer) }
+			, timer{ other.timer } {
+		}
+		
+		ScriptContainer(ScriptContainer&& other) = default;
+		
+		ScriptContainer& operator=(const ScriptContainer& other){
+			ScriptContainer copy{ other };
+			return *this = std::move(copy);
+		}
+		
+		ScriptContainer& operator=(ScriptContainer&& other) = default;
+		
+		bool isStalled() const{
+			return statePointer && statePointer->stalled;
+		}
 	};
 	
 	template <typename... CustomTypes>
@@ -1,12 +1,15 @@
 #pragma once
 
 #include "Resources/ResourceMasterStorage.h"
+#include "Resources/ResidencyManager.h"
 #include "Scenes.h"
 #include "Topics.h"
 #include "SceneUpdater.h"
 #include "SceneRenderer.h"
+#include "RenderSnapshot.h"
 #include "Sound/MidiHub.h"
 #include "Settings.h"
+#include "Utility/TripleBuffer.h"
 
 #pragma warning(suppress : 4068) //suppress unknown pragma
 #pragma clang diagnostic push
@@ -27,8 +30,14 @@ namespace process::game {
 		SceneUpdater sceneUpdater;		//not initialized!
 		SceneRenderer sceneRenderer;	//not initialized!
 
+		//only used when updates run on their own thread
+		wasp::utility::TripleBuffer<RenderSnapshot> renderSnapshotBuffer{};
+		std::uint64_t renderSnapshotTick{};
+		std::vector<ID3D11ShaderResourceView*> snapshotTextureViews{};	//scratch space
+
 		wasp::game::Settings* settingsPointer{};
 		resources::ResourceMasterStorage* resourceMasterStoragePointer{};
+		resources::ResidencyManager* residencyManagerPointer{};
 		window::GraphicsWrapper* graphicsWrapperPointer{};
 		wasp::input::IKeyInputTable* keyInputTablePointer{};
 		wasp::sound::midi::MidiHub* midiHubPointer{};
@@ -42,6 +51,7 @@ namespace process::game {
 		Game(
 			wasp::game::Settings* settingsPointer,
 			resources::ResourceMasterStorage* resourceMasterStoragePointer,
+			resources::ResidencyManager* residencyManagerPointer,
 			window::GraphicsWrapper* graphicsWrapperPointer,
 			wasp::input::IKeyInputTable* keyInputTablePointer,
 			wasp::sound::midi::MidiHub* midiHubPointer
@@ -51,6 +61,13 @@ namespace process::game {
 
 		void render();
 
+		//called on the update thread after each update when running threaded
+		void publishRenderSnapshot();
+
+		//called on the render thread when running threaded; draws the last published
+		//snapshot, interpolating positions by the time elapsed since it was published
+		void renderSnapshot();
+
 		void setExitCallback(const std::function<void()>& exitCallback) {
 			this->exitCallback = exitCallback;
 		}
@@ -69,12 +86,18 @@ namespace process::game {
 
 	private:
 		bool wasExitFlagRaised();
+		void updateScripts();
 		void updateSceneList();
 		void updateInput();
 		void updateMusic();
 		void updateSettings();
 
 		void recursiveRenderHelper(const SceneList::ReverseIterator& itr);
+		void recursiveSnapshotHelper(
+			const SceneList::ReverseIterator& itr,
+			RenderSnapshot& renderSnapshot
+		);
+		void holdSnapshotTextures(RenderSnapshot& renderSnapshot);
 	};
 }
 #pragma warning(suppress : 4068) //suppress unknown pragma
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "d3dInclude.h"
+#include "Graphics/DrawCommand.h"
+
+namespace process::game {
+
+	//An immutable copy of the render state of every visible scene, published once per
+	//update so that the render thread never has to touch the ecs. The snapshot holds a
+	//reference to every texture its commands use, so textures released on the update
+	//thread stay alive until the render thread is done with every snapshot using them.
+	struct RenderSnapshot {
+		std::uint64_t tick {};
+		std::chrono::steady_clock::time_point updateTime {};
+		graphics::DrawCommandList drawCommandList {};
+		std::vector<Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>> textureViews {};
+	};
+}
@@ -23,6 +23,8 @@ namespace process::game::resources {
 		
 		void reload(const std::wstring& id) override;
 		
+		std::size_t getMemoryUsage(const std::wstring& id) const override;
+		
 		ResourceBase* loadFromFile(
 			const resource::FileOrigin& fileOrigin,
 			const resource::ResourceLoader& resourceLoader
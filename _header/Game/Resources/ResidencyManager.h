@@ -0,0 +1,85 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <exception>
+
+#include "Game/Resources/ResourceMasterStorage.h"
+#include "Resource/ResourceLoader.h"
+#include "Utility/ThreadPool.h"
+
+namespace process::game::resources {
+	//Loads and releases the resource groups declared by ResourceGroupStorage. A group is
+	//loaded as a manifest of the same ID: its resources are created right away, then
+	//decoded on a background thread. A group's resources must not be read until
+	//isResident says so. Every call must come from the same thread.
+	class ResidencyManager {
+	public:
+		struct GroupReport {
+			std::wstring groupID {};
+			bool resident {};
+			std::size_t entryCount {};
+			std::size_t memoryUsage {};	//an estimate, in bytes
+		};
+	
+	private:
+		//fields
+		ResourceMasterStorage* resourceMasterStoragePointer {};
+		resource::ResourceLoader* resourceLoaderPointer {};
+		wasp::utility::ThreadPool threadPool;	//not initialized!
+		
+		//decoding fields, owned by the decode thread while decoding is set
+		std::vector<std::function<void()>> decodingTasks {};
+		std::wstring decodingGroupID {};
+		std::exception_ptr decodingExceptionPointer {};
+		std::atomic_bool decoding {};
+		std::thread decodeThread {};
+	
+	public:
+		ResidencyManager(
+			ResourceMasterStorage* resourceMasterStoragePointer,
+			resource::ResourceLoader* resourceLoaderPointer
+		);
+		
+		//delete copy constructor and assignment operator
+		ResidencyManager(const ResidencyManager& other) = delete;
+		
+		void operator=(const ResidencyManager& other) = delete;
+		
+		~ResidencyManager();
+		
+		bool hasGroup(const std::wstring& groupID);
+		
+		//starts loading the group if it is not already loaded or loading
+		void prefetch(const std::wstring& groupID);
+		
+		//true once the group is loaded and decoded; rethrows any decoding error
+		bool isResident(const std::wstring& groupID);
+		
+		//Drops the storage's references to the group's resources. Anything else holding
+		//them keeps them alive; in particular, a render snapshot holds every texture it
+		//draws, so the render thread may keep drawing a released group's textures until
+		//it moves on to a snapshot published after the release.
+		void release(const std::wstring& groupID);
+		
+		void releaseAllExcept(const std::wstring& groupID);
+		
+		void releaseAll() {
+			releaseAllExcept({});
+		}
+		
+		std::vector<GroupReport> makeReport();
+		
+		void logReport();
+	
+	private:
+		//helper functions
+		bool isLoaded(const std::wstring& groupID);
+		
+		//joins the decode thread and rethrows any decoding error
+		void finishDecoding();
+	};
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Resource\ResourceStorage.h"
+#include "Resource\ResourceBase.h"
+
+#pragma warning(disable : 4250) //suppress inherit via dominance
+
+namespace process::game::resources {
+	//Declares groups of resources which are not loaded at startup. A manifest line
+	//"group]res\stage1.mfst" declares the group stage1, which is the named manifest. Only
+	//the file name is kept here; the ResidencyManager loads and releases the group.
+	class ResourceGroupStorage
+		: public resource::ResourceStorage<std::wstring>,
+			public resource::ManifestLoadable {
+	private:
+		//typedefs
+		using ResourceType = resource::Resource<std::wstring>;
+		using ResourceBase = wasp::resource::ResourceBase;
+	
+	public:
+		ResourceGroupStorage()
+			: ManifestLoadable { { L"group" } } {
+		}
+		
+		//a declaration has nothing to reload
+		void reload(const std::wstring& id) override {
+		}
+		
+		ResourceBase* loadFromManifest(
+			const resource::ManifestOrigin& manifestOrigin,
+			const resource::ResourceLoader& resourceLoader
+		) override;
+	};
+}
\ No newline at end of file
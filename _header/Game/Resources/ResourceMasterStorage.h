@@ -6,6 +6,7 @@
 #include "Game/Resources/DialogueStorage.h"
 #include "Game/Resources/SpriteStorage.h"
 #include "Game/Resources/ScriptStorage.h"
+#include "Game/Resources/ResourceGroupStorage.h"
 
 namespace process::game::resources {
 	struct ResourceMasterStorage {
@@ -15,5 +16,6 @@ namespace process::game::resources {
 		MidiSequenceStorage midiSequenceStorage {};
 		DialogueStorage dialogueStorage {};
 		ScriptStorage scriptStorage {};
+		ResourceGroupStorage resourceGroupStorage {};
 	};
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+
+#include "File\MappedFile.h"
+#include "AstImage.h"
+
+namespace process::game::resources {
+	//A single file holding an ast image of every script, each tagged with a hash of the
+	//source it was parsed from. The file is mapped and images are read straight out of
+	//the mapping, so a script whose source is unchanged is never lexed or parsed.
+	//tryRead, put and save may be called from several threads at once.
+	class ScriptCache {
+	private:
+		struct Entry {
+			std::uint64_t sourceHash {};
+			const std::uint8_t* imagePointer {};	//into the mapping, or into ownedImage
+			std::size_t imageSize {};
+			std::vector<std::uint8_t> ownedImage {};
+		};
+		
+		//fields
+		std::wstring fileName {};
+		file::MappedFile mappedFile;	//not initialized!
+		std::unordered_map<std::string, Entry> mappedEntries {};
+		std::unordered_map<std::string, Entry> usedEntries {};	//read or put this run
+		std::size_t hitCount {};
+		std::size_t missCount {};
+		std::shared_mutex mappingMutex {};	//guards the mapping and mapped entries
+		std::mutex mutex {};	//guards the used entries and counts; taken second
+	
+	public:
+		explicit ScriptCache(const std::wstring& fileName);
+		
+		static std::uint64_t hashSource(std::string_view source);
+		
+		//returns false if the script is not cached under the given source hash
+		bool tryRead(
+			const std::string& key,
+			std::uint64_t sourceHash,
+			darkness::AstNode& script
+		);
+		
+		void put(
+			const std::string& key,
+			std::uint64_t sourceHash,
+			const darkness::AstNode& script
+		);
+		
+		//Rewrites the file if any script missed or any cached script went unused since
+		//the last save, then maps the new file so later reads still hit. Call once the
+		//startup loading is done, and again at shutdown for scripts parsed since.
+		void save();
+	
+	private:
+		//helper functions
+		void readMappedEntries();
+	};
+}
\ No newline at end of file
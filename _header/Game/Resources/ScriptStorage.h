@@ -1,7 +1,15 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+
 #include "Resource\ResourceStorage.h"
 #include "Resource\ResourceBase.h"
+#include "File\FileWatcher.h"
+#include "Game\Resources\ScriptCache.h"
+#include "MainConfig.h"
 #include "Lexer.h"
 #include "Parser.h"
 
@@ -18,16 +26,42 @@ namespace process::game::resources {
 		using ResourceType = resource::Resource<Script>;
 		using ResourceBase = wasp::resource::ResourceBase;
 		
+		struct ReloadedScript {
+			std::wstring id {};
+			std::shared_ptr<Script> oldScriptPointer {};
+			std::shared_ptr<Script> newScriptPointer {};
+		};
+		
 	private:
 		//fields
-		darkness::Lexer lexer{};
-		darkness::Parser parser{};
+		ScriptCache scriptCache;	//not initialized!
+		
+		//hot reload fields
+		std::mutex reloadMutex {};	//guards fileNameToIDMap and pendingReloads
+		std::unordered_map<std::wstring, std::wstring> fileNameToIDMap {};
+		std::vector<std::pair<std::wstring, std::shared_ptr<Script>>> pendingReloads {};
+		std::unique_ptr<file::FileWatcher> fileWatcherPointer {};	//destroyed first
 		
 	public:
 		ScriptStorage()
-			: FileLoadable { { L"dk" } }, ManifestLoadable { { L"dkScript" } } {
+			: FileLoadable { { L"dk" } }
+			, ManifestLoadable { { L"dkScript" } }
+			, scriptCache { config::scriptCachePath } {
+		}
+		
+		//writes out the script cache; call once startup loading is done and at shutdown
+		void saveScriptCache() {
+			scriptCache.save();
 		}
 		
+		//Starts re-parsing script files on a background thread as they are saved, including
+		//scripts loaded after this call. Nothing changes until applyReloadedScripts is called.
+		void watchForChanges();
+		
+		//Swaps in every script re-parsed since the last call. Anything still holding the
+		//old script keeps it, so running scripts are not disturbed. Call between ticks.
+		std::vector<ReloadedScript> applyReloadedScripts();
+		
 		void reload(const std::wstring& id) override;
 		
 		ResourceBase* loadFromFile(
@@ -41,6 +75,10 @@ namespace process::game::resources {
 		) override;
 		
 	private:
+		//does nothing until watchForChanges is called
+		void watchScriptFile(const std::wstring& fileName, const std::wstring& id);
+		
+		//may be called from loading threads
 		Script parseScriptFile(const std::wstring& fileName);
 	};
 }
\ No newline at end of file
@@ -42,6 +42,9 @@ namespace process::game::resources {
 		}
 
 		void reload(const std::wstring& id) override;
+		
+		//sprites packed into the atlas count towards the atlas, not themselves
+		std::size_t getMemoryUsage(const std::wstring& id) const override;
 
 		ResourceBase* loadFromFile(
 			const resource::FileOrigin& fileOrigin,
@@ -56,6 +59,7 @@ namespace process::game::resources {
 		void setDevicePointerAndLoadD3DTextures(const ComPtr<ID3D11Device>& devicePointer);
 		
 	private:
+		void loadD3DTexturesIntoAtlas();
 		void loadD3DTexture(ResourceType& resource);
 		void throwIfCannotConstructD3DTextures();
 	};
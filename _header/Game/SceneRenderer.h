@@ -1,8 +1,8 @@
 #pragma once
 
 #include "Game/Scenes.h"
+#include "Game/Systems/DrawCommandSystem.h"
 #include "Game/Systems/RenderSystem.h"
-#include "Game/Systems/TextRenderSystem.h"
 #include "Game/Systems/DebugRenderSystem.h"
 
 namespace process::game {
@@ -10,8 +10,10 @@ namespace process::game {
 	class SceneRenderer {
 	private:
 		//fields
+		systems::DrawCommandSystem drawCommandSystem;	//not initialized!
 		systems::RenderSystem renderSystem;				//not initialized!
-		systems::TextRenderSystem textRenderSystem;		//not initialized!
+		graphics::DrawCommandList drawCommandList{};	//reused by immediate rendering
+		std::uint64_t tick{};
 
 		//debug fields
 		#ifdef _DEBUG
@@ -25,6 +27,23 @@ namespace process::game {
 			resources::SpriteStorage& spriteStorage
 		);
 
+		//extracts and draws the scene immediately
 		void operator()(Scene& scene);
+
+		//appends the draw commands for the scene; may be called on the update thread
+		//while the render thread draws a different list
+		void extract(
+			Scene& scene,
+			graphics::DrawCommandList& drawCommandList,
+			std::uint64_t tick
+		);
+
+		//draws a scene from a previously extracted list. Debug rendering reads the ecs
+		//and is therefore skipped.
+		void operator()(
+			const graphics::DrawCommandList& drawCommandList,
+			std::size_t sceneIndex,
+			float interpolation
+		);
 	};
-}
\ No newline at end of file
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Resources/ResourceMasterStorage.h"
+#include "Resources/ResidencyManager.h"
 #include "Input/IKeyInputTable.h"
 #include "Game/Scenes.h"
 
@@ -13,6 +14,7 @@
 #include "Game/Systems/LoadSystem.h"
 #include "Game/Systems/DialogueSystem.h"
 #include "Game/Systems/VelocitySystem.h"
+#include "Game/Systems/SpatialIndexSystem.h"
 #include "Game/Systems/InboundSystem.h"
 #include "Game/Systems/ScriptSystem.h"
 #include "Game/Systems/CollisionDetectorSystem.h"
@@ -55,6 +57,7 @@ namespace process::game {
 		systems::ScriptSystem scriptSystem;						//not initialized!
 		systems::PlayerMovementSystem playerMovementSystem{};
 		systems::VelocitySystem velocitySystem{};
+		systems::SpatialIndexSystem spatialIndexSystem{};
 		systems::InboundSystem inboundSystem{};
 		systems::CollisionDetectorSystem collisionDetectorSystem{};
 		systems::CollisionHandlerSystem collisionHandlerSystem;	//not initialized!
@@ -80,10 +83,15 @@ namespace process::game {
 	public:
 		SceneUpdater(
 			resources::ResourceMasterStorage* resourceMasterStoragePointer,
+			resources::ResidencyManager* residencyManagerPointer,
 			wasp::input::IKeyInputTable* keyInputTablePointer,
 			wasp::channel::ChannelSet* globalChannelSetPointer
 		);
 
 		void operator()(Scene& scene);
+		
+		void reloadScripts(
+			const std::vector<resources::ScriptStorage::ReloadedScript>& reloadedScripts
+		);
 	};
 }
\ No newline at end of file
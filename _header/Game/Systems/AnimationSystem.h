@@ -19,6 +19,7 @@ namespace process::game::systems {
 		using Animation = components::Animation;
 		//fields
         resources::SpriteStorage* spriteStoragePointer{};
+        Query<AnimationList> groupQuery{};
 
     public:
         AnimationSystem(resources::SpriteStorage* spriteStoragePointer);
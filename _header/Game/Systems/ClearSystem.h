@@ -10,6 +10,9 @@ namespace process::game::systems {
 		using EntityID = wasp::ecs::entity::EntityID;
 		using EntityHandle = wasp::ecs::entity::EntityHandle;
 		using Group = wasp::ecs::component::Group;
+		
+		//fields
+		Query<ClearMarker> groupQuery{};
 	
 	public:
 		void operator()(Scene& scene);
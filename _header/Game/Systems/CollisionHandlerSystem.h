@@ -1,20 +1,58 @@
 #pragma once
 
+#include <optional>
+#include <algorithm>
+#include <cstdint>
+
 #include "systemInclude.h"
 #include "ScriptStorage.h"
 
 namespace process::game::systems {
 
+	//Responds to every collision found this tick. Each entity's components are looked
+	//up once no matter how many collisions it is in. Damage is summed per entity, and
+	//deaths and player hits are applied once per entity in a batch after every
+	//collision has been read. Collision type removals are batched per collision type
+	//instead, at the end of that type's pass, so later types see them.
 	class CollisionHandlerSystem {
 	private:
 		//typedefs
+		using EntityID = wasp::ecs::entity::EntityID;
 		using EntityHandle = wasp::ecs::entity::EntityHandle;
+		using DataStorage = wasp::ecs::DataStorage;
 		using CollisionCommands = components::CollisionCommands;
 		template <typename T>
 		using RemoveComponentOrder = wasp::ecs::RemoveComponentOrder<T>;
 
+		//what the collisions of this tick have done to one entity
+		struct EntityState {
+			std::uint32_t pass{};			//stale unless this is the current pass
+			std::uint32_t commandPass{};	//commands stale unless current as well
+			EntityHandle handle{};
+			
+			//the commands of the collision type being handled; empty if the entity
+			//lacks the component or it is due to be removed
+			std::optional<CollisionCommands> sourceCommand{};
+			std::optional<CollisionCommands> targetCommand{};
+			
+			//the damage this entity deals when collided with, once looked up
+			std::optional<int> damage{};
+			bool isDamageKnown{};
+			
+			int damageTaken{};
+			bool isDamaged{};
+			bool isDead{};
+			bool isPlayerHit{};
+		};
+
 		//fields
 		resources::ScriptStorage* scriptStoragePointer{};
+		//indexed by entity id and reused every tick, so a tick allocates nothing
+		std::vector<EntityState> entityStates{};
+		std::vector<EntityID> touchedEntityIDs{};	//in order of first collision
+		std::vector<EntityHandle> collisionTypeRemovals{};
+		std::uint32_t currentPass{};
+		std::uint32_t currentCommandPass{};
 
 	public:
 		CollisionHandlerSystem(resources::ScriptStorage* scriptStoragePointer);
@@ -27,117 +65,126 @@ namespace process::game::systems {
 			const auto& collisionChannel{
 				scene.getChannel(CollisionType::collisionTopic)
 			};
+			if (collisionChannel.isEmpty()) {
+				return;
+			}
+			
+			auto& dataStorage{ scene.getDataStorage() };
+			const auto& messages{ collisionChannel.getMessages() };
+			reserveEntityStates(messages);
+			++currentCommandPass;
 
-			if (collisionChannel.hasMessages()) {
-				auto& dataStorage{ scene.getDataStorage() };
-
-				//handle the commands for each source/target pair
-				for (const auto& [sourceHandle, targetHandle]
-					: collisionChannel.getMessages()
-				) {
-					if(dataStorage.containsComponent<typename CollisionType::Source>(
-						sourceHandle
-					)) {
-						const auto sourceCommand {
-							dataStorage.getComponent<typename CollisionType::Source>(
-								sourceHandle
-							).command
-						};
-						handleCollisionCommand<CollisionType>(
-							scene,
-							sourceHandle,
-							sourceCommand,
-							targetHandle
-						);
-					}
-					if(dataStorage.containsComponent<typename CollisionType::Target>(
+			//handle the commands for each source/target pair
+			for (const auto& [sourceHandle, targetHandle] : messages) {
+				EntityState& sourceState{
+					getEntityState<CollisionType>(dataStorage, sourceHandle)
+				};
+				if (sourceState.sourceCommand) {
+					handleCollisionCommand(
+						scene,
+						sourceState,
+						*sourceState.sourceCommand,
 						targetHandle
+					);
+				}
+				EntityState& targetState{
+					getEntityState<CollisionType>(dataStorage, targetHandle)
+				};
+				if (targetState.targetCommand) {
+					handleCollisionCommand(
+						scene,
+						targetState,
+						*targetState.targetCommand,
+						sourceHandle
+					);
+				}
+			}
+
+			//since this system does not iterate over entities, just remove
+			for (const EntityHandle& entityHandle : collisionTypeRemovals) {
+				if (!dataStorage.removeComponent(
+					RemoveComponentOrder<typename CollisionType::Source>{ entityHandle }
+				)) {
+					if (!dataStorage.removeComponent(
+						RemoveComponentOrder<typename CollisionType::Target>{ entityHandle }
 					)) {
-						const auto targetCommand {
-							dataStorage.getComponent<typename CollisionType::Target>(
-								targetHandle
-							).command
-						};
-						handleCollisionCommand<CollisionType>(
-							scene,
-							targetHandle,
-							targetCommand,
-							sourceHandle
-						);
+						throw std::runtime_error{ "failed to remove collision type" };
 					}
 				}
 			}
+			collisionTypeRemovals.clear();
 		}
 
+		//looks up the entity's commands for this collision type on first use
 		template <typename CollisionType>
+		EntityState& getEntityState(
+			const DataStorage& dataStorage,
+			const EntityHandle& entityHandle
+		) {
+			EntityState& entityState{ getEntityState(entityHandle) };
+			if (entityState.commandPass != currentCommandPass) {
+				entityState.commandPass = currentCommandPass;
+				entityState.sourceCommand = getCommand<typename CollisionType::Source>(
+					dataStorage,
+					entityHandle
+				);
+				entityState.targetCommand = getCommand<typename CollisionType::Target>(
+					dataStorage,
+					entityHandle
+				);
+			}
+			return entityState;
+		}
+
+		template <typename T>
+		static std::optional<CollisionCommands> getCommand(
+			const DataStorage& dataStorage,
+			const EntityHandle& entityHandle
+		) {
+			if (dataStorage.containsComponent<T>(entityHandle)) {
+				return dataStorage.getComponent<T>(entityHandle).command;
+			}
+			return std::nullopt;
+		}
+
+		//makes sure every entity in the collisions has a state
+		template <typename Messages>
+		void reserveEntityStates(const Messages& messages) {
+			EntityID maxEntityID{ 0 };
+			for (const auto& [sourceHandle, targetHandle] : messages) {
+				maxEntityID = std::max(
+					{ maxEntityID, sourceHandle.entityID, targetHandle.entityID }
+				);
+			}
+			if (maxEntityID >= entityStates.size()) {
+				entityStates.resize(maxEntityID + 1);
+			}
+		}
+
+		EntityState& getEntityState(const EntityHandle& entityHandle);
+
 		void handleCollisionCommand(
 			Scene& scene,
-			const EntityHandle& entityHandle,
-			const components::CollisionCommands command,
+			EntityState& entityState,
+			CollisionCommands command,
 			const EntityHandle& collidedHandle
-		){
-			switch (command) {
-				case CollisionCommands::death:
-					handleDeathCommand(scene, entityHandle);
-					break;
-				case CollisionCommands::damage:
-					handleDamageCommand(scene, entityHandle, collidedHandle);
-					break;
-				case CollisionCommands::removeCollisionType:
-					handleRemoveCollisionTypeCommand<CollisionType>(scene, entityHandle);
-					break;
-				case CollisionCommands::player:
-					handlePlayerCommand(scene, entityHandle);
-					break;
-				case CollisionCommands::pickup:
-					handlePickupCommand(scene, entityHandle, collidedHandle);
-					break;
-				case CollisionCommands::none:
-					//do nothing
-					break;
-				default:
-					throw std::runtime_error{
-						"default case reached in collision handler system"
-					};
-			}
-		}
+		);
 
 		void handlePickupCommand(
 			Scene& scene,
-			const EntityHandle& pickupHandle,
+			EntityState& pickupState,
 			const EntityHandle& collidedHandle
 		);
 
-		void handlePlayerCommand(Scene& scene, const EntityHandle& playerHandle);
-
 		void handleDamageCommand(
 			Scene& scene,
-			const EntityHandle& entityHandle,
+			EntityState& entityState,
 			const EntityHandle& collidedHandle
 		);
 
-		void handleDeathCommand(
-			Scene& scene,
-			const EntityHandle& entityHandle
-		);
-		
-		template <typename CollisionType>
-		void handleRemoveCollisionTypeCommand(
-			Scene& scene,
-			const EntityHandle& entityHandle
-		){
-			//since this system does not iterate over entities, just remove
-			auto& dataStorage{ scene.getDataStorage() };
-			if(!dataStorage.removeComponent(
-				RemoveComponentOrder<typename CollisionType::Source>{ entityHandle }
-			)){
-				if(!dataStorage.removeComponent(
-					RemoveComponentOrder<typename CollisionType::Target>{ entityHandle }
-				)){
-					throw std::runtime_error{ "failed to remove collision type" };
-				}
-			}
-			
-		}
+		void handleRemoveCollisionTypeCommand(EntityState& entityState);
+
+		//applies the damage, deaths and player hits of every entity collided with
+		void applyEntityStates(Scene& scene);
 	};
 }
\ No newline at end of file
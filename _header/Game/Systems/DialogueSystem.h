@@ -17,8 +17,9 @@ namespace process::game::systems {
 
 			//dialogue, dialoguePos, spriteHandles
 			//spriteHandles are 0 - left image, 1 - right image, 2 - text
+			//the dialogue is shared so the text entity can point into its glyph pool
 		using SceneData = std::tuple<
-			Dialogue, 
+			std::shared_ptr<const Dialogue>, 
 			std::size_t, 
 			std::array<EntityHandle, 3>
 		>;
@@ -44,14 +45,16 @@ namespace process::game::systems {
 		bool executeCommand(
 			Scene& scene,
 			std::array<EntityHandle, 3>& spriteHandles,
-			DialogueCommand& dialogueCommand
+			const Dialogue& dialogue,
+			const DialogueCommand& dialogueCommand
 		);
 
 		void setImage(Scene& scene, EntityHandle& entityHandle, const std::wstring& id);
 		void setText(
 			Scene& scene, 
 			EntityHandle& entityHandle, 
-			const std::wstring& text
+			const Dialogue& dialogue,
+			const DialogueCommand& dialogueCommand
 		);
 		void setTrack(const std::wstring& id);
 		void exit();
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "systemInclude.h"
+#include "Graphics/DrawCommand.h"
+#include "Graphics/ITextDrawer.h"
+#include "SpriteStorage.h"
+
+namespace process::game::systems {
+
+	//Walks the render components of a scene once and appends a depth sorted draw command
+	//for every sprite, sub sprite, tile sprite and text glyph. Touches nothing but the
+	//scene and the list, so it may run on the update thread.
+	class DrawCommandSystem {
+	private:
+		//typedefs
+		using EntityID = wasp::ecs::entity::EntityID;
+		using Group = wasp::ecs::component::Group;
+		using Point2 = wasp::math::Point2;
+		using DrawCommand = graphics::DrawCommand;
+		using DrawCommandList = graphics::DrawCommandList;
+
+		//fields
+		graphics::SymbolMap<wchar_t> symbolMap;
+		std::uint32_t symbolMapID;	//unique among systems, so glyph runs never mix them up
+		Query<Position, VisibleMarker, SpriteInstruction> spriteGroupQuery{};
+		Query<Position, VisibleMarker, TextInstruction> textGroupQuery{};
+
+	public:
+		//the position each entity had in the last extraction it appeared in
+		struct PastPosition {
+			int generation { -1 };	//no entity
+			std::uint64_t tick {};
+			Point2 pastPosition {};
+			Point2 position {};
+		};
+
+		//the draw commands of a text's shaped glyphs, relative to the text's position;
+		//reused until the entity, text or symbol map changes. Keyed on ids rather than
+		//pointers, since a reloaded dialogue may reuse the old glyph pool's address.
+		struct GlyphRun {
+			int generation { -1 };	//no entity
+			std::uint32_t symbolMapID {};
+			std::uint64_t textID {};	//no text
+			std::vector<DrawCommand> glyphs {};
+		};
+
+		DrawCommandSystem(resources::SpriteStorage& spriteStorage)
+			: symbolMap{ loadSymbolMap(spriteStorage) }
+			, symbolMapID{ makeSymbolMapID() } {
+		}
+
+		//tick must increase by one between consecutive extractions for interpolation
+		void operator()(Scene& scene, DrawCommandList& drawCommandList, std::uint64_t tick);
+
+	private:
+		//helper functions
+		void addText(
+			DrawCommandList& drawCommandList,
+			const PastPosition& positions,
+			const TextInstruction& textInstruction,
+			GlyphRun& glyphRun
+		) const;
+
+		void layOutGlyphRun(
+			GlyphRun& glyphRun,
+			const TextInstruction& textInstruction
+		) const;
+
+		static GlyphRun& getGlyphRun(
+			std::vector<GlyphRun>& glyphRuns,
+			const wasp::ecs::DataStorage& dataStorage,
+			EntityID entityID
+		);
+
+		static DrawCommand makeDrawCommand(
+			const PastPosition& positions,
+			const graphics::SpriteDrawInstruction& spriteDrawInstruction
+		);
+
+		static const PastPosition& updatePastPosition(
+			std::vector<PastPosition>& pastPositions,
+			const wasp::ecs::DataStorage& dataStorage,
+			EntityID entityID,
+			const Point2& position,
+			std::uint64_t tick
+		);
+
+		static std::uint32_t makeSymbolMapID();
+
+		static graphics::SymbolMap<wchar_t> loadSymbolMap(
+			resources::SpriteStorage& spriteStorage
+		);
+	};
+}
@@ -7,6 +7,10 @@ namespace process::game::systems {
 	class InboundSystem {
 	private:
 		using Group = wasp::ecs::component::Group;
+
+		//fields
+		Query<Position, Inbound> groupQuery{};
+
 	public:
 		void operator()(Scene& scene);
 	};
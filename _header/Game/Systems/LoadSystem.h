@@ -1,6 +1,7 @@
 #pragma once
 
 #include "systemInclude.h"
+#include "Game/Resources/ResidencyManager.h"
 
 namespace process::game::systems {
 
@@ -8,9 +9,19 @@ namespace process::game::systems {
 	private:
 		//fields
 		wasp::channel::ChannelSet* globalChannelSetPointer{};
+		resources::ResidencyManager* residencyManagerPointer{};
 
 	public:
-		LoadSystem(wasp::channel::ChannelSet* globalChannelSetPointer);
+		LoadSystem(
+			wasp::channel::ChannelSet* globalChannelSetPointer,
+			resources::ResidencyManager* residencyManagerPointer
+		);
 		void operator()(Scene& scene);
+
+	private:
+		//helper functions
+		
+		//the resource group for the stage being loaded, which may not be declared
+		std::wstring getStageGroupID();
 	};
 }
\ No newline at end of file
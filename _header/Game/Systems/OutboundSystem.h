@@ -7,6 +7,10 @@ namespace process::game::systems {
 	class OutboundSystem {
 	private:
 		using Group = wasp::ecs::component::Group;
+
+		//fields
+		Query<Position, Outbound> groupQuery{};
+
 	public:
 		void operator()(Scene& scene);
 	};
@@ -27,6 +27,7 @@ namespace process::game::systems {
 
 		//fields
 		resources::SpriteStorage* spriteStoragePointer{};
+		Query<PlayerData> groupQuery{};
 
 	public:
 		OverlaySystem(
@@ -15,6 +15,9 @@ namespace process::game::systems {
         using TwoFramePlayerInputData = wasp::utility::TwoFrame<PlayerInputData>;
         using Vector2 = wasp::math::Vector2;
 
+        //fields
+        Query<PlayerData, Velocity> groupQuery{};
+
     public:
         void operator()(Scene& scene);
 
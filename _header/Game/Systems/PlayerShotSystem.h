@@ -7,8 +7,13 @@ namespace process::game::systems {
 
 	class PlayerShotSystem {
 	private:
+		//typedefs
+		using ScriptContainer = ScriptList::value_type;
+		
 		//fields
-		resources::ScriptStorage* scriptStoragePointer{};
+		ScriptContainer shotAScriptContainer;	//not initialized!
+		ScriptContainer shotBScriptContainer;	//not initialized!
+		Query<PlayerData, Position, ScriptList> groupQuery{};
 
 	public:
 		
@@ -9,6 +9,9 @@ namespace process::game::systems {
 		//typedefs
 		using EntityHandle = wasp::ecs::entity::EntityHandle;
 
+		//fields
+		Query<PlayerData> groupQuery{};
+
 	public:
 		void operator()(Scene& scene);
 	};
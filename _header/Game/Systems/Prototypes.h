@@ -3,6 +3,7 @@
 #include "Game/Systems/EntityBuilder.h"
 #include "SpriteStorage.h"
 #include "ScriptStorage.h"
+#include "Utility/HandleTable.h"
 
 namespace process::game::systems{
 
@@ -16,15 +17,24 @@ namespace process::game::systems{
 		using PolarVector = wasp::math::PolarVector;
 		using ComponentTupleSharedPointer = std::shared_ptr<ComponentTupleBase>;
 		
+	public:
+		using PrototypeHandle = wasp::utility::HandleTable<ComponentTupleSharedPointer>::Handle;
+		
+	private:
 		//fields
-		std::unordered_map<std::string, ComponentTupleSharedPointer> prototypeMap{};
+		wasp::utility::HandleTable<ComponentTupleSharedPointer> prototypeTable{};
 	public:
 		Prototypes(
 			resources::ScriptStorage& scriptStorage,
 			resources::SpriteStorage& spriteStorage
 		);
 		
-		ComponentTupleSharedPointer get(const std::string& prototypeID) const;
+		//throws if no prototype has the given ID
+		PrototypeHandle getHandle(const std::string& prototypeID);
+		
+		const ComponentTupleSharedPointer& get(PrototypeHandle prototypeHandle) const{
+			return prototypeTable[prototypeHandle];
+		}
 		
 	private:
 		void addPlayerPrototypes(
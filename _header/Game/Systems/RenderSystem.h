@@ -2,15 +2,13 @@
 
 #include "systemInclude.h"
 #include "Window/GraphicsWrapper.h"
+#include "Graphics/DrawCommand.h"
 
 namespace process::game::systems {
 
+	//Submits the draw commands of a single scene to the graphics wrapper
 	class RenderSystem {
 	private:
-		//typedefs
-		using EntityID = wasp::ecs::entity::EntityID;
-		using Group = wasp::ecs::component::Group;
-
 		//fields
 		window::GraphicsWrapper* graphicsWrapperPointer{};
 
@@ -19,24 +17,11 @@ namespace process::game::systems {
 			: graphicsWrapperPointer{ graphicsWrapperPointer } {
 		}
 
-		void operator()(Scene& scene);
-
-	private:
-		//helper functions
-		void drawSprite(
-			const Position& position,
-			const SpriteInstruction& spriteInstruction
-		);
-
-		void drawSprite(
-			const Position& position,
-			const SpriteInstruction& spriteInstruction,
-			const SubImage& subImage
-		);
-		
-		void drawSprite(
-			const TilingInstruction& tilingInstruction,
-			const SpriteInstruction& spriteInstruction
+		//interpolation is the fraction of the way from past to present positions
+		void operator()(
+			const graphics::DrawCommandList& drawCommandList,
+			std::size_t sceneIndex,
+			float interpolation
 		);
 	};
-}
\ No newline at end of file
+}
@@ -5,6 +5,10 @@
 namespace process::game::systems {
 
 	class RotateSpriteForwardSystem {
+	private:
+		//fields
+		Query<SpriteInstruction, Velocity, RotateSpriteForwardMarker> groupQuery{};
+
 	public:
 		void operator()(Scene& scene);
 	};
@@ -8,6 +8,7 @@
 #include "ScriptStorage.h"
 #include "SpriteStorage.h"
 #include "Prototypes.h"
+#include "Utility/HandleTable.h"
 
 namespace process::game::systems {
 
@@ -22,16 +23,40 @@ namespace process::game::systems {
 		using EntityHandle = wasp::ecs::entity::EntityHandle;
 		using Group = wasp::ecs::component::Group;
 		using ScriptContainer = ScriptList::value_type;
+		using StatePool = ScriptContainer::StatePool;
 		using Point2 = wasp::math::Point2;
 		using Vector2 = wasp::math::Vector2;
 		using PolarVector = wasp::math::PolarVector;
 		using Angle = wasp::math::Angle;
+		
+		//a script resolved from storage along with the names containers are given
+		struct ScriptEntry{
+			std::shared_ptr<darkness::AstNode> scriptPointer{};
+			std::string name{};
+			std::string spawnName{};
+		};
+		using ScriptHandle = wasp::utility::HandleTable<ScriptEntry>::Handle;
+		
+		//the latest version of a script which was reloaded; the old version is held so
+		//its address is not reused while it is a key
+		struct ScriptReplacement{
+			std::shared_ptr<darkness::AstNode> oldScriptPointer{};
+			std::shared_ptr<darkness::AstNode> newScriptPointer{};
+		};
 
 		//fields
 		wasp::channel::ChannelSet* globalChannelSetPointer{};
 		resources::ScriptStorage* scriptStoragePointer{};
 		resources::SpriteStorage* spriteStoragePointer{};
 		Prototypes prototypes;	//not initialized
+		wasp::utility::HandleTable<ScriptEntry> scriptTable{};	//filled as scripts are named
+		//message strings sent over the points and flags channels; never emptied, so
+		//handles stay valid across scenes and snapshots
+		wasp::utility::HandleTable<std::string> messageTable{};
+		//empty unless scripts were hot reloaded
+		std::unordered_map<const darkness::AstNode*, ScriptReplacement> scriptReplacementMap{};
+		//execution states of running scripts, recycled as scripts finish or entities die
+		std::shared_ptr<StatePool> statePoolPointer{};
 		
 		Scene* currentScenePointer{};
 		EntityID currentEntityID{};
@@ -40,6 +65,10 @@ namespace process::game::systems {
 		bool clearSpawnsFlag{ false };
 		ComponentOrderQueue componentOrderQueue{};	//cleared at end of every call
 		SpawnQueue spawnQueue{};	//cleared at end of every call
+		
+		Query<ScriptList> groupQuery{};
+		Query<PlayerData, Position> playerPositionGroupQuery{};
+		Query<PlayerData> playerGroupQuery{};
 
 	public:
 		ScriptSystem(
@@ -48,12 +77,41 @@ namespace process::game::systems {
 			resources::SpriteStorage* spriteStoragePointer
 		);
 		void operator()(Scene& scene);
+		
+		//Points later spawns at the new scripts. Containers pick up a new script the next
+		//time they start from the top, or right away if restartReloadedScripts is set.
+		void reloadScripts(
+			const std::vector<resources::ScriptStorage::ReloadedScript>& reloadedScripts
+		);
 
 	private:
 		//helper functions
+		//adds the script as a function if its ID starts with keyword func
+		void tryAddFunctionScript(
+			const std::string& shortID,
+			const std::shared_ptr<darkness::AstNode>& scriptPointer
+		);
+		void replaceReloadedScript(ScriptContainer& scriptContainer);
 		EntityHandle makeCurrentEntityHandle();
 		static float getAsFloat(const DataType& data);
 		
+		//throws if no script has the given ID
+		ScriptHandle getScriptHandle(const std::string& scriptID);
+		
+		//resolve a string parameter of the running native, once per call site if it is
+		//a literal; throw if nothing has the given ID
+		ScriptHandle resolveScriptParameter(
+			const std::vector<DataType>& parameters,
+			std::size_t index
+		);
+		Prototypes::PrototypeHandle resolvePrototypeParameter(
+			const std::vector<DataType>& parameters,
+			std::size_t index
+		);
+		
+		//returns the handle of the message, adding it if it is new
+		MessageHandle internMessage(const std::string& message);
+		
 		template <typename T>
 		bool containsComponent(const EntityHandle& entityHandle){
 			return currentScenePointer->getDataStorage().containsComponent<T>(entityHandle);
@@ -64,6 +122,22 @@ namespace process::game::systems {
 			return currentScenePointer->getDataStorage().getComponent<T>(entityHandle);
 		}
 		
+		//returns nullptr if the scene has not built its spatial index yet
+		const SpatialIndex* getSpatialIndexPointer();
+		
+		//counts entries of the grid which are still alive and not the current entity
+		template <typename QueryFunction>
+		int countLiveEntries(QueryFunction&& queryFunction){
+			const auto& dataStorage{ currentScenePointer->getDataStorage() };
+			int count{ 0 };
+			queryFunction([&](const SpatialIndex::Grid::Entry& entry){
+				if(entry.id.entityID != currentEntityID && dataStorage.isAlive(entry.id)){
+					++count;
+				}
+			});
+			return count;
+		}
+		
 		static void throwIfNativeFunctionWrongArity(
 			std::size_t expectedArity,
 			const std::vector<DataType>& parameters,
@@ -124,6 +198,18 @@ namespace process::game::systems {
 		DataType isFocused(const std::vector<DataType>& parameters);
 		DataType isNotSpecialCollisionTarget(const std::vector<DataType>& parameters);
 		
+		//spatial queries
+		DataType nearestEnemy(const std::vector<DataType>& parameters);
+		DataType enemiesInRadius(const std::vector<DataType>& parameters);
+		DataType bulletsInRadius(const std::vector<DataType>& parameters);
+		DataType bulletsInBox(const std::vector<DataType>& parameters);
+		DataType isEnemyInLine(const std::vector<DataType>& parameters);
+		
+		//ownership
+		DataType owner(const std::vector<DataType>& parameters);
+		DataType hasOwner(const std::vector<DataType>& parameters);
+		DataType killDescendants(const std::vector<DataType>& parameters);
+		
 		//entity mutators
 		DataType setCollidable(const std::vector<DataType>& parameters);
 		DataType setSpecialCollisionSource(const std::vector<DataType>& parameters);
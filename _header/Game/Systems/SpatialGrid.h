@@ -0,0 +1,315 @@
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cmath>
+
+#include "Math/Geometry.h"
+
+namespace process::game::systems {
+
+	//A uniform grid of points, rebuilt from scratch every tick. Entries are stored
+	//sorted by cell, so a query only visits the cells it overlaps; the buffers keep
+	//their capacity between rebuilds. Points outside the bounds are dropped, as in
+	//QuadTree.
+	template <typename IdType>
+	class SpatialGrid {
+	public:
+		struct Entry {
+			IdType id{};
+			wasp::math::Point2 position{};
+		};
+
+	private:
+		//typedefs
+		using AABB = wasp::math::AABB;
+		using Point2 = wasp::math::Point2;
+		using Vector2 = wasp::math::Vector2;
+
+		//fields
+		AABB bounds{};
+		float cellSize{};
+		int columns{};
+		int rows{};
+		std::vector<std::size_t> cellStarts{};	//columns * rows + 1, built by build()
+		std::vector<Entry> entries{};			//sorted by cell, built by build()
+		std::vector<Entry> pendingEntries{};	//inserted since the last clear
+		std::vector<int> pendingCells{};
+
+	public:
+		//constructors
+		SpatialGrid(const AABB& bounds, float cellSize)
+			: bounds{ bounds }
+			, cellSize{ cellSize }
+			, columns{ std::max(1, static_cast<int>(std::ceil(bounds.getWidth() / cellSize))) }
+			, rows{ std::max(1, static_cast<int>(std::ceil(bounds.getHeight() / cellSize))) }
+			, cellStarts(static_cast<std::size_t>(columns * rows) + 1, 0) {
+		}
+
+		//Empties the grid; queries see nothing until the next build
+		void clear() {
+			pendingEntries.clear();
+			pendingCells.clear();
+			entries.clear();
+			std::fill(cellStarts.begin(), cellStarts.end(), 0);
+		}
+
+		//Queues a point for the next build if it falls within the bounds of this grid
+		void insert(const IdType& id, const Point2& position) {
+			if (!wasp::math::isPointWithinAABB(position, bounds)) {
+				return;
+			}
+			pendingEntries.push_back({ id, position });
+			pendingCells.push_back(getCell(getColumn(position.x), getRow(position.y)));
+		}
+
+		//Sorts every point inserted since the last clear into its cell
+		void build() {
+			std::fill(cellStarts.begin(), cellStarts.end(), 0);
+			for (int cell : pendingCells) {
+				++cellStarts[cell + 1];
+			}
+			for (std::size_t i{ 1 }; i < cellStarts.size(); ++i) {
+				cellStarts[i] += cellStarts[i - 1];
+			}
+			entries.resize(pendingEntries.size());
+			//cellStarts[cell] is used as the write cursor, leaving each cell holding its end
+			for (std::size_t i{ 0 }; i < pendingEntries.size(); ++i) {
+				entries[cellStarts[pendingCells[i]]++] = pendingEntries[i];
+			}
+			//shift back so that each cell holds its start again
+			for (std::size_t i{ cellStarts.size() - 1 }; i > 0; --i) {
+				cellStarts[i] = cellStarts[i - 1];
+			}
+			cellStarts[0] = 0;
+		}
+
+		bool isEmpty() const {
+			return entries.empty();
+		}
+
+		std::size_t size() const {
+			return entries.size();
+		}
+
+		//Returns the closest entry to the given point no further than maxDistance for
+		//which accept returns true, or nullptr if there is none. Rings of cells are
+		//searched outwards, stopping once no unvisited cell could hold anything closer.
+		template <typename Predicate>
+		const Entry* findNearest(
+			const Point2& center,
+			float maxDistance,
+			Predicate&& accept
+		) const {
+			if (entries.empty()) {
+				return nullptr;
+			}
+			int centerColumn{ getColumn(center.x) };
+			int centerRow{ getRow(center.y) };
+			int maxRing{ std::max(columns, rows) };
+
+			const Entry* nearestPointer{ nullptr };
+			float nearestDistanceSquared{ maxDistance * maxDistance };
+			for (int ring{ 0 }; ring <= maxRing; ++ring) {
+				//a cell k rings out is at least k - 1 cells away from the center
+				float ringDistance{ static_cast<float>(ring - 1) * cellSize };
+				if (ring > 0 && ringDistance * ringDistance > nearestDistanceSquared) {
+					break;
+				}
+				forEachCellInRing(centerColumn, centerRow, ring, [&](int cell) {
+					for (std::size_t i{ cellStarts[cell] }; i < cellStarts[cell + 1]; ++i) {
+						const Entry& entry{ entries[i] };
+						float distanceSquared{ getDistanceSquared(center, entry.position) };
+						if (distanceSquared <= nearestDistanceSquared && accept(entry)) {
+							nearestPointer = &entry;
+							nearestDistanceSquared = distanceSquared;
+						}
+					}
+				});
+			}
+			return nearestPointer;
+		}
+
+		//Calls function on every entry within radius of the given point
+		template <typename Function>
+		void forEachInRadius(const Point2& center, float radius, Function&& function) const {
+			float radiusSquared{ radius * radius };
+			forEachInCells(
+				AABB{ center.x - radius, center.x + radius, center.y - radius, center.y + radius },
+				[&](const Entry& entry) {
+					if (getDistanceSquared(center, entry.position) <= radiusSquared) {
+						function(entry);
+					}
+				}
+			);
+		}
+
+		std::size_t countInRadius(const Point2& center, float radius) const {
+			std::size_t count{ 0 };
+			forEachInRadius(center, radius, [&](const Entry&) { ++count; });
+			return count;
+		}
+
+		//Calls function on every entry within the given box
+		template <typename Function>
+		void forEachInBox(const AABB& box, Function&& function) const {
+			forEachInCells(box, [&](const Entry& entry) {
+				if (wasp::math::isPointWithinAABB(entry.position, box)) {
+					function(entry);
+				}
+			});
+		}
+
+		std::size_t countInBox(const AABB& box) const {
+			std::size_t count{ 0 };
+			forEachInBox(box, [&](const Entry&) { ++count; });
+			return count;
+		}
+
+		//Returns the first entry within halfWidth of the ray from origin along the given
+		//unit direction for which accept returns true, or nullptr if there is none
+		//before length. Only cells the swept ray could touch are visited.
+		template <typename Predicate>
+		const Entry* findFirstAlongRay(
+			const Point2& origin,
+			const Vector2& direction,
+			float length,
+			float halfWidth,
+			Predicate&& accept
+		) const {
+			if (entries.empty()) {
+				return nullptr;
+			}
+			float endX{ origin.x + direction.x * length };
+			float endY{ origin.y + direction.y * length };
+			AABB sweptBox{
+				std::min(origin.x, endX) - halfWidth,
+				std::max(origin.x, endX) + halfWidth,
+				std::min(origin.y, endY) - halfWidth,
+				std::max(origin.y, endY) + halfWidth
+			};
+			//a cell can only hold a hit if its center is within half a cell diagonal
+			//of the band the ray sweeps
+			float cellReach{ halfWidth + cellSize * 0.7072f };
+
+			const Entry* firstPointer{ nullptr };
+			float firstAlong{ length };
+			forEachCellInBox(sweptBox, [&](int column, int row) {
+				float cellCenterX{ bounds.xLow + (static_cast<float>(column) + 0.5f) * cellSize };
+				float cellCenterY{ bounds.yLow + (static_cast<float>(row) + 0.5f) * cellSize };
+				float cellAcross{
+					(cellCenterX - origin.x) * direction.y
+						- (cellCenterY - origin.y) * direction.x
+				};
+				if (std::abs(cellAcross) > cellReach) {
+					return;
+				}
+				int cell{ getCell(column, row) };
+				for (std::size_t i{ cellStarts[cell] }; i < cellStarts[cell + 1]; ++i) {
+					const Entry& entry{ entries[i] };
+					float offsetX{ entry.position.x - origin.x };
+					float offsetY{ entry.position.y - origin.y };
+					float along{ offsetX * direction.x + offsetY * direction.y };
+					float across{ offsetX * direction.y - offsetY * direction.x };
+					if (along >= 0.0f
+						&& along <= firstAlong
+						&& std::abs(across) <= halfWidth
+						&& accept(entry)
+					) {
+						firstPointer = &entry;
+						firstAlong = along;
+					}
+				}
+			});
+			return firstPointer;
+		}
+
+		//Returns the bounds of this grid
+		const AABB& getBounds() const {
+			return bounds;
+		}
+
+	private:
+		//helper functions
+		int getColumn(float x) const {
+			int column{ static_cast<int>((x - bounds.xLow) / cellSize) };
+			return std::clamp(column, 0, columns - 1);
+		}
+
+		int getRow(float y) const {
+			int row{ static_cast<int>((y - bounds.yLow) / cellSize) };
+			return std::clamp(row, 0, rows - 1);
+		}
+
+		int getCell(int column, int row) const {
+			return row * columns + column;
+		}
+
+		static float getDistanceSquared(const Point2& a, const Point2& b) {
+			float x{ b.x - a.x };
+			float y{ b.y - a.y };
+			return x * x + y * y;
+		}
+
+		template <typename Function>
+		void forEachCellInBox(const AABB& box, Function&& function) const {
+			if (box.xHigh < bounds.xLow || box.xLow > bounds.xHigh
+				|| box.yHigh < bounds.yLow || box.yLow > bounds.yHigh
+			) {
+				return;
+			}
+			int columnLow{ getColumn(box.xLow) };
+			int columnHigh{ getColumn(box.xHigh) };
+			int rowLow{ getRow(box.yLow) };
+			int rowHigh{ getRow(box.yHigh) };
+			for (int row{ rowLow }; row <= rowHigh; ++row) {
+				for (int column{ columnLow }; column <= columnHigh; ++column) {
+					function(column, row);
+				}
+			}
+		}
+
+		template <typename Function>
+		void forEachInCells(const AABB& box, Function&& function) const {
+			forEachCellInBox(box, [&](int column, int row) {
+				int cell{ getCell(column, row) };
+				for (std::size_t i{ cellStarts[cell] }; i < cellStarts[cell + 1]; ++i) {
+					function(entries[i]);
+				}
+			});
+		}
+
+		//calls function on every cell in the square ring of cells the given number of
+		//cells out from the center cell, skipping cells off the grid
+		template <typename Function>
+		void forEachCellInRing(
+			int centerColumn,
+			int centerRow,
+			int ring,
+			Function&& function
+		) const {
+			int columnLow{ centerColumn - ring };
+			int columnHigh{ centerColumn + ring };
+			int rowLow{ centerRow - ring };
+			int rowHigh{ centerRow + ring };
+			for (int row{ std::max(rowLow, 0) }; row <= std::min(rowHigh, rows - 1); ++row) {
+				if (row == rowLow || row == rowHigh) {
+					int columnEnd{ std::min(columnHigh, columns - 1) };
+					for (int column{ std::max(columnLow, 0) }; column <= columnEnd; ++column) {
+						function(getCell(column, row));
+					}
+				}
+				else {
+					//only the two ends of the rows in between
+					if (columnLow >= 0) {
+						function(getCell(columnLow, row));
+					}
+					if (columnHigh < columns) {
+						function(getCell(columnHigh, row));
+					}
+				}
+			}
+		}
+	};
+}
\ No newline at end of file
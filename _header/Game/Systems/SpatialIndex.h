@@ -0,0 +1,21 @@
+#pragma once
+
+#include "ECS/Entity/EntityHandle.h"
+#include "GameConfig.h"
+#include "SpatialGrid.h"
+
+namespace process::game::systems {
+
+	//Where collidable enemies and enemy bullets were once this tick's movement was
+	//applied. Rebuilt in place by SpatialIndexSystem, so it may name entities which
+	//have since died and whose IDs have been reused; check the handles with isAlive
+	//before using them.
+	struct SpatialIndex {
+		//typedefs
+		using Grid = SpatialGrid<wasp::ecs::entity::EntityHandle>;
+
+		//fields
+		Grid enemies{ config::collisionBounds, config::spatialIndexCellSize };
+		Grid bullets{ config::collisionBounds, config::spatialIndexCellSize };
+	};
+}
\ No newline at end of file
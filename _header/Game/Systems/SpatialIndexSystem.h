@@ -0,0 +1,26 @@
+#pragma once
+
+#include "systemInclude.h"
+
+namespace process::game::systems {
+
+	class SpatialIndexSystem {
+	private:
+		//fields
+		Query<Position, CollidableMarker, EnemyCollisions::Target> enemyGroupQuery{};
+		Query<Position, CollidableMarker, BulletCollisions::Target> bulletGroupQuery{};
+
+	public:
+		//rebuilds the scene's spatial index from this tick's positions
+		void operator()(Scene& scene);
+
+	private:
+		//helper functions
+		template <typename GroupQuery>
+		static void rebuildGrid(
+			SpatialIndex::Grid& grid,
+			GroupQuery& groupQuery,
+			Scene& scene
+		);
+	};
+}
\ No newline at end of file
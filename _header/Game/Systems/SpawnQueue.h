@@ -7,20 +7,28 @@ namespace process::game::systems{
 	class SpawnQueue{
 	private:
 		//typedefs
+		using EntityHandle = wasp::ecs::entity::EntityHandle;
 		using SpawnPointer = std::shared_ptr<ComponentTupleBase>;
-		using SpawnList = std::vector<SpawnPointer>;
+		
+		//inner types
+		struct QueuedSpawn{
+			SpawnPointer spawnPointer{};
+			EntityHandle parentHandle{};
+		};
 		
 		//fields
-		SpawnList spawnList{};
+		std::vector<QueuedSpawn> spawnList{};
 		
 	public:
-		void queueSpawn(const SpawnPointer& spawnPointer){
-			spawnList.emplace_back(spawnPointer);
+		//the spawn becomes a child of the given parent, if it is still alive
+		void queueSpawn(const SpawnPointer& spawnPointer, const EntityHandle& parentHandle){
+			spawnList.push_back({ spawnPointer, parentHandle });
 		}
 		
 		void applyAndClear(wasp::ecs::DataStorage& dataStorage) {
-			for (const SpawnPointer& spawnPointer : spawnList) {
-				spawnPointer->addTo(dataStorage);
+			for (const auto& [spawnPointer, parentHandle] : spawnList) {
+				EntityHandle spawnHandle{ spawnPointer->addTo(dataStorage) };
+				dataStorage.setParent(spawnHandle, parentHandle);
 			}
 			spawnList.clear();
 		}
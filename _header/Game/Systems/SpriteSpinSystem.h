@@ -5,6 +5,10 @@
 namespace process::game::systems {
 
 	class SpriteSpinSystem {
+	private:
+		//fields
+		Query<SpriteInstruction, SpriteSpin> groupQuery{};
+
 	public:
 		void operator()(Scene& scene);
 	};
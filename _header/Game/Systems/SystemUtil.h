@@ -2,28 +2,13 @@
 
 #include "Game/Scenes.h"
 #include "GameConfig.h"
+#include "ECS/Query.h"
 
 namespace process::game::systems {
 	
-	//Retrieves the group pointer from the channel for the given group pointer topic
+	//Names a group; systems keep one as a member for each group they iterate
 	template <typename... Ts>
-	wasp::ecs::component::Group* getGroupPointer(
-		Scene& scene, 
-		wasp::channel::Topic<wasp::ecs::component::Group*> groupPointerStorageTopic
-	) {
-		wasp::ecs::DataStorage& dataStorage{ scene.getDataStorage() };
-
-		auto& channel{ scene.getChannel(groupPointerStorageTopic) };
-		wasp::ecs::component::Group* groupPointer;	//not initialized!
-		if (channel.isEmpty()) {
-			groupPointer = dataStorage.getGroupPointer<Ts...>();
-			channel.addMessage(groupPointer);
-		}
-		else {
-			groupPointer = channel.getMessages()[0];
-		}
-		return groupPointer;
-	}
+	using Query = wasp::ecs::Query<Ts...>;
 
 	//Returns true if the given position is outside of the bounds specified,
 	//false otherwise
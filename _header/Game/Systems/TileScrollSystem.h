@@ -5,6 +5,10 @@
 namespace process::game::systems {
 
 	class TileScrollSystem {
+	private:
+		//fields
+		Query<TilingInstruction, SpriteInstruction, TileScroll> groupQuery{};
+
 	public:
 		void operator()(Scene& scene);
 	};
@@ -7,6 +7,8 @@ namespace process::game::systems {
 	class VelocitySystem {
 
 	private:
+		//fields
+		Query<Position, Velocity> groupQuery{};
 
 	public:
 		void operator()(Scene& scene);
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <functional>
+#include <chrono>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <cstdint>
+
+namespace process::game {
+
+	//Runs updates on their own thread at a fixed rate while the calling thread renders as
+	//fast as it can. The two sides must only communicate through thread safe structures
+	//such as the render snapshot triple buffer.
+	class ThreadedGameLoop {
+	private:
+		//typedefs
+		using ClockType = std::chrono::steady_clock;
+		using TimePointType = ClockType::time_point;
+		using DurationType = ClockType::duration;
+
+		//fields
+		std::atomic_bool running {};
+		int updatesPerSecond {};
+		std::function<void()> updateFunction {};    //called on the update thread
+		std::function<void()> renderFunction {};    //called on the thread calling run
+		std::exception_ptr updateExceptionPointer {};
+
+	public:
+		ThreadedGameLoop(
+			int updatesPerSecond,
+			const std::function<void()>& updateFunction,
+			const std::function<void()>& renderFunction
+		)
+			: running { false }
+			, updatesPerSecond { updatesPerSecond }
+			, updateFunction { updateFunction }
+			, renderFunction { renderFunction } {
+		};
+
+		//blocks until stopped; rethrows any exception thrown on the update thread
+		void run();
+
+		//safe to call from either thread
+		void stop();
+
+	private:
+		void runUpdates();
+
+		static TimePointType getCurrentTime();
+	};
+}
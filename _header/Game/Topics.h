@@ -8,8 +8,10 @@
 #include "Game/Systems/GameState.h"
 #include "Game/Systems/GameCommands.h"
 #include "Game/Systems/PlayerStates.h"
+#include "Game/Systems/SpatialIndex.h"
 #include "Game/Components/PlayerData.h"
 #include "Point2.h"
+#include "Utility/HandleTable.h"
 
 namespace process::game {
 
@@ -19,6 +21,8 @@ namespace process::game {
 	//typedefs
 	template <typename T = wasp::utility::Void>
 	using Topic = wasp::channel::Topic<T>;
+	//a script message string, interned by ScriptSystem so channels carry no strings
+	using MessageHandle = wasp::utility::HandleTable<std::string>::Handle;
 
 	//global topics (1 channel per game)
 	struct GlobalTopics {
@@ -106,8 +110,11 @@ namespace process::game {
 		//set and cleared by ScriptSystem (stage program)
 		static const Topic<> winFlag;
 		
+		//set by SpatialIndexSystem; persistent
+		static const Topic<systems::SpatialIndex> spatialIndex;
+		
 		//topics for scripts
-		static const Topic<std::tuple<wasp::math::Point2, std::string>> points;
-		static const Topic<std::string> flags;
+		static const Topic<std::tuple<wasp::math::Point2, MessageHandle>> points;
+		static const Topic<MessageHandle> flags;
 	};
 }
\ No newline at end of file
@@ -16,6 +16,8 @@ namespace process::game::config {
 		-collisionOutbound,
 		gameHeight + collisionOutbound
 	} + gameOffset;
+	//about the spacing of dense bullet patterns, so most cells hold a handful
+	constexpr float spatialIndexCellSize{ 16.0f };
 	
 	//player
 	constexpr wasp::math::Point2 playerSpawn = wasp::math::Point2{
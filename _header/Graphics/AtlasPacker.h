@@ -0,0 +1,108 @@
+#pragma once
+
+#include <vector>
+#include <string>
+
+namespace process::graphics {
+
+	//Where a rectangle ended up in the atlas. Rectangles which do not fit on an empty
+	//page are left unpacked and keep their own texture.
+	struct AtlasPlacement {
+		bool packed{};
+		int page{ -1 };
+		unsigned int x{};
+		unsigned int y{};
+	};
+
+	struct AtlasPageOccupancy {
+		unsigned int rectCount{};
+		unsigned long long usedArea{};	//pixels covered by rectangles, excluding padding
+		unsigned int skylineHeight{};	//lowest row below which nothing is placed
+	};
+
+	//Packs rectangles into fixed size pages with the skyline bottom left heuristic.
+	//Knows nothing of textures, so the same packing can be reproduced offline.
+	class AtlasPacker {
+	private:
+		//a horizontal segment of the skyline; everything below y is taken
+		struct SkylineNode {
+			unsigned int x{};
+			unsigned int y{};
+			unsigned int width{};
+		};
+
+		struct Page {
+			std::vector<SkylineNode> skyline{};
+			AtlasPageOccupancy occupancy{};
+		};
+
+		//fields
+		unsigned int pageWidth{};
+		unsigned int pageHeight{};
+		unsigned int padding{};
+		std::vector<Page> pages{};
+		unsigned int unpackedCount{};
+
+	public:
+		AtlasPacker(unsigned int pageWidth, unsigned int pageHeight, unsigned int padding)
+			: pageWidth{ pageWidth }
+			, pageHeight{ pageHeight }
+			, padding{ padding } {
+		}
+
+		//Packs every rectangle, tallest first, and returns placements in input order.
+		//Each call starts from empty pages.
+		std::vector<AtlasPlacement> pack(
+			const std::vector<unsigned int>& widths,
+			const std::vector<unsigned int>& heights
+		);
+
+		unsigned int getPageWidth() const {
+			return pageWidth;
+		}
+
+		unsigned int getPageHeight() const {
+			return pageHeight;
+		}
+
+		std::size_t getPageCount() const {
+			return pages.size();
+		}
+
+		const AtlasPageOccupancy& getOccupancy(std::size_t page) const {
+			return pages[page].occupancy;
+		}
+
+		//Returns one line per page with its rectangle count and the fraction of the page
+		//covered, followed by a count of rectangles which did not fit
+		std::string makeOccupancyReport() const;
+
+	private:
+		//helper functions
+		bool tryPlace(
+			Page& page,
+			unsigned int width,
+			unsigned int height,
+			AtlasPlacement& placement
+		) const;
+
+		//returns the y at which a rectangle of the given width rests if placed at the
+		//given node, or false if it does not fit
+		bool fitsAt(
+			const Page& page,
+			std::size_t nodeIndex,
+			unsigned int width,
+			unsigned int height,
+			unsigned int& restingY
+		) const;
+
+		static void addToSkyline(
+			Page& page,
+			std::size_t nodeIndex,
+			unsigned int x,
+			unsigned int y,
+			unsigned int width,
+			unsigned int height
+		);
+	};
+}
\ No newline at end of file
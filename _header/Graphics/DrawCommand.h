@@ -0,0 +1,109 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <type_traits>
+
+//forward declare so that draw commands can be built without d3d
+struct ID3D11ShaderResourceView;
+
+namespace process::graphics {
+
+	//A flat description of a single sprite draw, extracted from the ecs once per tick.
+	//Positions are pre offset centers; tile sprites cover rect and ignore position.
+	struct DrawCommand {
+		enum class DrawType : std::uint8_t {
+			sprite,
+			subSprite,		//rect is the source rectangle within the texture
+			tileSprite		//rect is the draw rectangle, pixelOffset scrolls the tiles
+		};
+
+		//SpriteDrawInstruction::maxDepth - SpriteDrawInstruction::minDepth + 1
+		static constexpr int depthRange{ 20001 };
+
+		DrawType drawType;
+		int depth;
+		ID3D11ShaderResourceView* textureView;	//not owned, see RenderSnapshot
+		unsigned int textureWidth;
+		unsigned int textureHeight;
+		float pastX;
+		float pastY;
+		float x;
+		float y;
+		float offsetX;
+		float offsetY;
+		float rotation;		//degrees
+		float scale;
+		float rectX;
+		float rectY;
+		float rectWidth;
+		float rectHeight;
+		float pixelOffsetX;
+		float pixelOffsetY;
+		float atlasULow;	//where the sprite lies within the texture, see Sprite
+		float atlasVLow;
+		float atlasUHigh;
+		float atlasVHigh;
+
+		//returns the x coordinate the given fraction of the way from past to present
+		float interpolateX(float interpolation) const {
+			return pastX + ((x - pastX) * interpolation);
+		}
+
+		//returns the y coordinate the given fraction of the way from past to present
+		float interpolateY(float interpolation) const {
+			return pastY + ((y - pastY) * interpolation);
+		}
+	};
+
+	static_assert(std::is_trivially_copyable_v<DrawCommand>);
+	static_assert(std::is_standard_layout_v<DrawCommand>);
+
+	//Draw commands for a stack of scenes, bottom scene first. The commands of each scene
+	//are contiguous and sorted back to front by depth.
+	class DrawCommandList {
+	private:
+		//fields
+		std::vector<DrawCommand> drawCommands {};
+		std::vector<std::size_t> sceneEndIndices {};
+
+	public:
+		void clear() {
+			drawCommands.clear();
+			sceneEndIndices.clear();
+		}
+
+		//Appends a command to the scene currently being built
+		void add(const DrawCommand& drawCommand) {
+			drawCommands.push_back(drawCommand);
+		}
+
+		//Sorts the scene currently being built and starts the next one
+		void endScene();
+
+		std::size_t getSceneCount() const {
+			return sceneEndIndices.size();
+		}
+
+		const DrawCommand* sceneBegin(std::size_t sceneIndex) const {
+			return drawCommands.data() + getSceneBeginIndex(sceneIndex);
+		}
+
+		const DrawCommand* sceneEnd(std::size_t sceneIndex) const {
+			return drawCommands.data() + sceneEndIndices[sceneIndex];
+		}
+
+		const std::vector<DrawCommand>& getDrawCommands() const {
+			return drawCommands;
+		}
+
+		//Hashes every command and scene boundary. Texture identity is left out so that
+		//hashes can be compared between runs.
+		std::uint64_t hash() const;
+
+	private:
+		std::size_t getSceneBeginIndex(std::size_t sceneIndex) const {
+			return sceneIndex == 0 ? 0 : sceneEndIndices[sceneIndex - 1];
+		}
+	};
+}
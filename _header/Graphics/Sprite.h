@@ -7,5 +7,12 @@ namespace process::graphics {
 		Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> textureView{};
 		unsigned int width{};
 		unsigned int height{};
+		//atlas page the texture view belongs to, or -1 if the sprite has its own texture
+		int page{ -1 };
+		//where the sprite lies within the texture, in texture coordinates
+		float uLow{ 0.0f };
+		float vLow{ 0.0f };
+		float uHigh{ 1.0f };
+		float vHigh{ 1.0f };
 	};
 }
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "Graphics/DrawCommand.h"
+
+namespace process::graphics {
+
+	//Per instance data read by the vertex shader; layout must match the input layout in
+	//GraphicsWrapper. A unit quad vertex (x, y) lands at
+	//(x * transform[0] + y * transform[2] + translation[0],
+	// x * transform[1] + y * transform[3] + translation[1]) in NDC.
+	//uvRect is relative to the sprite and is mapped into atlasRect by the pixel shader,
+	//wrapping around first if tiling is set.
+	struct SpriteInstance {
+		float transform[4];		//xx, xy, yx, yy
+		float translation[3];	//ndc x, ndc y, depth shift
+		float uvRect[4];		//uLow, vLow, uHigh, vHigh
+		float atlasRect[4];		//uLow, vLow, uHigh, vHigh within the texture
+		float tiling;			//1 to repeat the sprite across the quad, otherwise 0
+	};
+
+	static_assert(sizeof(SpriteInstance) == 16 * sizeof(float));
+
+	//A run of instances which all sample the same texture
+	struct SpriteBatch {
+		ID3D11ShaderResourceView* textureView{};
+		std::uint32_t firstInstance{};
+		std::uint32_t instanceCount{};
+	};
+
+	//Turns draw commands into sprite instances, batching consecutive commands which share
+	//a texture. Knows nothing of the device, so the graphics wrapper only has to upload
+	//and draw.
+	class SpriteBatcher {
+	private:
+		//fields
+		float graphicsWidth{};
+		float graphicsHeight{};
+		std::vector<SpriteInstance> instances{};
+		std::vector<SpriteBatch> batches{};
+
+	public:
+		SpriteBatcher(int graphicsWidth, int graphicsHeight)
+			: graphicsWidth{ static_cast<float>(graphicsWidth) }
+			, graphicsHeight{ static_cast<float>(graphicsHeight) } {
+		}
+
+		void clear() {
+			instances.clear();
+			batches.clear();
+		}
+
+		//Adds a single command, extending the last batch if it uses the same texture
+		void add(const DrawCommand& drawCommand, float interpolation);
+
+		//Adds a depth sorted range of commands in order. Commands of equal depth are not
+		//regrouped by texture: the depth test keeps the first of two equal depths drawn,
+		//so reordering them would change which sprite shows where they overlap.
+		void add(const DrawCommand* begin, const DrawCommand* end, float interpolation);
+
+		const std::vector<SpriteInstance>& getInstances() const {
+			return instances;
+		}
+
+		const std::vector<SpriteBatch>& getBatches() const {
+			return batches;
+		}
+
+		//Computes the instance for a command. Returns false if there is nothing to draw.
+		bool makeInstance(
+			const DrawCommand& drawCommand,
+			float interpolation,
+			SpriteInstance& instance
+		) const;
+	};
+}
@@ -19,6 +19,19 @@ namespace process::graphics {
 		ComPtr<IWICImagingFactory> wicFactoryPointer{};
 	
 	public:
+		//pixel format every atlas page is built in
+		static constexpr DXGI_FORMAT atlasFormat{ DXGI_FORMAT_B8G8R8A8_UNORM };
+		static constexpr std::size_t atlasBytesPerPixel{ 4 };
+		
+		struct PixelDataBuffer{
+			std::vector<byte> buffer{};
+			std::size_t sizeBytes{};
+			std::size_t widthBytes{};
+			std::size_t heightBytes{};
+			unsigned int width{};
+			unsigned int height{};
+		};
+		
 		SpriteLoader();
 		
 		ComPtr<IWICBitmapFrameDecode> getWicFramePointer(
@@ -29,6 +42,17 @@ namespace process::graphics {
 			const ComPtr<IWICBitmapFrameDecode>& framePointer,
 			const ComPtr<ID3D11Device>& devicePointer
 		);
+		
+		//decodes the frame into atlasFormat pixels for copying into an atlas page
+		PixelDataBuffer getAtlasPixelDataBuffer(
+			const ComPtr<IWICBitmapFrameDecode>& framePointer
+		);
+		
+		Sprite convertPixelDataBufferToSprite(
+			const PixelDataBuffer& pixelDataBuffer,
+			DXGI_FORMAT format,
+			const ComPtr<ID3D11Device>& devicePointer
+		);
 	
 	private:
 		void init();
@@ -42,15 +66,6 @@ namespace process::graphics {
 			const ComPtr<IWICBitmapFrameDecode>& framePointer
 		);
 		
-		struct PixelDataBuffer{
-			std::vector<byte> buffer{};
-			std::size_t sizeBytes{};
-			std::size_t widthBytes{};
-			std::size_t heightBytes{};
-			unsigned int width{};
-			unsigned int height{};
-		};
-		
 		PixelDataBuffer getPixelDataBuffer(const ComPtr<IWICBitmapFrameDecode>& framePointer);
 		
 		uint_least32_t getBitsPerPixel(const WICPixelFormatGUID& format);
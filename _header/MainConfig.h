@@ -13,13 +13,31 @@ namespace process::game::config {
 	//resources
 	constexpr wchar_t mainManifestPath[] { L"res\\potuk.mfst" };
 	constexpr char mainConfigPath[] { "res\\potuk.cfg" };
+	//parsed scripts, rebuilt whenever a script source changes
+	constexpr wchar_t scriptCachePath[] { L"res\\scripts.dkc" };
+	//decode scripts, midi and dialogue on a thread pool while loading
+	constexpr bool parallelResourceLoading { true };
+	//re-parse scripts as their files are saved and swap them in between ticks
+	constexpr bool hotReloadScripts { false };
+	//also restart scripts which are mid run when their file is reloaded
+	constexpr bool restartReloadedScripts { false };
 	
 	//graphics
 	constexpr int graphicsWidth { windowWidth / 2 };        //320
 	constexpr int graphicsHeight { windowHeight / 2 };    //240
+	//sprites are packed into square atlas pages of this size
+	constexpr unsigned int atlasPageSize { 1024u };
+	constexpr unsigned int atlasPadding { 1u };
+	//text is drawn on a grid of cells this far apart
+	constexpr int textHorizontalSpacing { 7 };
+	constexpr int textVerticalSpacing { 11 };
+	//dialogue text is shaped to this width when it is loaded
+	constexpr int dialogueTextWidth { 180 };
 	
 	//Game
 	constexpr int updatesPerSecond { 60 };
 	constexpr int maxUpdatesWithoutFrame { 5 };
+	//run updates on their own thread and render interpolated snapshots
+	constexpr bool threadedUpdates { false };
 	using PrngType = std::mt19937;
 }
\ No newline at end of file
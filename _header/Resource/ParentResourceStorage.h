@@ -40,5 +40,8 @@ namespace process::resource {
 		void unload(const std::wstring& id) override;
 		
 		void remove(const std::wstring& id) override;
+		
+		//the total of every loaded child
+		std::size_t getMemoryUsage(const std::wstring& id) const override;
 	};
 }
\ No newline at end of file
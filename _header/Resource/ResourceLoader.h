@@ -3,9 +3,12 @@
 #include <unordered_map>
 #include <array>
 #include <memory>
+#include <vector>
+#include <functional>
 
 #include "Resource/FileLoadable.h"
 #include "Resource/ManifestLoadable.h"
+#include "Utility/ThreadPool.h"
 
 namespace process::resource {
 	
@@ -18,6 +21,10 @@ namespace process::resource {
 		//fields
 		std::unordered_map<std::wstring, FileLoadable*> fileExtensionMap {};
 		std::unordered_map<std::wstring, ManifestLoadable*> manifestPrefixMap {};
+		
+		//decoding deferred while walking the tree in loadFileInParallel
+		mutable std::vector<std::function<void()>> deferredTasks {};
+		bool deferring {};
 	
 	public:
 		template <std::size_t numLoadables>
@@ -50,6 +57,28 @@ namespace process::resource {
 		ResourceBase* loadManifestEntry(
 			const ManifestOrigin& manifestOrigin
 		) const;
+		
+		//Loads like loadFile, but the decoding storages pass to runOrDefer is put off
+		//until the whole manifest and directory tree has been walked, then run on the
+		//thread pool. Resources are still created and published during the walk, so ids
+		//and storage contents are the same as loading serially.
+		ResourceBase* loadFileInParallel(
+			const FileOrigin& fileOrigin,
+			wasp::utility::ThreadPool& threadPool
+		);
+		
+		//Loads like loadManifestEntry, but hands back the decoding tasks instead of
+		//running them, so that they may run on another thread. The new resources must
+		//not be read until every task has run.
+		ResourceBase* loadManifestEntryDeferred(
+			const ManifestOrigin& manifestOrigin,
+			std::vector<std::function<void()>>& decodingTasks
+		);
+		
+		//Runs the task now, or later on the thread pool if loading in parallel. A deferred
+		//task may only touch the data of the resource it decodes and whatever else its
+		//storage guards itself.
+		void runOrDefer(const std::wstring& fileName, std::function<void()> task) const;
 	
 	private:
 		FileLoadable* asFileLoadable(Loadable* loadable) const {
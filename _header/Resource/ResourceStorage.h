@@ -68,5 +68,15 @@ namespace process::resource {
 				}
 			);
 		}
+	
+	protected:
+		//null if there is no such resource or it is not loaded
+		const T* findData(const std::wstring& id) const {
+			auto found { resourceMap.find(id) };
+			if( found != resourceMap.end() ) {
+				return found->second->getDataPointerCopy().get();
+			}
+			return nullptr;
+		}
 	};
 }
\ No newline at end of file
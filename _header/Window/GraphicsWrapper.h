@@ -2,6 +2,7 @@
 
 #include "Graphics/ISpriteDrawer.h"
 #include "Graphics/ITextDrawer.h"
+#include "Graphics/SpriteBatcher.h"
 
 #include "windowsInclude.h"
 #include "d3dInclude.h"
@@ -18,11 +19,7 @@ namespace process::window {
 		template <typename T>
 		using ComPtr = Microsoft::WRL::ComPtr<T>;
 		using SpriteDrawInstruction = graphics::SpriteDrawInstruction;
-		
-		struct VSConstantBuffer{
-			[[maybe_unused]] //the following IS used by d3d
-			DirectX::XMMATRIX transform{};
-		};
+		using DrawCommand = graphics::DrawCommand;
 		
 		//fields
 		int graphicsWidth {};
@@ -33,7 +30,10 @@ namespace process::window {
 		ComPtr<ID3D11DeviceContext> contextPointer {};
 		ComPtr<ID3D11RenderTargetView> renderTargetViewPointer {};
 		ComPtr<ID3D11DepthStencilView> depthStencilViewPointer {};
-		ComPtr<ID3D11Buffer> VSConstantBufferPointer{};
+		ComPtr<ID3D11Buffer> instanceBufferPointer{};
+		UINT instanceBufferCapacity{};
+		
+		graphics::SpriteBatcher spriteBatcher;	//not initialized!
 		
 	public:
 		GraphicsWrapper(
@@ -76,6 +76,13 @@ namespace process::window {
 			const graphics::SymbolMap<wchar_t>& symbolMap
 		) override;
 		
+		//Draws a depth sorted range of commands with one instanced draw per texture
+		void drawCommands(
+			const DrawCommand* begin,
+			const DrawCommand* end,
+			float interpolation
+		);
+		
 		struct Vertex{
 			//the following ARE used by d3d
 			[[maybe_unused]]
@@ -99,14 +106,9 @@ namespace process::window {
 		ComPtr<ID3DBlob> setVertexShader();
 		void setPixelShader();
 		void setSampler();
-		void setVSConstantBuffer();
 		void setInputLayout(const ComPtr<ID3DBlob>& vsBlobPointer);
-		void setVertexBuffer(
-			float uLow = 0.0f,
-			float uHigh = 1.0f,
-			float vLow = 0.0f,
-			float vHigh = 1.0f
-		);
+		void setVertexBuffer();
+		void setInstanceBuffer(UINT capacity);
 		void setViewport();
 		void setDepthStencilState();
 		void setBlendState();
@@ -114,15 +116,8 @@ namespace process::window {
 		
 		void bufferSwap();
 		void clearBuffer();
-		void updatePSTexture(const SpriteDrawInstruction& spriteDrawInstruction);
-		[[nodiscard]]
-		DirectX::XMMATRIX makeTransform(
-			GraphicsWrapper::Point2 preOffsetCenter,
-			const SpriteDrawInstruction& spriteDrawInstruction,
-			float quadWidthPixels,
-			float quadHeightPixels
-		) const;
-		void mapVSConstantBuffer(const VSConstantBuffer* constantBuffer);
-		void updateVSConstantBuffer();
+		void updatePSTexture(ID3D11ShaderResourceView* textureView);
+		void drawBatches();
+		void mapInstanceBuffer(const std::vector<graphics::SpriteInstance>& instances);
 	};
 }
\ No newline at end of file
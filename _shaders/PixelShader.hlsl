@@ -5,10 +5,15 @@ SamplerState samplerState;
 struct VSOut{
     float4 pos : SV_Position;
     float2 texCoord : TexCoord;
+    nointerpolation float4 atlasRect : AtlasRect;
+    nointerpolation float tiling : Tiling;
 };
 
 float4 main( VSOut vsOut ) : SV_Target{
-    float4 output = tex.Sample(samplerState, vsOut.texCoord);
+    //wrap within the sprite rather than the whole atlas page
+    float2 texCoord = vsOut.tiling > 0.5f ? frac(vsOut.texCoord) : vsOut.texCoord;
+    texCoord = lerp(vsOut.atlasRect.xy, vsOut.atlasRect.zw, texCoord);
+    float4 output = tex.Sample(samplerState, texCoord);
     if(output.a < 0.1){
         discard;
     }
@@ -1,15 +1,28 @@
-cbuffer CBuffer{
-    matrix transform;
+struct VSIn{
+    float3 pos : Position;
+    float2 texCoord : TexCoord;
+    float4 transform : InstanceTransform;       //xx, xy, yx, yy
+    float3 translation : InstanceTranslation;   //ndc x, ndc y, depth shift
+    float4 uvRect : InstanceUVRect;             //uLow, vLow, uHigh, vHigh
+    float4 atlasRect : InstanceAtlasRect;       //uLow, vLow, uHigh, vHigh
+    float tiling : InstanceTiling;
 };
 
 struct VSOut{
     float4 pos : SV_Position;
-    float2 texCoord : TexCoord;
+    float2 texCoord : TexCoord;                 //relative to the sprite
+    nointerpolation float4 atlasRect : AtlasRect;
+    nointerpolation float tiling : Tiling;
 };
 
-VSOut main( float3 pos : Position, float2 texCoord : TexCoord ) {
+VSOut main( VSIn vsIn ) {
     VSOut toRet;
-    toRet.texCoord = texCoord;
-    toRet.pos = mul( float4( pos, 1.0f), transform );
+    toRet.texCoord = lerp( vsIn.uvRect.xy, vsIn.uvRect.zw, vsIn.texCoord );
+    toRet.atlasRect = vsIn.atlasRect;
+    toRet.tiling = vsIn.tiling;
+    float2 xy = vsIn.pos.x * vsIn.transform.xy
+        + vsIn.pos.y * vsIn.transform.zw
+        + vsIn.translation.xy;
+    toRet.pos = float4( xy, vsIn.pos.z + vsIn.translation.z, 1.0f );
     return toRet;
-}
+}
\ No newline at end of file
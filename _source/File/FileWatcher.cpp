@@ -0,0 +1,106 @@
+#include "File/FileWatcher.h"
+
+#include <algorithm>
+
+#include "Logging.h"
+
+namespace process::file {
+	
+	FileWatcher::FileWatcher(
+		const std::vector<std::wstring>& fileNames,
+		std::chrono::milliseconds pollInterval,
+		std::function<void(const std::wstring& fileName)> changeCallback
+	)
+		: pollInterval { pollInterval }
+		, changeCallback { std::move(changeCallback) } {
+		
+		watchedFiles.reserve(fileNames.size());
+		for( const std::wstring& fileName : fileNames ) {
+			WatchedFile watchedFile { fileName };
+			tryGetLastWriteTime(fileName, watchedFile.lastWriteTime);
+			watchedFiles.push_back(std::move(watchedFile));
+		}
+		
+		watchThread = std::thread { [&] { this->watchLoop(); } };
+	}
+	
+	FileWatcher::~FileWatcher() {
+		{
+			std::lock_guard lock { stopMutex };
+			stopFlag = true;
+		}
+		stopCondition.notify_one();
+		if( watchThread.joinable() ) {
+			watchThread.join();
+		}
+	}
+	
+	void FileWatcher::watchLoop() {
+		std::unique_lock lock { stopMutex };
+		while( !stopCondition.wait_for(lock, pollInterval, [&] { return stopFlag; }) ) {
+			lock.unlock();
+			poll();
+			lock.lock();
+		}
+	}
+	
+	void FileWatcher::watch(const std::wstring& fileName) {
+		WatchedFile watchedFile { fileName };
+		tryGetLastWriteTime(fileName, watchedFile.lastWriteTime);
+		
+		std::lock_guard lock { watchMutex };
+		auto found { std::find_if(
+			watchedFiles.begin(),
+			watchedFiles.end(),
+			[&](const WatchedFile& other) { return other.fileName == fileName; }
+		) };
+		if( found == watchedFiles.end() ) {
+			watchedFiles.push_back(std::move(watchedFile));
+		}
+	}
+	
+	void FileWatcher::poll() {
+		std::size_t fileCount {};
+		{
+			std::lock_guard lock { watchMutex };
+			fileCount = watchedFiles.size();
+		}
+		for( std::size_t i { 0 }; i < fileCount; ++i ) {
+			std::wstring fileName {};
+			FileTime oldWriteTime {};
+			{
+				std::lock_guard lock { watchMutex };
+				fileName = watchedFiles[i].fileName;
+				oldWriteTime = watchedFiles[i].lastWriteTime;
+			}
+			FileTime lastWriteTime {};
+			if(
+				!tryGetLastWriteTime(fileName, lastWriteTime)
+				|| lastWriteTime == oldWriteTime
+			) {
+				continue;
+			}
+			//the callback runs on our thread, so it must not escape; if it fails the old
+			//time is kept and the change is seen again next poll
+			try {
+				changeCallback(fileName);
+			}
+			catch( const std::exception& exception ) {
+				wasp::debug::log(exception.what());
+				continue;
+			}
+			std::lock_guard lock { watchMutex };
+			watchedFiles[i].lastWriteTime = lastWriteTime;
+		}
+	}
+	
+	bool FileWatcher::tryGetLastWriteTime(const std::wstring& fileName, FileTime& time) {
+		std::error_code errorCode {};
+		FileTime lastWriteTime { std::filesystem::last_write_time(fileName, errorCode) };
+		if( errorCode ) {
+			return false;
+		}
+		time = lastWriteTime;
+		return true;
+	}
+}
\ No newline at end of file
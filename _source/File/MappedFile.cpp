@@ -0,0 +1,75 @@
+#include "File\MappedFile.h"
+
+#include "windowsInclude.h"
+
+namespace process::file {
+	
+	MappedFile::MappedFile(const std::wstring& fileName) {
+		map(fileName);
+	}
+	
+	MappedFile::~MappedFile() {
+		close();
+	}
+	
+	void MappedFile::map(const std::wstring& fileName) {
+		close();
+		HANDLE file { CreateFileW(
+			fileName.c_str(),
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+			nullptr
+		) };
+		if( file == INVALID_HANDLE_VALUE ) {
+			return;
+		}
+		fileHandle = file;
+		
+		LARGE_INTEGER fileSize {};
+		if( !GetFileSizeEx(file, &fileSize) ) {
+			close();
+			return;
+		}
+		sizeBytes = static_cast<std::size_t>(fileSize.QuadPart);
+		
+		//empty files cannot be mapped
+		if( sizeBytes == 0 ) {
+			open = true;
+			return;
+		}
+		
+		mappingHandle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if( !mappingHandle ) {
+			close();
+			return;
+		}
+		dataPointer = static_cast<const std::uint8_t*>(
+			MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0)
+		);
+		if( !dataPointer ) {
+			close();
+			return;
+		}
+		open = true;
+	}
+	
+	void MappedFile::close() {
+		if( dataPointer ) {
+			UnmapViewOfFile(dataPointer);
+			dataPointer = nullptr;
+		}
+		if( mappingHandle ) {
+			CloseHandle(mappingHandle);
+			mappingHandle = nullptr;
+		}
+		if( fileHandle ) {
+			CloseHandle(fileHandle);
+			fileHandle = nullptr;
+		}
+		sizeBytes = 0;
+		open = false;
+	}
+}
\ No newline at end of file
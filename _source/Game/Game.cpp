@@ -1,5 +1,9 @@
 #include "Game/Game.h"
 
+#include <algorithm>
+
+#include "MainConfig.h"
+
 #include "Logging.h"
 
 namespace process::game {
@@ -7,6 +11,7 @@ namespace process::game {
 	Game::Game(
 		wasp::game::Settings* settingsPointer,
 		resources::ResourceMasterStorage* resourceMasterStoragePointer,
+		resources::ResidencyManager* residencyManagerPointer,
 		window::GraphicsWrapper* graphicsWrapperPointer,
 		wasp::input::IKeyInputTable* keyInputTablePointer,
 		wasp::sound::midi::MidiHub* midiHubPointer
@@ -14,12 +19,14 @@ namespace process::game {
 		: sceneList{ std::move(makeSceneList()) }
 		, sceneUpdater{ 
 			resourceMasterStoragePointer, 
+			residencyManagerPointer,
 			keyInputTablePointer, 
 			&globalChannelSet 
 		}
 		, sceneRenderer{ graphicsWrapperPointer, resourceMasterStoragePointer->spriteStorage }
 		, settingsPointer{ settingsPointer }
 		, resourceMasterStoragePointer{ resourceMasterStoragePointer }
+		, residencyManagerPointer{ residencyManagerPointer }
 		, graphicsWrapperPointer{ graphicsWrapperPointer }
 		, keyInputTablePointer{ keyInputTablePointer }
 		, midiHubPointer{ midiHubPointer }
@@ -28,6 +35,9 @@ namespace process::game {
 	}
 
 	void Game::update() {
+		if constexpr (config::hotReloadScripts) {
+			updateScripts();
+		}
 		for (auto itr{ sceneList.rbegin() }; itr != sceneList.rend(); ++itr) {
 			auto& scene{ *(*itr) };	//dereference itr and shared_ptr
 			sceneUpdater(scene);
@@ -51,6 +61,15 @@ namespace process::game {
 		return globalChannelSet.getChannel(GlobalTopics::exitFlag).hasMessages();
 	}
 
+	void Game::updateScripts() {
+		const auto& reloadedScripts{
+			resourceMasterStoragePointer->scriptStorage.applyReloadedScripts()
+		};
+		if (!reloadedScripts.empty()) {
+			sceneUpdater.reloadScripts(reloadedScripts);
+		}
+	}
+
 	void Game::updateSceneList() {		
 		//lock input (don't let new scenes see input)
 		keyInputTablePointer->lockAll();
@@ -65,6 +84,29 @@ namespace process::game {
 				sceneList.popBackTo(message);
 			}
 			sceneExitToChannel.clear();
+			
+			//stage resources are only kept while a game is open
+			bool gameOpen{ std::any_of(
+				sceneList.begin(),
+				sceneList.end(),
+				[](const auto& scenePointer) {
+					return scenePointer->getName() == SceneNames::game;
+				}
+			) };
+			bool gameReopening{ false };
+			auto& sceneEntryChannel{ globalChannelSet.getChannel(GlobalTopics::sceneEntry) };
+			if (sceneEntryChannel.hasMessages()) {
+				const auto& sceneEntryMessages{ sceneEntryChannel.getMessages() };
+				gameReopening = std::find(
+					sceneEntryMessages.begin(),
+					sceneEntryMessages.end(),
+					SceneNames::game
+				) != sceneEntryMessages.end();
+			}
+			if (!gameOpen && !gameReopening) {
+				//snapshots in flight hold their own texture references, see RenderSnapshot
+				residencyManagerPointer->releaseAll();
+			}
 		}
 
 		//then push and update new scenes
@@ -162,4 +204,73 @@ namespace process::game {
 		//for each scene, we need to clear the depth since painter's algorithm
 		graphicsWrapperPointer->clearDepth();
 	}
+
+	void Game::publishRenderSnapshot() {
+		RenderSnapshot& renderSnapshot{ renderSnapshotBuffer.getWriteBuffer() };
+		renderSnapshot.tick = ++renderSnapshotTick;
+		renderSnapshot.drawCommandList.clear();
+		recursiveSnapshotHelper(sceneList.rbegin(), renderSnapshot);
+		holdSnapshotTextures(renderSnapshot);
+		renderSnapshot.updateTime = std::chrono::steady_clock::now();
+		renderSnapshotBuffer.publish();
+	}
+
+	void Game::recursiveSnapshotHelper(
+		const SceneList::ReverseIterator& itr,
+		RenderSnapshot& renderSnapshot
+	) {
+		auto& scene{ *(*itr) };	//dereference itr and shared_ptr
+		if (itr != sceneList.rend()
+				&& scene.isTransparent(SystemChainIDs::render))
+		{
+			recursiveSnapshotHelper(itr + 1, renderSnapshot);
+		}
+		sceneRenderer.extract(scene, renderSnapshot.drawCommandList, renderSnapshot.tick);
+	}
+
+	void Game::holdSnapshotTextures(RenderSnapshot& renderSnapshot) {
+		//the write buffer is never the one being drawn, so its old references can go
+		snapshotTextureViews.clear();
+		for (const auto& drawCommand : renderSnapshot.drawCommandList.getDrawCommands()) {
+			//commands are depth sorted, so repeats are mostly adjacent
+			if (snapshotTextureViews.empty()
+					|| snapshotTextureViews.back() != drawCommand.textureView)
+			{
+				snapshotTextureViews.push_back(drawCommand.textureView);
+			}
+		}
+		std::sort(snapshotTextureViews.begin(), snapshotTextureViews.end());
+		snapshotTextureViews.erase(
+			std::unique(snapshotTextureViews.begin(), snapshotTextureViews.end()),
+			snapshotTextureViews.end()
+		);
+		renderSnapshot.textureViews.assign(
+			snapshotTextureViews.begin(),
+			snapshotTextureViews.end()
+		);
+	}
+
+	void Game::renderSnapshot() {
+		using DurationType = std::chrono::duration<float>;
+		constexpr float secondsPerUpdate{ 1.0f / config::updatesPerSecond };
+
+		renderSnapshotBuffer.updateReadBuffer();
+		const RenderSnapshot& renderSnapshot{ renderSnapshotBuffer.getReadBuffer() };
+
+		//interpolate from the past position to the present over one update
+		float secondsSinceUpdate{
+			DurationType{ std::chrono::steady_clock::now() - renderSnapshot.updateTime }
+				.count()
+		};
+		float interpolation{
+			std::clamp(secondsSinceUpdate / secondsPerUpdate, 0.0f, 1.0f)
+		};
+
+		const auto& drawCommandList{ renderSnapshot.drawCommandList };
+		for (std::size_t i{ 0 }; i < drawCommandList.getSceneCount(); ++i) {
+			sceneRenderer(drawCommandList, i, interpolation);
+			//for each scene, we need to clear the depth since painter's algorithm
+			graphicsWrapperPointer->clearDepth();
+		}
+	}
 }
\ No newline at end of file
@@ -1,11 +1,19 @@
 #include "Game/Resources/DialogueStorage.h"
 
 #include "File/FileUtil.h"
+#include "MainConfig.h"
 
 namespace process::game::resources {
 	
 	namespace {
 		using ResourceBase = wasp::resource::ResourceBase;
+		
+		constexpr int textColumns {
+			wasp::game::resources::getColumnCount(
+				config::dialogueTextWidth,
+				config::textHorizontalSpacing
+			)
+		};
 	}
 	
 	void DialogueStorage::reload(const std::wstring& id) {
@@ -45,6 +53,18 @@ namespace process::game::resources {
 		}
 	}
 	
+	std::size_t DialogueStorage::getMemoryUsage(const std::wstring& id) const {
+		const Dialogue* dialoguePointer { findData(id) };
+		if( !dialoguePointer ) {
+			return 0;
+		}
+		const Dialogue& dialogue { *dialoguePointer };
+		return sizeof(Dialogue)
+			+ dialogue.commands.capacity() * sizeof(wasp::game::resources::DialogueCommand)
+			+ dialogue.stringPool.capacity() * sizeof(wchar_t)
+			+ dialogue.glyphPool.capacity() * sizeof(wasp::game::resources::ShapedGlyph);
+	}
+	
 	ResourceBase* DialogueStorage::loadFromFile(
 		const resource::FileOrigin& fileOrigin,
 		const resource::ResourceLoader& resourceLoader
@@ -55,13 +75,22 @@ namespace process::game::resources {
 			throw std::runtime_error { "Error loaded pre-existing id" };
 		}
 		
+		std::shared_ptr<Dialogue> dialoguePointer { std::make_shared<Dialogue>() };
+		resourceLoader.runOrDefer(
+			fileOrigin.fileName,
+			[dialoguePointer, fileName { fileOrigin.fileName }] {
+				*dialoguePointer = wasp::game::resources::parseDialogueFile(
+					fileName,
+					textColumns
+				);
+			}
+		);
+		
 		std::shared_ptr<ResourceType> resourceSharedPointer {
 			std::make_shared<ResourceType>(
 				id,
 				fileOrigin,
-				std::make_shared<Dialogue>(
-					wasp::game::resources::parseDialogueFile(fileOrigin.fileName)
-				)
+				dialoguePointer
 			)
 		};
 		
@@ -83,13 +112,22 @@ namespace process::game::resources {
 			throw std::runtime_error { "Error loaded pre-existing id" };
 		}
 		
+		std::shared_ptr<Dialogue> dialoguePointer { std::make_shared<Dialogue>() };
+		resourceLoader.runOrDefer(
+			fileName,
+			[dialoguePointer, fileName] {
+				*dialoguePointer = wasp::game::resources::parseDialogueFile(
+					fileName,
+					textColumns
+				);
+			}
+		);
+		
 		std::shared_ptr<ResourceType> resourceSharedPointer {
 			std::make_shared<ResourceType>(
 				id,
 				manifestOrigin,
-				std::make_shared<Dialogue>(
-					wasp::game::resources::parseDialogueFile(fileName)
-				)
+				dialoguePointer
 			)
 		};
 		
@@ -1,17 +1,46 @@
 #include "Game/Resources/MidiSequenceStorage.h"
 
 #include "File/FileUtil.h"
+#include "File/MappedFile.h"
 #include "Sound/MidiSequenceLoading.h"
 
+#include <functional>
+
 namespace process::game::resources {
 	
 	namespace {
 		using ResourceBase = wasp::resource::ResourceBase;
+		using MidiSequence = wasp::sound::midi::MidiSequence;
+		
+		void throwIfNotOpen(const file::MappedFile& mappedFile) {
+			if( !mappedFile.isOpen() ) {
+				throw std::runtime_error { "Error failed to open MIDI file" };
+			}
+		}
+		
+		//the file stays mapped only for as long as it takes to parse
+		MidiSequence parseMappedMidiFile(const std::wstring& fileName) {
+			file::MappedFile mappedFile { fileName };
+			throwIfNotOpen(mappedFile);
+			return wasp::sound::midi::parseMidiData(mappedFile.data(), mappedFile.size());
+		}
+		
+		MidiSequence parseMappedMidiFile(
+			const std::wstring& fileName,
+			int64_t loopStart,
+			int64_t loopEnd = -1
+		) {
+			file::MappedFile mappedFile { fileName };
+			throwIfNotOpen(mappedFile);
+			return wasp::sound::midi::parseLoopedMidiData(
+				mappedFile.data(),
+				mappedFile.size(),
+				loopStart,
+				loopEnd
+			);
+		}
 	}
 	
-	using wasp::sound::midi::parseMidiFile;
-	using wasp::sound::midi::parseLoopedMidiFile;
-	
 	void MidiSequenceStorage::reload(const std::wstring& id) {
 		if( resourceLoaderPointer ) {
 			auto found { resourceMap.find(id) };
@@ -49,6 +78,15 @@ namespace process::game::resources {
 		}
 	}
 	
+	std::size_t MidiSequenceStorage::getMemoryUsage(const std::wstring& id) const {
+		const MidiSequence* midiSequencePointer { findData(id) };
+		if( !midiSequencePointer ) {
+			return 0;
+		}
+		return sizeof(MidiSequence)
+			+ midiSequencePointer->compiledTrack.capacity() * sizeof(MidiSequence::EventUnit);
+	}
+	
 	ResourceBase* MidiSequenceStorage::loadFromFile(
 		const resource::FileOrigin& fileOrigin,
 		const resource::ResourceLoader& resourceLoader
@@ -59,13 +97,21 @@ namespace process::game::resources {
 			throw std::runtime_error { "Error loaded pre-existing id" };
 		}
 		
+		std::shared_ptr<MidiSequence> midiSequencePointer {
+			std::make_shared<MidiSequence>()
+		};
+		resourceLoader.runOrDefer(
+			fileOrigin.fileName,
+			[midiSequencePointer, fileName { fileOrigin.fileName }] {
+				*midiSequencePointer = parseMappedMidiFile(fileName);
+			}
+		);
+		
 		std::shared_ptr<ResourceType> resourceSharedPointer {
 			std::make_shared<ResourceType>(
 				id,
 				fileOrigin,
-				std::make_shared<MidiSequence>(
-					wasp::sound::midi::parseMidiFile(fileOrigin.fileName)
-				)
+				midiSequencePointer
 			)
 		};
 		
@@ -82,21 +128,25 @@ namespace process::game::resources {
 		size_t numberOfManifestArguments { manifestOrigin.manifestArguments.size() };
 		
 		const std::wstring& fileName { manifestOrigin.manifestArguments[1] };
-		MidiSequence midiSequence {};
+		std::function<MidiSequence()> parse {};
 		switch( numberOfManifestArguments ) {
 			case 2: {
-				midiSequence = parseMidiFile(fileName);
+				parse = [fileName] { return parseMappedMidiFile(fileName); };
 				break;
 			}
 			case 3: {
 				int64_t loopStart { std::stoll(manifestOrigin.manifestArguments[2]) };
-				midiSequence = parseLoopedMidiFile(fileName, loopStart);
+				parse = [fileName, loopStart] {
+					return parseMappedMidiFile(fileName, loopStart);
+				};
 				break;
 			}
 			case 4: {
 				int64_t loopStart { std::stoll(manifestOrigin.manifestArguments[2]) };
 				int64_t loopEnd { std::stoll(manifestOrigin.manifestArguments[3]) };
-				midiSequence = parseLoopedMidiFile(fileName, loopStart, loopEnd);
+				parse = [fileName, loopStart, loopEnd] {
+					return parseMappedMidiFile(fileName, loopStart, loopEnd);
+				};
 				break;
 			}
 			default: {
@@ -109,13 +159,21 @@ namespace process::game::resources {
 			throw std::runtime_error { "Error loaded pre-existing id" };
 		}
 		
+		std::shared_ptr<MidiSequence> midiSequencePointer {
+			std::make_shared<MidiSequence>()
+		};
+		resourceLoader.runOrDefer(
+			fileName,
+			[midiSequencePointer, parse { std::move(parse) }] {
+				*midiSequencePointer = parse();
+			}
+		);
+		
 		std::shared_ptr<ResourceType> resourceSharedPointer {
 			std::make_shared<ResourceType>(
 				id,
 				manifestOrigin,
-				std::make_shared<MidiSequence>(
-					midiSequence
-				)
+				midiSequencePointer
 			)
 		};
 		
@@ -0,0 +1,158 @@
+#include "Game/Resources/ResidencyManager.h"
+
+#include <algorithm>
+
+#include "Logging.h"
+
+namespace process::game::resources {
+	
+	namespace {
+		//leave a core each for the update thread and the decode thread, which also works
+		std::size_t getDecodeWorkerCount() {
+			return std::max(std::thread::hardware_concurrency(), 2u) - 2u;
+		}
+	}
+	
+	ResidencyManager::ResidencyManager(
+		ResourceMasterStorage* resourceMasterStoragePointer,
+		resource::ResourceLoader* resourceLoaderPointer
+	)
+		: resourceMasterStoragePointer { resourceMasterStoragePointer }
+		, resourceLoaderPointer { resourceLoaderPointer }
+		, threadPool { getDecodeWorkerCount() } {
+	}
+	
+	ResidencyManager::~ResidencyManager() {
+		if( decodeThread.joinable() ) {
+			decodeThread.join();
+		}
+	}
+	
+	bool ResidencyManager::hasGroup(const std::wstring& groupID) {
+		return static_cast<bool>(resourceMasterStoragePointer->resourceGroupStorage.get(groupID));
+	}
+	
+	void ResidencyManager::prefetch(const std::wstring& groupID) {
+		if( isLoaded(groupID) ) {
+			return;
+		}
+		finishDecoding();
+		
+		const auto& fileNamePointer {
+			resourceMasterStoragePointer->resourceGroupStorage.get(groupID)
+		};
+		if( !fileNamePointer ) {
+			throw std::runtime_error { "Error no resource group declared for prefetch" };
+		}
+		
+		//creates every resource in the group now, so lookups never see half a group
+		resourceLoaderPointer->loadManifestEntryDeferred(
+			{ { L"manifest", *fileNamePointer } },
+			decodingTasks
+		);
+		
+		decodingGroupID = groupID;
+		decoding.store(true, std::memory_order_release);
+		decodeThread = std::thread {
+			[&] {
+				try {
+					threadPool.run(decodingTasks);
+				}
+				catch( ... ) {
+					decodingExceptionPointer = std::current_exception();
+				}
+				decodingTasks.clear();
+				decoding.store(false, std::memory_order_release);
+			}
+		};
+	}
+	
+	bool ResidencyManager::isResident(const std::wstring& groupID) {
+		if( decoding.load(std::memory_order_acquire) ) {
+			if( groupID == decodingGroupID ) {
+				return false;
+			}
+		}
+		else {
+			finishDecoding();
+		}
+		return isLoaded(groupID);
+	}
+	
+	void ResidencyManager::release(const std::wstring& groupID) {
+		if( !isLoaded(groupID) ) {
+			return;
+		}
+		//the decode thread may still be writing into the group
+		finishDecoding();
+		//anything still holding a resource's data keeps it alive
+		resourceMasterStoragePointer->manifestStorage.remove(groupID);
+		wasp::debug::log(L"released resource group " + groupID);
+	}
+	
+	void ResidencyManager::releaseAllExcept(const std::wstring& groupID) {
+		std::vector<std::wstring> groupIDs {};
+		resourceMasterStoragePointer->resourceGroupStorage.forEach(
+			[&](const auto& resourcePointer) {
+				if( resourcePointer->getID() != groupID ) {
+					groupIDs.push_back(resourcePointer->getID());
+				}
+			}
+		);
+		for( const std::wstring& toRelease : groupIDs ) {
+			release(toRelease);
+		}
+	}
+	
+	std::vector<ResidencyManager::GroupReport> ResidencyManager::makeReport() {
+		std::vector<GroupReport> groupReports {};
+		resourceMasterStoragePointer->resourceGroupStorage.forEach(
+			[&](const auto& resourcePointer) {
+				const std::wstring& groupID { resourcePointer->getID() };
+				GroupReport groupReport { groupID, isResident(groupID) };
+				if( groupReport.resident ) {
+					ManifestStorage& manifestStorage {
+						resourceMasterStoragePointer->manifestStorage
+					};
+					groupReport.entryCount = manifestStorage.get(groupID)->size();
+					groupReport.memoryUsage = manifestStorage.getMemoryUsage(groupID);
+				}
+				groupReports.push_back(std::move(groupReport));
+			}
+		);
+		std::sort(
+			groupReports.begin(),
+			groupReports.end(),
+			[](const GroupReport& left, const GroupReport& right) {
+				return left.groupID < right.groupID;
+			}
+		);
+		return groupReports;
+	}
+	
+	void ResidencyManager::logReport() {
+		for( const GroupReport& groupReport : makeReport() ) {
+			wasp::debug::log(
+				L"resource group " + groupReport.groupID
+				+ (groupReport.resident ? L": resident, " : L": released, ")
+				+ std::to_wstring(groupReport.entryCount) + L" entries, "
+				+ std::to_wstring(groupReport.memoryUsage / 1024) + L" KiB"
+			);
+		}
+	}
+	
+	bool ResidencyManager::isLoaded(const std::wstring& groupID) {
+		return static_cast<bool>(resourceMasterStoragePointer->manifestStorage.get(groupID));
+	}
+	
+	void ResidencyManager::finishDecoding() {
+		if( decodeThread.joinable() ) {
+			decodeThread.join();
+		}
+		if( decodingExceptionPointer ) {
+			std::exception_ptr exceptionPointer { decodingExceptionPointer };
+			decodingExceptionPointer = nullptr;
+			std::rethrow_exception(exceptionPointer);
+		}
+	}
+}
\ No newline at end of file
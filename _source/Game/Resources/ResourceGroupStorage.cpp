@@ -0,0 +1,36 @@
+#include "Game/Resources/ResourceGroupStorage.h"
+
+#include "File/FileUtil.h"
+
+namespace process::game::resources {
+	
+	namespace {
+		using ResourceBase = wasp::resource::ResourceBase;
+	}
+	
+	ResourceBase* ResourceGroupStorage::loadFromManifest(
+		const resource::ManifestOrigin& manifestOrigin,
+		const resource::ResourceLoader& resourceLoader
+	) {
+		
+		const std::wstring& fileName { manifestOrigin.manifestArguments[1] };
+		
+		const std::wstring& id { file::getFileName(fileName) };
+		if( resourceMap.find(id) != resourceMap.end() ) {
+			throw std::runtime_error { "Error loaded pre-existing id" };
+		}
+		
+		std::shared_ptr<ResourceType> resourceSharedPointer {
+			std::make_shared<ResourceType>(
+				id,
+				manifestOrigin,
+				std::make_shared<std::wstring>(fileName)
+			)
+		};
+		
+		resourceSharedPointer->setStoragePointer(this);
+		
+		resourceMap.insert({ id, resourceSharedPointer });
+		return resourceSharedPointer.get();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include "Game\Resources\ScriptCache.h"
+
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+
+#include "Logging.h"
+
+namespace process::game::resources {
+	
+	namespace {
+		constexpr std::uint32_t magic { 0x43534b44u };	//DKSC
+		constexpr std::uint32_t fileVersion { 1u };
+		
+		//magic, file version, ast image version, entry count
+		constexpr std::size_t headerWords { 4 };
+		//source hash low, source hash high, name offset, name length, image offset,
+		//image size; offsets are from the start of the file
+		constexpr std::size_t entryWords { 6 };
+		constexpr std::size_t wordSize { sizeof(std::uint32_t) };
+		
+		//64 bit FNV-1a
+		constexpr std::uint64_t fnvOffsetBasis { 14695981039346656037ull };
+		constexpr std::uint64_t fnvPrime { 1099511628211ull };
+		
+		std::size_t alignToWord(std::size_t size) {
+			return (size + wordSize - 1) / wordSize * wordSize;
+		}
+		
+		std::uint32_t readWord(const std::uint8_t* bytes, std::size_t wordIndex) {
+			std::uint32_t word;	//not initialized!
+			std::memcpy(&word, bytes + (wordIndex * wordSize), wordSize);
+			return word;
+		}
+		
+		void writeWord(
+			std::vector<std::uint8_t>& bytes,
+			std::size_t byteOffset,
+			std::uint32_t word
+		) {
+			std::memcpy(bytes.data() + byteOffset, &word, wordSize);
+		}
+	}
+	
+	ScriptCache::ScriptCache(const std::wstring& fileName)
+		: fileName { fileName }
+		, mappedFile { fileName } {
+		readMappedEntries();
+	}
+	
+	std::uint64_t ScriptCache::hashSource(std::string_view source) {
+		std::uint64_t hash { fnvOffsetBasis };
+		for( char c : source ) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= fnvPrime;
+		}
+		return hash;
+	}
+	
+	bool ScriptCache::tryRead(
+		const std::string& key,
+		std::uint64_t sourceHash,
+		darkness::AstNode& script
+	) {
+		//save waits for every read of the mapping to finish before it unmaps it
+		std::shared_lock mappingLock { mappingMutex };
+		auto found { mappedEntries.find(key) };
+		if( found == mappedEntries.end() || found->second.sourceHash != sourceHash ) {
+			std::lock_guard lock { mutex };
+			++missCount;
+			return false;
+		}
+		const Entry& entry { found->second };
+		try {
+			darkness::AstImageReader astImageReader {};
+			script = astImageReader.read(entry.imagePointer, entry.imageSize);
+		}
+		catch( const std::runtime_error& ) {
+			wasp::debug::log(std::string { "script cache entry unreadable: " } + key);
+			std::lock_guard lock { mutex };
+			++missCount;
+			return false;
+		}
+		std::lock_guard lock { mutex };
+		usedEntries.insert_or_assign(key, Entry { sourceHash, entry.imagePointer, entry.imageSize });
+		++hitCount;
+		return true;
+	}
+	
+	void ScriptCache::put(
+		const std::string& key,
+		std::uint64_t sourceHash,
+		const darkness::AstNode& script
+	) {
+		darkness::AstImageWriter astImageWriter {};
+		Entry newEntry { sourceHash };
+		newEntry.ownedImage = astImageWriter.write(script);
+		newEntry.imagePointer = newEntry.ownedImage.data();
+		newEntry.imageSize = newEntry.ownedImage.size();
+		
+		std::lock_guard lock { mutex };
+		usedEntries.insert_or_assign(key, std::move(newEntry));
+	}
+	
+	void ScriptCache::save() {
+		std::unique_lock mappingLock { mappingMutex };
+		std::lock_guard lock { mutex };
+		wasp::debug::log(
+			"script cache: " + std::to_string(hitCount) + " hit(s), "
+				+ std::to_string(missCount) + " miss(es)"
+		);
+		if( missCount == 0 && usedEntries.size() == mappedEntries.size() ) {
+			return;
+		}
+		
+		//lay out the directory, then the names, then the word aligned images
+		std::size_t namesOffset { (headerWords + (usedEntries.size() * entryWords)) * wordSize };
+		std::size_t namesSize {};
+		std::size_t imagesSize {};
+		for( const auto& [key, entry] : usedEntries ) {
+			namesSize += key.size();
+			imagesSize += alignToWord(entry.imageSize);
+		}
+		std::size_t imagesOffset { alignToWord(namesOffset + namesSize) };
+		std::vector<std::uint8_t> bytes(imagesOffset + imagesSize);
+		
+		writeWord(bytes, 0, magic);
+		writeWord(bytes, wordSize, fileVersion);
+		writeWord(bytes, 2 * wordSize, darkness::astimage::version);
+		writeWord(bytes, 3 * wordSize, static_cast<std::uint32_t>(usedEntries.size()));
+		
+		std::size_t entryOffset { headerWords * wordSize };
+		std::size_t nameOffset { namesOffset };
+		std::size_t imageOffset { imagesOffset };
+		for( const auto& [key, entry] : usedEntries ) {
+			writeWord(bytes, entryOffset, static_cast<std::uint32_t>(entry.sourceHash));
+			writeWord(
+				bytes,
+				entryOffset + wordSize,
+				static_cast<std::uint32_t>(entry.sourceHash >> 32)
+			);
+			writeWord(bytes, entryOffset + (2 * wordSize), static_cast<std::uint32_t>(nameOffset));
+			writeWord(bytes, entryOffset + (3 * wordSize), static_cast<std::uint32_t>(key.size()));
+			writeWord(bytes, entryOffset + (4 * wordSize), static_cast<std::uint32_t>(imageOffset));
+			writeWord(bytes, entryOffset + (5 * wordSize), static_cast<std::uint32_t>(entry.imageSize));
+			std::memcpy(bytes.data() + nameOffset, key.data(), key.size());
+			std::memcpy(bytes.data() + imageOffset, entry.imagePointer, entry.imageSize);
+			entryOffset += entryWords * wordSize;
+			nameOffset += key.size();
+			imageOffset += alignToWord(entry.imageSize);
+		}
+		
+		//images may point into the mapping, so only unmap once they are copied
+		mappedEntries.clear();
+		usedEntries.clear();
+		mappedFile.close();
+		
+		{
+			std::ofstream outStream {
+				std::filesystem::path { fileName },
+				std::ios::binary | std::ios::trunc
+			};
+			outStream.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+			if( outStream.fail() ) {
+				//the cache only saves time, so failing to write it is not an error
+				wasp::debug::log("failed to write script cache");
+			}
+		}
+		
+		//everything just written was used, so the next save only rewrites the file if
+		//a script misses or changes in the meantime
+		mappedFile.map(fileName);
+		readMappedEntries();
+		usedEntries = mappedEntries;
+		hitCount = 0;
+		missCount = 0;
+	}
+	
+	void ScriptCache::readMappedEntries() {
+		const std::uint8_t* bytes { mappedFile.data() };
+		std::size_t size { mappedFile.size() };
+		if( !bytes || size < headerWords * wordSize ) {
+			return;
+		}
+		if( readWord(bytes, 0) != magic
+			|| readWord(bytes, 1) != fileVersion
+			|| readWord(bytes, 2) != darkness::astimage::version
+		) {
+			wasp::debug::log("script cache out of date, ignoring");
+			return;
+		}
+		std::size_t entryCount { readWord(bytes, 3) };
+		if( entryCount > (size / wordSize - headerWords) / entryWords ) {
+			wasp::debug::log("script cache corrupt, ignoring");
+			return;
+		}
+		for( std::size_t i { 0 }; i < entryCount; ++i ) {
+			std::size_t entryWordIndex { headerWords + (i * entryWords) };
+			std::uint64_t sourceHash {
+				readWord(bytes, entryWordIndex)
+					| (static_cast<std::uint64_t>(readWord(bytes, entryWordIndex + 1)) << 32)
+			};
+			std::size_t nameOffset { readWord(bytes, entryWordIndex + 2) };
+			std::size_t nameLength { readWord(bytes, entryWordIndex + 3) };
+			std::size_t imageOffset { readWord(bytes, entryWordIndex + 4) };
+			std::size_t imageSize { readWord(bytes, entryWordIndex + 5) };
+			if( nameOffset > size || nameLength > size - nameOffset
+				|| imageOffset > size || imageSize > size - imageOffset
+				|| imageOffset % wordSize != 0
+			) {
+				wasp::debug::log("script cache corrupt, ignoring");
+				mappedEntries.clear();
+				return;
+			}
+			mappedEntries.insert_or_assign(
+				std::string { reinterpret_cast<const char*>(bytes + nameOffset), nameLength },
+				Entry { sourceHash, bytes + imageOffset, imageSize }
+			);
+		}
+	}
+}
\ No newline at end of file
@@ -1,14 +1,100 @@
 #include "Game/Resources/ScriptStorage.h"
 
 #include "File/FileUtil.h"
+#include "File/MappedFile.h"
 #include "StringUtil.h"
 
-#include <fstream>
+#include "Logging.h"
 
 namespace process::game::resources {
 	
 	namespace {
 		using ResourceBase = wasp::resource::ResourceBase;
+		
+		constexpr std::chrono::milliseconds scriptWatchInterval { 250 };
+		
+		//thrown when a script file cannot be opened, e.g. while an editor still holds it
+		struct ScriptFileUnavailable : std::runtime_error {
+			using std::runtime_error::runtime_error;
+		};
+	}
+	
+	void ScriptStorage::watchForChanges() {
+		if( fileWatcherPointer ) {
+			return;
+		}
+		fileWatcherPointer = std::make_unique<file::FileWatcher>(
+			std::vector<std::wstring> {},
+			scriptWatchInterval,
+			//runs on the watch thread
+			[this](const std::wstring& fileName) {
+				std::shared_ptr<Script> scriptPointer {};
+				try {
+					scriptPointer = std::make_shared<Script>(parseScriptFile(fileName));
+				}
+				catch( const ScriptFileUnavailable& ) {
+					//the watcher tries again next poll
+					throw;
+				}
+				catch( const std::runtime_error& runtimeError ) {
+					//keep the old script until the file parses
+					wasp::debug::log(
+						std::string { "failed to reload script: " } + runtimeError.what()
+					);
+					return;
+				}
+				std::lock_guard lock { reloadMutex };
+				pendingReloads.emplace_back(fileNameToIDMap.at(fileName), scriptPointer);
+			}
+		);
+		for( const auto& [id, resourcePointer] : resourceMap ) {
+			const resource::ResourceOriginVariant& origin { resourcePointer->getOrigin() };
+			watchScriptFile(
+				std::holds_alternative<resource::FileOrigin>(origin)
+					? std::get<resource::FileOrigin>(origin).fileName
+					: std::get<resource::ManifestOrigin>(origin).manifestArguments[1],
+				id
+			);
+		}
+	}
+	
+	void ScriptStorage::watchScriptFile(const std::wstring& fileName, const std::wstring& id) {
+		if( !fileWatcherPointer ) {
+			return;
+		}
+		{
+			std::lock_guard lock { reloadMutex };
+			fileNameToIDMap.insert_or_assign(fileName, id);
+		}
+		fileWatcherPointer->watch(fileName);
+	}
+	
+	std::vector<ScriptStorage::ReloadedScript> ScriptStorage::applyReloadedScripts() {
+		std::vector<std::pair<std::wstring, std::shared_ptr<Script>>> reloads {};
+		{
+			std::lock_guard lock { reloadMutex };
+			if( pendingReloads.empty() ) {
+				return {};
+			}
+			reloads.swap(pendingReloads);
+		}
+		
+		std::vector<ReloadedScript> reloadedScripts {};
+		for( auto& [id, scriptPointer] : reloads ) {
+			auto found { resourceMap.find(id) };
+			if( found == resourceMap.end() ) {
+				continue;
+			}
+			auto& resourcePointer { found->second };
+			reloadedScripts.push_back({
+				id,
+				resourcePointer->getDataPointerCopy(),
+				scriptPointer
+			});
+			resourcePointer->setData(std::move(scriptPointer));
+			wasp::debug::log(L"reloaded script " + id);
+		}
+		return reloadedScripts;
 	}
 	
 	void ScriptStorage::reload(const std::wstring& id) {
@@ -58,19 +144,26 @@ namespace process::game::resources {
 			throw std::runtime_error { "Error loaded pre-existing id" };
 		}
 		
+		std::shared_ptr<Script> scriptPointer { std::make_shared<Script>() };
+		resourceLoader.runOrDefer(
+			fileOrigin.fileName,
+			[this, scriptPointer, fileName { fileOrigin.fileName }] {
+				*scriptPointer = parseScriptFile(fileName);
+			}
+		);
+		
 		std::shared_ptr<ResourceType> resourceSharedPointer {
 			std::make_shared<ResourceType>(
 				id,
 				fileOrigin,
-				std::make_shared<Script>(
-					parseScriptFile(fileOrigin.fileName)
-				)
+				scriptPointer
 			)
 		};
 		
 		resourceSharedPointer->setStoragePointer(this);
 		
 		resourceMap.insert({ id, resourceSharedPointer });
+		watchScriptFile(fileOrigin.fileName, id);
 		return resourceSharedPointer.get();
 	}
 	
@@ -86,37 +179,55 @@ namespace process::game::resources {
 			throw std::runtime_error { "Error loaded pre-existing id" };
 		}
 		
+		std::shared_ptr<Script> scriptPointer { std::make_shared<Script>() };
+		resourceLoader.runOrDefer(
+			fileName,
+			[this, scriptPointer, fileName] {
+				*scriptPointer = parseScriptFile(fileName);
+			}
+		);
+		
 		std::shared_ptr<ResourceType> resourceSharedPointer {
 			std::make_shared<ResourceType>(
 				id,
 				manifestOrigin,
-				std::make_shared<Script>(
-					parseScriptFile(fileName)
-				)
+				scriptPointer
 			)
 		};
 		
 		resourceSharedPointer->setStoragePointer(this);
 		
 		resourceMap.insert({ id, resourceSharedPointer });
+		watchScriptFile(fileName, id);
 		return resourceSharedPointer.get();
 	}
 	
+	//only lexes and parses scripts whose source changed since the cache was written
 	ScriptStorage::Script ScriptStorage::parseScriptFile(const std::wstring& fileName) {
-		std::ifstream inStream { fileName };
-		if(inStream.fail()){
-			throw std::runtime_error{ "failed to open script file" };
+		file::MappedFile sourceFile{ fileName };
+		if(!sourceFile.isOpen()){
+			throw ScriptFileUnavailable{ "failed to open script file" };
+		}
+		std::string_view source{
+			reinterpret_cast<const char*>(sourceFile.data()),
+			sourceFile.size()
+		};
+		std::string key{ stringUtil::convertFromWideString(fileName) };
+		std::uint64_t sourceHash{ ScriptCache::hashSource(source) };
+		
+		Script script{};
+		if(scriptCache.tryRead(key, sourceHash, script)){
+			return script;
 		}
-		std::stringstream stringStream{};
-		stringStream << inStream.rdbuf();
-		inStream.close();
 		try {
-			return parser.parse(lexer.lex(stringStream.str()));
+			darkness::Lexer lexer{};
+			darkness::Parser parser{};
+			script = parser.parse(lexer.lex(source));
 		}
 		catch(const std::runtime_error& runtimeError){
-			throw std::runtime_error{
-				stringUtil::convertFromWideString(fileName) + runtimeError.what()
-			};
+			throw std::runtime_error{ key + runtimeError.what() };
 		}
+		scriptCache.put(key, sourceHash, script);
+		return script;
 	}
 }
\ No newline at end of file
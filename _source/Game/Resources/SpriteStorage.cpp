@@ -1,12 +1,42 @@
 #include "Game\Resources\SpriteStorage.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "File\FileUtil.h"
+#include "Graphics\AtlasPacker.h"
+#include "MainConfig.h"
+#include "Logging.h"
 
 namespace process::game::resources {
 	
 	namespace{
 		using ResourceBase = wasp::resource::ResourceBase;
 		using Sprite = graphics::Sprite;
+		using PixelDataBuffer = graphics::SpriteLoader::PixelDataBuffer;
+		
+		PixelDataBuffer makeEmptyPage(unsigned int width, unsigned int height){
+			std::size_t widthBytes{ width * graphics::SpriteLoader::atlasBytesPerPixel };
+			std::size_t sizeBytes{ widthBytes * height };
+			//zeroed, so padding is transparent
+			return { std::vector<byte>(sizeBytes), sizeBytes, widthBytes, height, width, height };
+		}
+		
+		void copyIntoPage(
+			const PixelDataBuffer& source,
+			PixelDataBuffer& page,
+			unsigned int x,
+			unsigned int y
+		){
+			std::size_t xBytes{ x * graphics::SpriteLoader::atlasBytesPerPixel };
+			for(unsigned int row{ 0 }; row < source.height; ++row){
+				std::memcpy(
+					page.buffer.data() + ((y + row) * page.widthBytes) + xBytes,
+					source.buffer.data() + (row * source.widthBytes),
+					source.widthBytes
+				);
+			}
+		}
 	}
 
 	void SpriteStorage::reload(const std::wstring& id) {
@@ -52,6 +82,16 @@ namespace process::game::resources {
 		}
 	}
 
+	std::size_t SpriteStorage::getMemoryUsage(const std::wstring& id) const {
+		const WicFrameAndSprite* dataPointer{ findData(id) };
+		if (!dataPointer || dataPointer->sprite.page >= 0) {
+			return 0;
+		}
+		//4 bytes per pixel
+		const Sprite& sprite{ dataPointer->sprite };
+		return static_cast<std::size_t>(sprite.width) * sprite.height * 4;
+	}
+
 	ResourceBase* SpriteStorage::loadFromFile(
 		const resource::FileOrigin& fileOrigin,
 		const resource::ResourceLoader& resourceLoader
@@ -133,11 +173,89 @@ namespace process::game::resources {
 	){
 		this->devicePointer = devicePointer;
 		throwIfCannotConstructD3DTextures();
+		loadD3DTexturesIntoAtlas();
+	}
+	
+	//packs every sprite into shared atlas pages so that draws rarely switch textures;
+	//sprites too large for a page get their own texture. Reloaded sprites also get
+	//their own texture, as the pages are immutable.
+	void SpriteStorage::loadD3DTexturesIntoAtlas() {
+		//sorted by id so that the packing is the same every run
+		std::vector<ResourceSharedPointer> resourceSharedPointers{};
 		forEach(
 			[&](const ResourceSharedPointer& resourceSharedPointer) {
-				loadD3DTexture(*resourceSharedPointer);
+				resourceSharedPointers.push_back(resourceSharedPointer);
 			}
 		);
+		std::sort(
+			resourceSharedPointers.begin(),
+			resourceSharedPointers.end(),
+			[](const ResourceSharedPointer& left, const ResourceSharedPointer& right) {
+				return left->getID() < right->getID();
+			}
+		);
+		
+		std::vector<PixelDataBuffer> pixelDataBuffers{};
+		std::vector<unsigned int> widths{};
+		std::vector<unsigned int> heights{};
+		for (const ResourceSharedPointer& resourceSharedPointer : resourceSharedPointers) {
+			pixelDataBuffers.push_back(spriteLoader.getAtlasPixelDataBuffer(
+				resourceSharedPointer->getDataPointerCopy()->wicFrame
+			));
+			widths.push_back(pixelDataBuffers.back().width);
+			heights.push_back(pixelDataBuffers.back().height);
+		}
+		
+		graphics::AtlasPacker atlasPacker{
+			config::atlasPageSize,
+			config::atlasPageSize,
+			config::atlasPadding
+		};
+		const auto placements{ atlasPacker.pack(widths, heights) };
+		
+		std::vector<PixelDataBuffer> pages{};
+		for (std::size_t i{ 0 }; i < atlasPacker.getPageCount(); ++i) {
+			pages.push_back(makeEmptyPage(
+				atlasPacker.getPageWidth(),
+				atlasPacker.getPageHeight()
+			));
+		}
+		for (std::size_t i{ 0 }; i < placements.size(); ++i) {
+			const auto& placement{ placements[i] };
+			if (placement.packed) {
+				copyIntoPage(pixelDataBuffers[i], pages[placement.page], placement.x, placement.y);
+			}
+		}
+		
+		std::vector<Sprite> pageSprites{};
+		for (const PixelDataBuffer& page : pages) {
+			pageSprites.push_back(spriteLoader.convertPixelDataBufferToSprite(
+				page,
+				graphics::SpriteLoader::atlasFormat,
+				devicePointer
+			));
+		}
+		
+		float pageWidth{ static_cast<float>(atlasPacker.getPageWidth()) };
+		float pageHeight{ static_cast<float>(atlasPacker.getPageHeight()) };
+		for (std::size_t i{ 0 }; i < placements.size(); ++i) {
+			const auto& placement{ placements[i] };
+			if (!placement.packed) {
+				loadD3DTexture(*resourceSharedPointers[i]);
+				continue;
+			}
+			Sprite& sprite{ resourceSharedPointers[i]->getDataPointerCopy()->sprite };
+			sprite.textureView = pageSprites[placement.page].textureView;
+			sprite.width = widths[i];
+			sprite.height = heights[i];
+			sprite.page = placement.page;
+			sprite.uLow = static_cast<float>(placement.x) / pageWidth;
+			sprite.vLow = static_cast<float>(placement.y) / pageHeight;
+			sprite.uHigh = static_cast<float>(placement.x + widths[i]) / pageWidth;
+			sprite.vHigh = static_cast<float>(placement.y + heights[i]) / pageHeight;
+		}
+		
+		wasp::debug::log(atlasPacker.makeOccupancyReport());
 	}
 
 	void SpriteStorage::loadD3DTexture(ResourceType& resource) {
@@ -6,8 +6,8 @@ namespace process::game {
 		window::GraphicsWrapper* graphicsWrapperPointer,
 		resources::SpriteStorage& spriteStorage
 	)
-		: renderSystem{ graphicsWrapperPointer }
-		, textRenderSystem{ graphicsWrapperPointer, spriteStorage }
+		: drawCommandSystem{ spriteStorage }
+		, renderSystem{ graphicsWrapperPointer }
 
 		#ifdef _DEBUG
 		, debugRenderSystem{ graphicsWrapperPointer }
@@ -16,11 +16,35 @@ namespace process::game {
 	}
 
 	void SceneRenderer::operator()(Scene& scene) {
-		renderSystem(scene);
-		textRenderSystem(scene);
+		//no interpolation, so always draw the present positions
+		drawCommandList.clear();
+		drawCommandSystem(scene, drawCommandList, ++tick);
+		renderSystem(drawCommandList, 0, 1.0f);
 
 		#ifdef _DEBUG
 		debugRenderSystem(scene);
 		#endif
 	}
-}
\ No newline at end of file
+
+	#pragma warning(suppress : 4068) //suppress unknown pragma
+	#pragma clang diagnostic push
+	#pragma warning(suppress : 4068) //suppress unknown pragma
+	#pragma clang diagnostic ignored "-Wshadow"
+	void SceneRenderer::extract(
+		Scene& scene,
+		graphics::DrawCommandList& drawCommandList,
+		std::uint64_t tick
+	) {
+		drawCommandSystem(scene, drawCommandList, tick);
+	}
+
+	void SceneRenderer::operator()(
+		const graphics::DrawCommandList& drawCommandList,
+		std::size_t sceneIndex,
+		float interpolation
+	) {
+		renderSystem(drawCommandList, sceneIndex, interpolation);
+	}
+	#pragma warning(suppress : 4068) //suppress unknown pragma
+	#pragma clang diagnostic pop
+}
@@ -5,6 +5,7 @@
 namespace process::game {
 	SceneUpdater::SceneUpdater(
 		resources::ResourceMasterStorage* resourceMasterStoragePointer,
+		resources::ResidencyManager* residencyManagerPointer,
 		wasp::input::IKeyInputTable* keyInputTablePointer,
 		wasp::channel::ChannelSet* globalChannelSetPointer
 	)
@@ -17,7 +18,7 @@ namespace process::game {
 		, menuNavigationSystem{ globalChannelSetPointer }
 		, buttonSpriteSystem{ &(resourceMasterStoragePointer->spriteStorage) }
 		, gameBuilderSystem { globalChannelSetPointer }
-		, loadSystem{ globalChannelSetPointer }
+		, loadSystem{ globalChannelSetPointer, residencyManagerPointer }
 		, dialogueSystem{ 
 			globalChannelSetPointer,
 			&(resourceMasterStoragePointer->spriteStorage),
@@ -52,6 +53,7 @@ namespace process::game {
 		scriptSystem(scene);
 		playerMovementSystem(scene);
 		velocitySystem(scene);
+		spatialIndexSystem(scene);
 		inboundSystem(scene);
 		collisionDetectorSystem(scene);
 		collisionHandlerSystem(scene);
@@ -74,4 +76,10 @@ namespace process::game {
 		gameOverSystem(scene);
 		creditsSystem(scene);
 	}
+	
+	void SceneUpdater::reloadScripts(
+		const std::vector<resources::ScriptStorage::ReloadedScript>& reloadedScripts
+	) {
+		scriptSystem.reloadScripts(reloadedScripts);
+	}
 }
\ No newline at end of file
@@ -15,13 +15,7 @@ namespace process::game::systems {
 		std::vector<EntityHandle> componentsToRemove{};
 
 		//get the group iterator for AnimationList
-		static const Topic<Group*> groupPointerStorageTopic{};
-		auto groupPointer{
-			getGroupPointer<AnimationList>(
-				scene,
-				groupPointerStorageTopic
-			)
-		};
+		auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
 		auto groupIterator{ groupPointer->groupIterator<AnimationList>() };
 
 		auto& dataStorage{ scene.getDataStorage() };
@@ -81,8 +75,9 @@ namespace process::game::systems {
 
 		if (animationList.animations.size() > 1) {
 			if (dataStorage.containsComponent<Velocity>(entityHandle)) {
+				//read through const so as not to count as a change
 				const Velocity& velocity{
-					dataStorage.getComponent<Velocity>(entityHandle)
+					std::as_const(dataStorage).getComponent<Velocity>(entityHandle)
 				};
 				float velocityX{ static_cast<wasp::math::Vector2>(velocity).x };
 				if (velocityX < -velocityEpsilon) {
@@ -12,8 +12,7 @@ namespace process::game::systems{
 	
 	void ClearSystem::handleClear(Scene& scene){
 		//get the group iterator for ClearMarker
-		static const Topic<Group*> groupPointerStorageTopic {};
-		auto groupPointer {	getGroupPointer<ClearMarker>(scene, groupPointerStorageTopic) };
+		auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
 		auto groupIterator { groupPointer->groupIterator<ClearMarker>() };
 		
 		auto& deathsChannel{ scene.getChannel(SceneTopics::deaths) };
@@ -7,7 +7,6 @@
 namespace process::game::systems {
 
 	namespace {
-		using Group = wasp::ecs::component::Group;
 		using EntityID = wasp::ecs::entity::EntityID;
 		using EntityHandle = wasp::ecs::entity::EntityHandle;
 		
@@ -24,18 +23,14 @@ namespace process::game::systems {
 
 			//get the group iterator for Position, Hitbox, CollidableMarker, and our
 			//source type
-			static const Topic<Group*> sourceGroupPointerStorageTopic{};
-			auto sourceGroupPointer{
-				getGroupPointer<
-					Position,
-					Hitbox,
-					CollidableMarker,
-					typename CollisionType::Source
-				>(
-					scene,
-					sourceGroupPointerStorageTopic
-				)
-			};
+			//one query per collision type, shared by every scene
+			static Query<
+				Position,
+				Hitbox,
+				CollidableMarker,
+				typename CollisionType::Source
+			> sourceGroupQuery{};
+			auto sourceGroupPointer{ sourceGroupQuery.getGroupPointer(dataStorage) };
 			auto sourceGroupIterator{ 
 				sourceGroupPointer->groupIterator<Position, Hitbox>() 
 			};
@@ -56,18 +51,13 @@ namespace process::game::systems {
 
 			//get the group iterator for Position, Hitbox, CollidableMarker, and our
 			//target type
-			static const Topic<Group*> targetGroupPointerStorageTopic{};
-			auto targetGroupPointer{
-				getGroupPointer<
-					Position,
-					Hitbox,
-					CollidableMarker,
-					typename CollisionType::Target
-				>(
-					scene,
-					targetGroupPointerStorageTopic
-				)
-			};
+			static Query<
+				Position,
+				Hitbox,
+				CollidableMarker,
+				typename CollisionType::Target
+			> targetGroupQuery{};
+			auto targetGroupPointer{ targetGroupQuery.getGroupPointer(dataStorage) };
 			auto targetGroupIterator{
 				targetGroupPointer->groupIterator<Position, Hitbox>()
 			};
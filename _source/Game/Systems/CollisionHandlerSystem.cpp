@@ -15,22 +15,69 @@ namespace process::game::systems {
 		//this system is responsible for clearing the playerHits channel
 		scene.getChannel(SceneTopics::playerHits).clear();
 
+		++currentPass;
 		handleCollisions<PlayerCollisions>(scene);
 		handleCollisions<EnemyCollisions>(scene);
 		handleCollisions<BulletCollisions>(scene);
 		handleCollisions<PickupCollisions>(scene);
 		handleCollisions<SpecialCollisions>(scene);
+		applyEntityStates(scene);
+	}
+
+	CollisionHandlerSystem::EntityState& CollisionHandlerSystem::getEntityState(
+		const EntityHandle& entityHandle
+	) {
+		EntityState& entityState{ entityStates[entityHandle.entityID] };
+		if (entityState.pass != currentPass) {
+			entityState = EntityState{};
+			entityState.pass = currentPass;
+			entityState.handle = entityHandle;
+			touchedEntityIDs.push_back(entityHandle.entityID);
+		}
+		return entityState;
+	}
+
+	void CollisionHandlerSystem::handleCollisionCommand(
+		Scene& scene,
+		EntityState& entityState,
+		CollisionCommands command,
+		const EntityHandle& collidedHandle
+	) {
+		switch (command) {
+			case CollisionCommands::death:
+				entityState.isDead = true;
+				break;
+			case CollisionCommands::damage:
+				handleDamageCommand(scene, entityState, collidedHandle);
+				break;
+			case CollisionCommands::removeCollisionType:
+				handleRemoveCollisionTypeCommand(entityState);
+				break;
+			case CollisionCommands::player:
+				entityState.isPlayerHit = true;
+				break;
+			case CollisionCommands::pickup:
+				handlePickupCommand(scene, entityState, collidedHandle);
+				break;
+			case CollisionCommands::none:
+				//do nothing
+				break;
+			default:
+				throw std::runtime_error{
+					"default case reached in collision handler system"
+				};
+		}
 	}
 
 	void CollisionHandlerSystem::handlePickupCommand(
 		Scene& scene,
-		const EntityHandle& pickupHandle,
+		EntityState& pickupState,
 		const EntityHandle& collidedHandle
 	) {
 		auto& dataStorage{ scene.getDataStorage() };
 
 		auto& playerData{ dataStorage.getComponent<PlayerData>(collidedHandle) };
-		auto& pickupType{ dataStorage.getComponent<PickupType>(pickupHandle).type };
+		auto& pickupType{ dataStorage.getComponent<PickupType>(pickupState.handle).type };
 		switch (pickupType) {
 			case PickupType::Types::life:
 				if (playerData.lives < config::maxLives) {
@@ -61,46 +108,70 @@ namespace process::game::systems {
 		}
 
 		//kill the pickup
-		handleDeathCommand(scene, pickupHandle);
-	}
-
-	void CollisionHandlerSystem::handlePlayerCommand(
-		Scene& scene,
-		const EntityHandle& playerHandle
-	) {
-		scene.getChannel(SceneTopics::playerHits).addMessage(playerHandle);
+		pickupState.isDead = true;
 	}
 
 	void CollisionHandlerSystem::handleDamageCommand(
 		Scene& scene,
-		const EntityHandle& entityHandle,
+		EntityState& entityState,
 		const EntityHandle& collidedHandle
 	) {
-		//check to see if this entity has health and the other entity has damage
-		auto& dataStorage{ scene.getDataStorage() };
-		if (dataStorage.containsComponent<Health>(entityHandle)
-			&& dataStorage.containsComponent<Damage>(collidedHandle))
-		{
-			//if so, subtract damage from health
-			auto& health{ dataStorage.getComponent<Health>(entityHandle) };
-			if (health.value > 0) {
-				const auto& damage{
-					dataStorage.getComponent<Damage>(collidedHandle)
-				};
-				health.value -= damage.value;
-				//if health <= 0, treat it as an entity death
-				if (health.value <= 0) {
-					handleDeathCommand(scene, entityHandle);
-				}
+		//look up how much damage the other entity deals, once per tick
+		EntityState& collidedState{ getEntityState(collidedHandle) };
+		if (!collidedState.isDamageKnown) {
+			collidedState.isDamageKnown = true;
+			auto& dataStorage{ scene.getDataStorage() };
+			if (dataStorage.containsComponent<Damage>(collidedHandle)) {
+				collidedState.damage =
+					dataStorage.getComponent<Damage>(collidedHandle).value;
 			}
 		}
+		//whether this entity has health is checked when the damage is applied
+		if (collidedState.damage) {
+			entityState.damageTaken += *collidedState.damage;
+			entityState.isDamaged = true;
+		}
 	}
 
-	//publish a death message
-	void CollisionHandlerSystem::handleDeathCommand(
-		Scene& scene,
-		const EntityHandle& entityHandle
+	//later collisions this tick act as though the collision type is already gone
+	void CollisionHandlerSystem::handleRemoveCollisionTypeCommand(
+		EntityState& entityState
 	) {
-		scene.getChannel(SceneTopics::deaths).addMessage(entityHandle);
+		collisionTypeRemovals.push_back(entityState.handle);
+		if (entityState.sourceCommand) {
+			entityState.sourceCommand.reset();
+		}
+		else {
+			entityState.targetCommand.reset();
+		}
+	}
+
+	void CollisionHandlerSystem::applyEntityStates(Scene& scene) {
+		auto& dataStorage{ scene.getDataStorage() };
+		for (EntityID entityID : touchedEntityIDs) {
+			EntityState& entityState{ entityStates[entityID] };
+			const EntityHandle& entityHandle{ entityState.handle };
+
+			//subtract all damage at once; if health <= 0, treat it as an entity death
+			if (entityState.isDamaged
+				&& dataStorage.containsComponent<Health>(entityHandle))
+			{
+				auto& health{ dataStorage.getComponent<Health>(entityHandle) };
+				if (health.value > 0) {
+					health.value -= entityState.damageTaken;
+					if (health.value <= 0) {
+						entityState.isDead = true;
+					}
+				}
+			}
+			//publish one death message per entity
+			if (entityState.isDead) {
+				scene.getChannel(SceneTopics::deaths).addMessage(entityHandle);
+			}
+			if (entityState.isPlayerHit) {
+				scene.getChannel(SceneTopics::playerHits).addMessage(entityHandle);
+			}
+		}
+		touchedEntityIDs.clear();
 	}
 }
\ No newline at end of file
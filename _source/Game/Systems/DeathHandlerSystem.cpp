@@ -118,9 +118,14 @@ namespace process::game::systems {
 			DeathSpawn& deathSpawn{
 				dataStorage.getComponent<DeathSpawn>(entityHandle)
 			};
-			auto scriptList{ deathSpawn.scriptList };
+			//the entity is about to go, so its spawns are moved out instead of copied;
+			//building the ghost below still copies the list into the new entity
+			ScriptList scriptList{
+				removeEntity ? std::move(deathSpawn.scriptList) : deathSpawn.scriptList
+			};
 			scriptList.push_back(ghostScriptContainer);
 			//add a ghost with the death spawn program list and possibly position
+			EntityHandle ghostHandle{};
 			if (dataStorage.containsComponent<Position>(entityHandle)) {
 				Position& position{
 					dataStorage.getComponent<Position>(entityHandle)
@@ -131,13 +136,17 @@ namespace process::game::systems {
 						scriptList
 					)
 				};
-				dataStorage.addEntity(ghostTuple.package());
+				ghostHandle = dataStorage.addEntity(ghostTuple.package());
 			}
 			else {
 				auto ghostTuple{ 
 					EntityBuilder::makeEntity(scriptList)
 				};
-				dataStorage.addEntity(ghostTuple.package());
+				ghostHandle = dataStorage.addEntity(ghostTuple.package());
+			}
+			//the ghost takes over the dead entity's place under its owner
+			if (const auto ownerHandle{ dataStorage.getParent(entityHandle) }) {
+				dataStorage.setParent(ghostHandle, *ownerHandle);
 			}
 		}
 		if (removeEntity) {
@@ -7,9 +7,8 @@ namespace process::game::systems {
         constexpr float leftX{ 35.0f };
         constexpr float rightX{ 280.0f };
 
+        //dialogue text is shaped to wrap at config::dialogueTextWidth past this
         constexpr wasp::math::Point2 textPos{ 70.0f, 172.0f };
-
-        constexpr int textRightBound{ 250 };
     }
 
 	DialogueSystem::DialogueSystem(
@@ -48,7 +47,12 @@ namespace process::game::systems {
 
             }
             std::wstring& dialogueID{ startDialogueChannel.getMessages()[0] };
-            Dialogue& dialogue{ *dialogueStoragePointer->get(dialogueID) };
+            std::shared_ptr<const Dialogue> dialoguePointer{
+                dialogueStoragePointer->get(dialogueID)
+            };
+            if (!dialoguePointer) {
+                throw std::runtime_error{ "dialogue not loaded!" };
+            }
             startDialogueChannel.clear();
 
             //create entities
@@ -73,7 +77,7 @@ namespace process::game::systems {
             );
 
             SceneData sceneData{
-                dialogue,
+                std::move(dialoguePointer),
                 0,
                 std::move(spriteHandles)
             };
@@ -87,9 +91,11 @@ namespace process::game::systems {
 	}
 
     void DialogueSystem::advanceDialogue(Scene& scene, SceneData& sceneData) {
-        auto& [dialogue, dialoguePos, spriteHandles] = sceneData;
-        while (dialoguePos < dialogue.size()) {
-            if (executeCommand(scene, spriteHandles, dialogue[dialoguePos])) {
+        auto& [dialoguePointer, dialoguePos, spriteHandles] = sceneData;
+        const Dialogue& dialogue{ *dialoguePointer };
+        while (dialoguePos < dialogue.commands.size()) {
+            const DialogueCommand& dialogueCommand{ dialogue.commands[dialoguePos] };
+            if (executeCommand(scene, spriteHandles, dialogue, dialogueCommand)) {
                 ++dialoguePos;
             }
             else {
@@ -103,20 +109,29 @@ namespace process::game::systems {
     bool DialogueSystem::executeCommand(
         Scene& scene,
         std::array<EntityHandle, 3>& spriteHandles,
-        DialogueCommand& dialogueCommand
+        const Dialogue& dialogue,
+        const DialogueCommand& dialogueCommand
     ) {
         switch (dialogueCommand.command) {
             case DialogueCommand::Commands::setLeftImage:
-                setImage(scene, spriteHandles[0], dialogueCommand.data);
+                setImage(
+                    scene,
+                    spriteHandles[0],
+                    std::wstring{ dialogue.getData(dialogueCommand) }
+                );
                 return true;
             case DialogueCommand::Commands::setRightImage:
-                setImage(scene, spriteHandles[1], dialogueCommand.data);
+                setImage(
+                    scene,
+                    spriteHandles[1],
+                    std::wstring{ dialogue.getData(dialogueCommand) }
+                );
                 return true;
             case DialogueCommand::Commands::setText:
-                setText(scene, spriteHandles[2], dialogueCommand.data);
+                setText(scene, spriteHandles[2], dialogue, dialogueCommand);
                 return true;
             case DialogueCommand::Commands::setTrack:
-                setTrack(dialogueCommand.data);
+                setTrack(std::wstring{ dialogue.getData(dialogueCommand) });
                 return true;
             case DialogueCommand::Commands::stop:
                 return false;
@@ -146,12 +161,17 @@ namespace process::game::systems {
     void DialogueSystem::setText(
         Scene& scene,
         EntityHandle& entityHandle,
-        const std::wstring& text
+        const Dialogue& dialogue,
+        const DialogueCommand& dialogueCommand
     ) {
         auto& dataStorage{ scene.getDataStorage() };
         dataStorage.setComponent<TextInstruction>({
             entityHandle,
-            { text, textRightBound }
+            {
+                dialogue.getGlyphs(dialogueCommand),
+                dialogueCommand.glyphCount,
+                dialogue.getTextID(dialogueCommand)
+            }
         });
     }
 
@@ -0,0 +1,241 @@
+#include "Game/Systems/DrawCommandSystem.h"
+
+#include "Logging.h"
+
+namespace process::game::systems {
+
+	static_assert(
+		DrawCommand::depthRange == graphics::SpriteDrawInstruction::maxDepth
+			- graphics::SpriteDrawInstruction::minDepth + 1
+	);
+
+	void DrawCommandSystem::operator()(
+		Scene& scene,
+		DrawCommandList& drawCommandList,
+		std::uint64_t tick
+	) {
+		//indexed by entity id; cleared along with the rest of the scene on refresh
+		static const Topic<PastPosition> pastPositionStorageTopic{};
+		//likewise indexed by entity id
+		static const Topic<GlyphRun> glyphRunStorageTopic{};
+
+		auto& dataStorage{ scene.getDataStorage() };
+		auto spriteGroupPointer{ spriteGroupQuery.getGroupPointer(dataStorage) };
+		auto textGroupPointer{ textGroupQuery.getGroupPointer(dataStorage) };
+		auto& pastPositions{ scene.getChannel(pastPositionStorageTopic).getMessages() };
+		auto& glyphRuns{ scene.getChannel(glyphRunStorageTopic).getMessages() };
+
+		//extract all sprites
+		auto spriteGroupIterator{
+			spriteGroupPointer->groupIterator<Position, SpriteInstruction>()
+		};
+		while (spriteGroupIterator.isValid()) {
+			const auto [position, spriteInstruction] = *spriteGroupIterator;
+			auto entityID = spriteGroupIterator.getEntityID();
+			DrawCommand drawCommand{ makeDrawCommand(
+				updatePastPosition(pastPositions, dataStorage, entityID, position, tick),
+				spriteInstruction
+			) };
+			if (dataStorage.containsComponent<SubImage>(entityID)) {
+				const auto& subImage{ dataStorage.getComponent<SubImage>(entityID) };
+				drawCommand.drawType = DrawCommand::DrawType::subSprite;
+				drawCommand.rectX = subImage.x;
+				drawCommand.rectY = subImage.y;
+				drawCommand.rectWidth = subImage.width;
+				drawCommand.rectHeight = subImage.height;
+			}
+			else if (dataStorage.containsComponent<TilingInstruction>(entityID)) {
+				const auto& tilingInstruction{
+					dataStorage.getComponent<TilingInstruction>(entityID)
+				};
+				drawCommand.drawType = DrawCommand::DrawType::tileSprite;
+				drawCommand.rectX = tilingInstruction.drawRectangle.x;
+				drawCommand.rectY = tilingInstruction.drawRectangle.y;
+				drawCommand.rectWidth = tilingInstruction.drawRectangle.width;
+				drawCommand.rectHeight = tilingInstruction.drawRectangle.height;
+				drawCommand.pixelOffsetX = tilingInstruction.pixelOffset.x;
+				drawCommand.pixelOffsetY = tilingInstruction.pixelOffset.y;
+			}
+			drawCommandList.add(drawCommand);
+			++spriteGroupIterator;
+		}
+
+		//extract all text, one command per glyph
+		auto textGroupIterator{
+			textGroupPointer->groupIterator<Position, TextInstruction>()
+		};
+		while (textGroupIterator.isValid()) {
+			const auto& [position, textInstruction] = *textGroupIterator;
+			auto entityID = textGroupIterator.getEntityID();
+			addText(
+				drawCommandList,
+				updatePastPosition(pastPositions, dataStorage, entityID, position, tick),
+				textInstruction,
+				getGlyphRun(glyphRuns, dataStorage, entityID)
+			);
+			++textGroupIterator;
+		}
+
+		drawCommandList.endScene();
+	}
+
+	//helper functions
+
+	void DrawCommandSystem::addText(
+		DrawCommandList& drawCommandList,
+		const PastPosition& positions,
+		const TextInstruction& textInstruction,
+		GlyphRun& glyphRun
+	) const {
+		if(textInstruction.glyphCount == 0){
+			return;
+		}
+		const int startX{ static_cast<int>(positions.position.x) };
+		const int startY{ static_cast<int>(positions.position.y) };
+
+		if(glyphRun.symbolMapID != symbolMapID
+			|| glyphRun.textID != textInstruction.textID)
+		{
+			glyphRun.symbolMapID = symbolMapID;
+			glyphRun.textID = textInstruction.textID;
+			layOutGlyphRun(glyphRun, textInstruction);
+		}
+
+		//glyphs move with the text, so they share its displacement since the last tick
+		float pastDeltaX{ positions.pastPosition.x - positions.position.x };
+		float pastDeltaY{ positions.pastPosition.y - positions.position.y };
+		for(const DrawCommand& glyph : glyphRun.glyphs){
+			DrawCommand drawCommand{ glyph };
+			drawCommand.x += static_cast<float>(startX);
+			drawCommand.y += static_cast<float>(startY);
+			drawCommand.pastX = drawCommand.x + pastDeltaX;
+			drawCommand.pastY = drawCommand.y + pastDeltaY;
+			drawCommandList.add(drawCommand);
+		}
+	}
+
+	//places each shaped glyph in its cell, measured from the origin
+	void DrawCommandSystem::layOutGlyphRun(
+		GlyphRun& glyphRun,
+		const TextInstruction& textInstruction
+	) const {
+		glyphRun.glyphs.clear();
+		glyphRun.glyphs.reserve(textInstruction.glyphCount);
+		int horizontalSpacing = symbolMap.getHorizontalSpacing();
+		int verticalSpacing = symbolMap.getVerticalSpacing();
+		PastPosition glyphPositions{};
+		for(std::uint32_t i{ 0 }; i < textInstruction.glyphCount; ++i){
+			const auto& shapedGlyph{ textInstruction.glyphs[i] };
+			glyphPositions.position.x
+				= static_cast<float>(shapedGlyph.column * horizontalSpacing);
+			glyphPositions.position.y
+				= static_cast<float>(shapedGlyph.row * verticalSpacing);
+			glyphRun.glyphs.push_back(
+				makeDrawCommand(glyphPositions, symbolMap.get(shapedGlyph.symbol))
+			);
+		}
+	}
+
+	DrawCommandSystem::DrawCommand DrawCommandSystem::makeDrawCommand(
+		const PastPosition& positions,
+		const graphics::SpriteDrawInstruction& spriteDrawInstruction
+	) {
+		const auto& sprite{ spriteDrawInstruction.getSprite() };
+		return {
+			DrawCommand::DrawType::sprite,
+			spriteDrawInstruction.getDepth(),
+			sprite.textureView.Get(),
+			sprite.width,
+			sprite.height,
+			positions.pastPosition.x,
+			positions.pastPosition.y,
+			positions.position.x,
+			positions.position.y,
+			spriteDrawInstruction.getOffset().x,
+			spriteDrawInstruction.getOffset().y,
+			spriteDrawInstruction.getRotation().getAngle(),
+			spriteDrawInstruction.getScale(),
+			0.0f, 0.0f, 0.0f, 0.0f,		//rect
+			0.0f, 0.0f,					//pixel offset
+			sprite.uLow,
+			sprite.vLow,
+			sprite.uHigh,
+			sprite.vHigh
+		};
+	}
+
+	//VelocitySystem steps the past position up to the present every update, so the past
+	//position used for interpolation is instead the one recorded in the previous tick
+	const DrawCommandSystem::PastPosition& DrawCommandSystem::updatePastPosition(
+		std::vector<PastPosition>& pastPositions,
+		const wasp::ecs::DataStorage& dataStorage,
+		EntityID entityID,
+		const Point2& position,
+		std::uint64_t tick
+	) {
+		if (entityID >= pastPositions.size()) {
+			pastPositions.resize(entityID + 1);
+		}
+		auto& pastPosition{ pastPositions[entityID] };
+		int generation{ dataStorage.makeHandle(entityID).generation };
+		bool sameEntity{ pastPosition.generation == generation };
+
+		//already recorded this tick (entity has both a sprite and text)
+		if (sameEntity && pastPosition.tick == tick) {
+			return pastPosition;
+		}
+
+		//only interpolate if the entity was also extracted in the previous tick
+		Point2 past{ position };
+		if (sameEntity && pastPosition.tick + 1 == tick) {
+			past = pastPosition.position;
+		}
+		pastPosition = { generation, tick, past, position };
+		return pastPosition;
+	}
+
+	DrawCommandSystem::GlyphRun& DrawCommandSystem::getGlyphRun(
+		std::vector<GlyphRun>& glyphRuns,
+		const wasp::ecs::DataStorage& dataStorage,
+		EntityID entityID
+	) {
+		if (entityID >= glyphRuns.size()) {
+			glyphRuns.resize(entityID + 1);
+		}
+		auto& glyphRun{ glyphRuns[entityID] };
+		int generation{ dataStorage.makeHandle(entityID).generation };
+		if (glyphRun.generation != generation) {
+			glyphRun = GlyphRun{};
+			glyphRun.generation = generation;
+		}
+		return glyphRun;
+	}
+
+	std::uint32_t DrawCommandSystem::makeSymbolMapID() {
+		static std::uint32_t nextID{ 1 };	//only built on the main thread
+		return nextID++;
+	}
+
+	graphics::SymbolMap<wchar_t> DrawCommandSystem::loadSymbolMap(
+		resources::SpriteStorage& spriteStorage
+	) {
+		using ResourceSharedPointer = resources::SpriteStorage::ResourceSharedPointer;
+
+		graphics::SymbolMap<wchar_t> symbolMap{
+			config::textHorizontalSpacing,
+			config::textVerticalSpacing
+		};
+		spriteStorage.forEach([&](const ResourceSharedPointer& resourceSharedPointer){
+			const std::wstring& spriteID{ resourceSharedPointer->getID() };
+			//if the id is a single char, it is a symbol. To load special symbols which may
+			//be reserved by the filesystem, use a manifest
+			if(spriteID.length() == 1){
+				wchar_t symbolID{ spriteID.at(0) };
+				const auto& sprite{ resourceSharedPointer->getDataPointerCopy()->sprite };
+				constexpr int textDepth{ config::foregroundDepth + 500 };
+				symbolMap.put(symbolID, { sprite, textDepth });
+			}
+		});
+		return symbolMap;
+	}
+}
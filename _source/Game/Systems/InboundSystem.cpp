@@ -28,13 +28,7 @@ namespace process::game::systems {
 
 	void InboundSystem::operator()(Scene& scene) {
 		//get the group iterator for Position and Inbound
-		static const Topic<Group*> groupPointerStorageTopic{};
-		auto groupPointer{
-			getGroupPointer<Position, Inbound>(
-				scene,
-				groupPointerStorageTopic
-			)
-		};
+		auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
 		auto groupIterator{
 			groupPointer->groupIterator<Position, Inbound>()
 		};
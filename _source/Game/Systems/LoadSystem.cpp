@@ -6,8 +6,12 @@ namespace process::game::systems {
 		constexpr int waitTime{ 75 };
 	}
 
-	LoadSystem::LoadSystem(wasp::channel::ChannelSet* globalChannelSetPointer)
-		: globalChannelSetPointer{ globalChannelSetPointer } {
+	LoadSystem::LoadSystem(
+		wasp::channel::ChannelSet* globalChannelSetPointer,
+		resources::ResidencyManager* residencyManagerPointer
+	)
+		: globalChannelSetPointer{ globalChannelSetPointer }
+		, residencyManagerPointer{ residencyManagerPointer } {
 	}
 
 	void LoadSystem::operator()(Scene& scene) {
@@ -17,22 +21,39 @@ namespace process::game::systems {
 			static const Topic<int> timerTopic{};
 			auto& timerChannel{ scene.getChannel(timerTopic) };
 
+			const std::wstring& groupID{ getStageGroupID() };
+			bool hasGroup{ residencyManagerPointer->hasGroup(groupID) };
+
 			//if there is already a timer, handle it
 			if (timerChannel.hasMessages()) {
 				int& timer{ timerChannel.getMessages()[0] };
 
-				if (timer <= 0) {
+				//hold the load screen until the stage's resources are in
+				if (timer <= 0 && (!hasGroup || residencyManagerPointer->isResident(groupID))) {
 					globalChannelSetPointer->getChannel(GlobalTopics::sceneExitTo)
 						.addMessage(SceneNames::game);
 					timerChannel.clear();
+					residencyManagerPointer->logReport();
 				}
 				--timer;
 			}
 
-			//otherwise, start a timer
+			//otherwise, start a timer and start loading the stage
 			else {
 				timerChannel.addMessage(waitTime);
+				if (hasGroup) {
+					//safe while the render thread runs, see ResidencyManager::release
+					residencyManagerPointer->releaseAllExcept(groupID);
+					residencyManagerPointer->prefetch(groupID);
+				}
 			}
 		}
 	}
+
+	std::wstring LoadSystem::getStageGroupID() {
+		const auto& gameState{
+			globalChannelSetPointer->getChannel(GlobalTopics::gameState).getMessages()[0]
+		};
+		return L"stage" + std::to_wstring(gameState.stage);
+	}
 }
\ No newline at end of file
@@ -6,13 +6,7 @@ namespace process::game::systems {
 
     void OutboundSystem::operator()(Scene& scene) {
         //get the group iterator for Position and Outbound
-        static const Topic<Group*> groupPointerStorageTopic{};
-        auto groupPointer{
-            getGroupPointer<Position, Outbound>(
-                scene,
-                groupPointerStorageTopic
-            )
-        };
+        auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
         auto groupIterator{ groupPointer->groupIterator<Position, Outbound>() };
 
         auto& dataStorage{ scene.getDataStorage() };
@@ -24,13 +24,7 @@ namespace process::game::systems {
 
 	void OverlaySystem::operator()(Scene& scene) {
         //get the group iterator for PlayerData
-        static const Topic<wasp::ecs::component::Group*> groupPointerStorageTopic{};
-        auto groupPointer{
-            getGroupPointer<PlayerData>(
-                scene,
-                groupPointerStorageTopic
-            )
-        };
+        auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
         auto groupIterator{ groupPointer->groupIterator<PlayerData>() };
 
         //update all player states
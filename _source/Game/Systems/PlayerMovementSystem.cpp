@@ -49,14 +49,7 @@ namespace process::game::systems {
             if (twoFramePlayerInputData != twoFramePlayerInputData.getPast()) {
                 Vector2 velocity = calculateVelocity(twoFramePlayerInputData);
 
-                static const Topic<wasp::ecs::component::Group*> groupPointerStorageTopic{};
-
-                auto groupPointer{
-                    getGroupPointer<PlayerData, Velocity>(
-                        scene, 
-                        groupPointerStorageTopic
-                    )
-                };
+                auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
 
                 auto groupIterator{ 
                     groupPointer->groupIterator<PlayerData, Velocity>() 
@@ -70,6 +63,10 @@ namespace process::game::systems {
                     else {
                         playerVelocity = Velocity{};
                     }
+                    //writes through group iterators are not tracked on their own
+                    scene.getDataStorage().markChanged<Velocity>(
+                        groupIterator.getEntityID()
+                    );
                     ++groupIterator;
                 }
             }
@@ -3,7 +3,14 @@
 namespace process::game::systems {
 	
 	PlayerShotSystem::PlayerShotSystem(resources::ScriptStorage* scriptStoragePointer)
-		: scriptStoragePointer{ scriptStoragePointer } {
+		: shotAScriptContainer{
+			scriptStoragePointer->get(L"shotA"),
+			std::string{ ScriptList::spawnString } + " shotA"
+		}
+		, shotBScriptContainer{
+			scriptStoragePointer->get(L"shotB"),
+			std::string{ ScriptList::spawnString } + " shotB"
+		} {
 	}
 
 	void PlayerShotSystem::operator()(Scene& scene) {
@@ -25,13 +32,7 @@ namespace process::game::systems {
 
 	void PlayerShotSystem::addPlayerShot(Scene& scene) {
 		//get the iterator for players
-		static const Topic<wasp::ecs::component::Group*> groupPointerStorageTopic{};
-		auto groupPointer{
-			getGroupPointer<PlayerData, Position, ScriptList>(
-				scene,
-				groupPointerStorageTopic
-			)
-		};
+		auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
 		auto groupIterator{ 
 			groupPointer->groupIterator<PlayerData, ScriptList>()
 		};
@@ -50,16 +51,10 @@ namespace process::game::systems {
 			//if there is no pre-existing spawn, add one
 			if (!isPlayerSpawning) {
 				if (playerData.shotType == ShotType::shotA) {
-					scriptList.push_back({
-						scriptStoragePointer->get(L"shotA"),
-						std::string{ ScriptList::spawnString } + " shotA"
-					});
+					scriptList.push_back(shotAScriptContainer);
 				}
 				else if (playerData.shotType == ShotType::shotB) {
-					scriptList.push_back({
-						scriptStoragePointer->get(L"shotB"),
-						std::string{ ScriptList::spawnString } + " shotB"
-					});
+					scriptList.push_back(shotBScriptContainer);
 				}
 				else {
 					throw std::runtime_error("unexpected player shot type!");
@@ -195,13 +195,7 @@ namespace process::game::systems {
         scene.getChannel(SceneTopics::playerStateEntry).clear();
 
         //get the group iterator for PlayerData
-        static const Topic<wasp::ecs::component::Group*> groupPointerStorageTopic{};
-        auto groupPointer{
-            getGroupPointer<PlayerData>(
-                scene,
-                groupPointerStorageTopic
-            )
-        };
+        auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
         auto groupIterator{ groupPointer->groupIterator<PlayerData>() };
 
         //update all player states
@@ -1098,12 +1098,9 @@ namespace process::game::systems{
 		).heapClone());
 	}
 	
-	Prototypes::ComponentTupleSharedPointer Prototypes::get(
-		const std::string& prototypeID
-	) const{
-		const auto& found{ prototypeMap.find(prototypeID) };
-		if(found != prototypeMap.end()){
-			return found->second;
+	Prototypes::PrototypeHandle Prototypes::getHandle(const std::string& prototypeID){
+		if(const auto& found{ prototypeTable.find(prototypeID) }){
+			return *found;
 		}
 		else{
 			throw std::runtime_error{ "failed to find prototype " + prototypeID };
@@ -1171,10 +1168,10 @@ namespace process::game::systems{
 		const std::string& prototypeID,
 		const ComponentTupleSharedPointer& prototypePointer
 	){
-		if(prototypeMap.find(prototypeID) != prototypeMap.end()){
+		if(prototypeTable.contains(prototypeID)){
 			throw std::runtime_error{ "try to add pre-existing prototypeID: " + prototypeID };
 		}
-		prototypeMap[prototypeID] = prototypePointer;
+		prototypeTable.add(prototypeID, prototypePointer);
 	}
 	
 	void Prototypes::addCreditsPrototypes(resources::SpriteStorage& spriteStorage) {
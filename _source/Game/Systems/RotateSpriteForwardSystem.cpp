@@ -8,18 +8,25 @@ namespace process::game::systems {
 	void RotateSpriteForwardSystem::operator()(Scene& scene) {
 
 		//get the group iterator for SpriteInstruction, Vel, RotateSpriteForwardMarker
-		static const Topic<wasp::ecs::component::Group*> groupPointerStorageTopic{};
-		auto groupPointer{
-			getGroupPointer<SpriteInstruction, Velocity, RotateSpriteForwardMarker>(
-				scene,
-				groupPointerStorageTopic
-			)
-		};
+		auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
+
+		//only sprites whose velocity or sprite instruction changed since the last run
+		//can need turning
+		static const Topic<wasp::ecs::component::ChangeVersion> lastVersionTopic{};
+		auto& lastVersionChannel{ scene.getChannel(lastVersionTopic) };
+		if (lastVersionChannel.isEmpty()) {
+			lastVersionChannel.addMessage(0);
+		}
+		auto& lastVersion{ lastVersionChannel.getMessages()[0] };
+
 		auto groupIterator{
-			groupPointer->groupIterator<SpriteInstruction, Velocity>()
+			groupPointer->groupIterator<SpriteInstruction, Velocity>(
+				wasp::ecs::component::changedSince<Velocity, SpriteInstruction>(lastVersion)
+			)
 		};
+		lastVersion = scene.getDataStorage().advanceChangeVersion();
 
-		//rotate all sprites to the velocity direction
+		//rotate those sprites to the velocity direction
 		while (groupIterator.isValid()) {
 			auto [spriteInstruction, velocity] = *groupIterator;
 
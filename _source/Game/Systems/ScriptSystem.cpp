@@ -42,7 +42,10 @@ namespace process::game::systems {
 		: globalChannelSetPointer { globalChannelSetPointer }
 		, scriptStoragePointer{ scriptStoragePointer }
 		, spriteStoragePointer{ spriteStoragePointer }
-		, prototypes{ *scriptStoragePointer, *spriteStoragePointer } {
+		, prototypes{ *scriptStoragePointer, *spriteStoragePointer }
+		, statePoolPointer{ StatePool::makeObjectPool(
+			[](ScriptExecutionState& state){ state.clear(); }
+		) } {
 		
 		//add native vars
 		addNativeVariable("angleEquivalenceEpsilon", angleEquivalenceEpsilon);
@@ -138,6 +141,24 @@ namespace process::game::systems {
 			std::bind(&ScriptSystem::checkCoordinate<false, false>, this, _1)
 		);
 		
+		//spatial queries
+		addNativeFunction("nearestEnemy", std::bind(&ScriptSystem::nearestEnemy, this, _1));
+		addNativeFunction("enemiesInRadius",
+			std::bind(&ScriptSystem::enemiesInRadius, this, _1)
+		);
+		addNativeFunction("bulletsInRadius",
+			std::bind(&ScriptSystem::bulletsInRadius, this, _1)
+		);
+		addNativeFunction("bulletsInBox", std::bind(&ScriptSystem::bulletsInBox, this, _1));
+		addNativeFunction("isEnemyInLine", std::bind(&ScriptSystem::isEnemyInLine, this, _1));
+		
+		//ownership
+		addNativeFunction("owner", std::bind(&ScriptSystem::owner, this, _1));
+		addNativeFunction("hasOwner", std::bind(&ScriptSystem::hasOwner, this, _1));
+		addNativeFunction("killDescendants",
+			std::bind(&ScriptSystem::killDescendants, this, _1)
+		);
+		
 		//entity mutators
 		addNativeFunction("setCollidable", std::bind(&ScriptSystem::setCollidable, this, _1));
 		addNativeFunction("removeCollidable",
@@ -261,34 +282,12 @@ namespace process::game::systems {
 		addNativeFunction("spawn", std::bind(&ScriptSystem::spawn, this, _1));
 		
 		//load function scripts, which are files that start with keyword func
-		darkness::Lexer lexer{};
-		std::vector<std::string> paramNames{};
 		scriptStoragePointer->forEach([&](const ResourceSharedPointer& resourceSharedPointer){
 			const std::wstring& wideID{ resourceSharedPointer->getID() };
-			const std::string shortID{ convertFromWideString(wideID) };
-			//test to see if the filename starts with keyword func
-			if(shortID.find("func") == 0){
-				paramNames.clear();
-				//split string into tokens with lexer
-				const auto& tokens{ lexer.lex(shortID) };
-				auto itr{ tokens.begin() };
-				++itr;
-				//grab the func name, which should always be the second token
-				const std::string& funcName{ std::get<std::string>(itr->value) };
-				++itr;
-				//all identifiers following the func name are param names
-				for(auto end{ tokens.end() }; itr != end; ++itr){
-					if(itr->type == darkness::TokenType::identifier){
-						paramNames.push_back(std::get<std::string>(itr->value));
-					}
-				}
-				//add the script with the param names from the file name
-				addFunctionScript(
-					funcName,
-					resourceSharedPointer->getDataPointerCopy(),
-					paramNames
-				);
-			}
+			tryAddFunctionScript(
+				convertFromWideString(wideID),
+				resourceSharedPointer->getDataPointerCopy()
+			);
 		});
 	}
 	
@@ -297,8 +296,7 @@ namespace process::game::systems {
 		currentScenePointer = &scene;
 		
 		//get the group iterator for ScriptProgramList
-		static const Topic<Group*> groupPointerStorageTopic {};
-		auto groupPointer {	getGroupPointer<ScriptList>(scene, groupPointerStorageTopic) };
+		auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
 		auto groupIterator { groupPointer->groupIterator<ScriptList>() };
 		
 		//populate our component order queue with every component order this tick
@@ -336,10 +334,123 @@ namespace process::game::systems {
 		currentScenePointer = nullptr;
 	}
 	
+	void ScriptSystem::reloadScripts(
+		const std::vector<resources::ScriptStorage::ReloadedScript>& reloadedScripts
+	){
+		for(const auto& reloadedScript : reloadedScripts){
+			const auto& [wideID, oldScriptPointer, newScriptPointer] = reloadedScript;
+			const std::string shortID{ convertFromWideString(wideID) };
+			
+			//containers on any older version skip straight to the newest
+			for(auto& [key, scriptReplacement] : scriptReplacementMap){
+				if(scriptReplacement.newScriptPointer == oldScriptPointer){
+					scriptReplacement.newScriptPointer = newScriptPointer;
+				}
+			}
+			scriptReplacementMap[oldScriptPointer.get()] = { oldScriptPointer, newScriptPointer };
+			
+			if(const auto& found{ scriptTable.find(shortID) }){
+				scriptTable[*found].scriptPointer = newScriptPointer;
+			}
+			//a stalled call holds on to the function it was in, so this is safe mid call
+			tryAddFunctionScript(shortID, newScriptPointer);
+		}
+	}
+	
+	void ScriptSystem::tryAddFunctionScript(
+		const std::string& shortID,
+		const std::shared_ptr<darkness::AstNode>& scriptPointer
+	){
+		//test to see if the filename starts with keyword func
+		if(shortID.find("func") != 0){
+			return;
+		}
+		//split string into tokens with lexer
+		darkness::Lexer lexer{};
+		const auto& tokens{ lexer.lex(shortID) };
+		auto itr{ tokens.begin() };
+		++itr;
+		//grab the func name, which should always be the second token
+		const std::string& funcName{ std::get<std::string>(itr->value) };
+		++itr;
+		//all identifiers following the func name are param names
+		std::vector<std::string> paramNames{};
+		for(auto end{ tokens.end() }; itr != end; ++itr){
+			if(itr->type == darkness::TokenType::identifier){
+				paramNames.push_back(std::get<std::string>(itr->value));
+			}
+		}
+		//add the script with the param names from the file name
+		addFunctionScript(funcName, scriptPointer, paramNames);
+	}
+	
+	void ScriptSystem::replaceReloadedScript(ScriptContainer& scriptContainer){
+		auto found{ scriptReplacementMap.find(scriptContainer.scriptPointer.get()) };
+		if(found == scriptReplacementMap.end()){
+			return;
+		}
+		//a stalled script points into its old tree, so it can only be restarted
+		if(scriptContainer.isStalled()){
+			if constexpr(!config::restartReloadedScripts){
+				return;
+			}
+			scriptContainer.statePointer = nullptr;
+			scriptContainer.timer = ScriptContainer::noTimer;
+		}
+		scriptContainer.scriptPointer = found->second.newScriptPointer;
+	}
+	
 	EntityHandle ScriptSystem::makeCurrentEntityHandle(){
 		return currentScenePointer->getDataStorage().makeHandle(currentEntityID);
 	}
 	
+	ScriptSystem::ScriptHandle ScriptSystem::getScriptHandle(const std::string& scriptID){
+		if(const auto& found{ scriptTable.find(scriptID) }){
+			return *found;
+		}
+		//first time this script is named; convert and look it up only once
+		auto scriptPointer{ scriptStoragePointer->get(convertToWideString(scriptID)) };
+		if(!scriptPointer){
+			throw std::runtime_error{ "failed to find script " + scriptID };
+		}
+		return scriptTable.add(scriptID, {
+			std::move(scriptPointer),
+			scriptID,
+			std::string{ ScriptList::spawnString } + " " + scriptID
+		});
+	}
+	
+	ScriptSystem::ScriptHandle ScriptSystem::resolveScriptParameter(
+		const std::vector<DataType>& parameters,
+		std::size_t index
+	){
+		return resolveStringArg(
+			parameters,
+			index,
+			&scriptTable,
+			[&](const std::string& scriptID){ return getScriptHandle(scriptID); }
+		);
+	}
+	
+	Prototypes::PrototypeHandle ScriptSystem::resolvePrototypeParameter(
+		const std::vector<DataType>& parameters,
+		std::size_t index
+	){
+		return resolveStringArg(
+			parameters,
+			index,
+			&prototypes,
+			[&](const std::string& prototypeID){ return prototypes.getHandle(prototypeID); }
+		);
+	}
+	
+	MessageHandle ScriptSystem::internMessage(const std::string& message){
+		if(const auto& found{ messageTable.find(message) }){
+			return *found;
+		}
+		return messageTable.add(message, message);
+	}
+	
 	float ScriptSystem::getAsFloat(const DataType& data){
 		switch(data.index()){
 			case floatIndex:
@@ -365,6 +476,19 @@ namespace process::game::systems {
 		}
 	}
 	
+	const SpatialIndex* ScriptSystem::getSpatialIndexPointer(){
+		if(!currentScenePointer->hasChannel(SceneTopics::spatialIndex)){
+			return nullptr;
+		}
+		const auto& spatialIndexChannel{
+			currentScenePointer->getChannel(SceneTopics::spatialIndex)
+		};
+		if(spatialIndexChannel.isEmpty()){
+			return nullptr;
+		}
+		return &spatialIndexChannel.getMessages()[0];
+	}
+	
 	void ScriptSystem::throwIfNativeFunctionArityOutOfRange(
 		std::size_t arityMinInclusive,
 		std::size_t arityMaxInclusive,
@@ -390,16 +514,22 @@ namespace process::game::systems {
 			if(!scriptContainer.scriptPointer){
 				throw std::runtime_error{ "bad script pointer! " + scriptContainer.name };
 			}
+			if(!scriptReplacementMap.empty()){
+				replaceReloadedScript(scriptContainer);
+			}
 			try {
 				//if the script is not stalled, run the script
-				if( !scriptContainer.state.stalled ) {
-					scriptContainer.state = runScript(*scriptContainer.scriptPointer);
+				if( !scriptContainer.isStalled() ) {
+					if( !scriptContainer.statePointer ) {
+						scriptContainer.statePointer = statePoolPointer->acquire();
+					}
+					runScript(*scriptContainer.scriptPointer, *scriptContainer.statePointer);
 				}
 					//if the script IS stalled, resume the script
 				else {
-					scriptContainer.state = resumeScript(
+					resumeScript(
 						*scriptContainer.scriptPointer,
-						scriptContainer.state
+						*scriptContainer.statePointer
 					);
 				}
 			}
@@ -408,7 +538,7 @@ namespace process::game::systems {
 				throw std::runtime_error{ scriptName + " " + runtimeError.what() };
 			}
 			//if the script is stalled after being run, go to the next script
-			if(scriptContainer.state.stalled){
+			if(scriptContainer.isStalled()){
 				++itr;
 			}
 			//if the script is finished after being run, remove it
@@ -925,13 +1055,8 @@ namespace process::game::systems {
 		throwIfNativeFunctionWrongArity(0, parameters, "getPlayerPos");
 		
 		//get the iterator for players
-		static const Topic<Group*> playerGroupPointerStorageTopic{};
-		
 		auto playerGroupPointer{
-			getGroupPointer<PlayerData, Position>(
-				*currentScenePointer,
-				playerGroupPointerStorageTopic
-			)
+			playerPositionGroupQuery.getGroupPointer(currentScenePointer->getDataStorage())
 		};
 		auto playerGroupIterator{
 			playerGroupPointer->groupIterator<Position>()
@@ -1025,11 +1150,12 @@ namespace process::game::systems {
 	 */
 	ScriptSystem::DataType ScriptSystem::addSpawn(const std::vector<DataType>& parameters) {
 		throwIfNativeFunctionWrongArity(1, parameters, "addSpawn");
-		const std::string& spawnID{ std::get<std::string>(parameters[0]) };
-		const auto& scriptPointer{ scriptStoragePointer->get(convertToWideString(spawnID)) };
+		const ScriptEntry& scriptEntry{
+			scriptTable[resolveScriptParameter(parameters, 0)]
+		};
 		scriptsToAddToCurrentEntity.push_back({
-				scriptPointer,
-				std::string { ScriptList::spawnString } + " " + spawnID
+				scriptEntry.scriptPointer,
+				scriptEntry.spawnName
 		});
 		return false;
 	}
@@ -1041,8 +1167,9 @@ namespace process::game::systems {
 		const std::vector<DataType>& parameters
 	) {
 		throwIfNativeFunctionWrongArity(1, parameters, "addDeathSpawn");
-		const std::string& spawnID{ std::get<std::string>(parameters[0]) };
-		const auto& scriptPointer{ scriptStoragePointer->get(convertToWideString(spawnID)) };
+		const ScriptEntry& scriptEntry{
+			scriptTable[resolveScriptParameter(parameters, 0)]
+		};
 		auto& dataStorage{ currentScenePointer->getDataStorage() };
 		const auto& currentEntityHandle{ dataStorage.makeHandle(currentEntityID) };
 		if(dataStorage.containsComponent<DeathSpawn>(currentEntityHandle)){
@@ -1050,16 +1177,16 @@ namespace process::game::systems {
 				dataStorage.getComponent<DeathSpawn>(currentEntityHandle)
 			};
 			deathSpawn.scriptList.push_back({
-				scriptPointer,
-				std::string { ScriptList::spawnString } + " " + spawnID
+				scriptEntry.scriptPointer,
+				scriptEntry.spawnName
 			});
 		}
 		else{
 			componentOrderQueue.queueSetComponent(
 				currentEntityHandle,
 				DeathSpawn{ { {
-					scriptPointer,
-					std::string { ScriptList::spawnString } + " " + spawnID
+					scriptEntry.scriptPointer,
+					scriptEntry.spawnName
 				} }	}
 			);
 		}
@@ -1079,11 +1206,12 @@ namespace process::game::systems {
 	 */
 	ScriptSystem::DataType ScriptSystem::addScript(const std::vector<DataType>& parameters) {
 		throwIfNativeFunctionWrongArity(1, parameters, "addSpawn");
-		const std::string& scriptID{ std::get<std::string>(parameters[0]) };
-		const auto& scriptPointer{ scriptStoragePointer->get(convertToWideString(scriptID)) };
+		const ScriptEntry& scriptEntry{
+			scriptTable[resolveScriptParameter(parameters, 0)]
+		};
 		scriptsToAddToCurrentEntity.push_back({
-			scriptPointer,
-			scriptID
+			scriptEntry.scriptPointer,
+			scriptEntry.name
 		});
 		return false;
 	}
@@ -1520,13 +1648,8 @@ namespace process::game::systems {
 		};
 		
 		//get the iterator for players
-		static const Topic<Group*> playerGroupPointerStorageTopic{};
-		
 		auto playerGroupPointer{
-			getGroupPointer<PlayerData, Position>(
-				*currentScenePointer,
-				playerGroupPointerStorageTopic
-			)
+			playerPositionGroupQuery.getGroupPointer(currentScenePointer->getDataStorage())
 		};
 		auto playerGroupIterator{
 			playerGroupPointer->groupIterator<Position>()
@@ -1651,24 +1774,27 @@ namespace process::game::systems {
 		const std::vector<DataType>& parameters
 	) {
 		throwIfNativeFunctionWrongArity(0, parameters, "entityVelocity");
-		Velocity& velocity{
-			currentScenePointer->getDataStorage().getComponent<Velocity>(currentEntityID)
+		const Velocity& velocity{
+			std::as_const(currentScenePointer->getDataStorage())
+				.getComponent<Velocity>(currentEntityID)
 		};
 		return PolarVector{ velocity };
 	}
 	
 	ScriptSystem::DataType ScriptSystem::entitySpeed(const std::vector<DataType>& parameters) {
 		throwIfNativeFunctionWrongArity(0, parameters, "entitySpeed");
-		Velocity& velocity{
-			currentScenePointer->getDataStorage().getComponent<Velocity>(currentEntityID)
+		const Velocity& velocity{
+			std::as_const(currentScenePointer->getDataStorage())
+				.getComponent<Velocity>(currentEntityID)
 		};
 		return velocity.getMagnitude();
 	}
 	
 	ScriptSystem::DataType ScriptSystem::entityAngle(const std::vector<DataType>& parameters) {
 		throwIfNativeFunctionWrongArity(0, parameters, "entityAngle");
-		Velocity& velocity{
-			currentScenePointer->getDataStorage().getComponent<Velocity>(currentEntityID)
+		const Velocity& velocity{
+			std::as_const(currentScenePointer->getDataStorage())
+				.getComponent<Velocity>(currentEntityID)
 		};
 		return static_cast<float>(velocity.getAngle());
 	}
@@ -1711,6 +1837,161 @@ namespace process::game::systems {
 		return !dataStorage.containsComponent<SpecialCollisions::Target>(entityHandle);
 	}
 	
+	/**
+	 * (optional) float maxDistance
+	 * returns the entity's own position if no enemy is close enough
+	 */
+	ScriptSystem::DataType ScriptSystem::nearestEnemy(const std::vector<DataType>& parameters){
+		throwIfNativeFunctionArityOutOfRange(0, 1, parameters, "nearestEnemy");
+		const auto& dataStorage{ currentScenePointer->getDataStorage() };
+		Point2 pos{ dataStorage.getComponent<Position>(currentEntityID) };
+		float maxDistance{
+			parameters.empty()
+				? std::numeric_limits<float>::infinity()
+				: getAsFloat(parameters[0])
+		};
+		const SpatialIndex* spatialIndexPointer{ getSpatialIndexPointer() };
+		if(!spatialIndexPointer){
+			return pos;
+		}
+		const auto* nearestPointer{ spatialIndexPointer->enemies.findNearest(
+			pos,
+			maxDistance,
+			[&](const SpatialIndex::Grid::Entry& entry){
+				return entry.id.entityID != currentEntityID
+					&& dataStorage.isAlive(entry.id);
+			}
+		) };
+		return nearestPointer ? nearestPointer->position : pos;
+	}
+	
+	/**
+	 * float radius
+	 */
+	ScriptSystem::DataType ScriptSystem::enemiesInRadius(
+		const std::vector<DataType>& parameters
+	){
+		throwIfNativeFunctionWrongArity(1, parameters, "enemiesInRadius");
+		float radius{ getAsFloat(parameters[0]) };
+		const SpatialIndex* spatialIndexPointer{ getSpatialIndexPointer() };
+		if(!spatialIndexPointer){
+			return 0;
+		}
+		Point2 pos{
+			currentScenePointer->getDataStorage().getComponent<Position>(currentEntityID)
+		};
+		return countLiveEntries([&](const auto& function){
+			spatialIndexPointer->enemies.forEachInRadius(pos, radius, function);
+		});
+	}
+	
+	/**
+	 * float radius
+	 */
+	ScriptSystem::DataType ScriptSystem::bulletsInRadius(
+		const std::vector<DataType>& parameters
+	){
+		throwIfNativeFunctionWrongArity(1, parameters, "bulletsInRadius");
+		float radius{ getAsFloat(parameters[0]) };
+		const SpatialIndex* spatialIndexPointer{ getSpatialIndexPointer() };
+		if(!spatialIndexPointer){
+			return 0;
+		}
+		Point2 pos{
+			currentScenePointer->getDataStorage().getComponent<Position>(currentEntityID)
+		};
+		return countLiveEntries([&](const auto& function){
+			spatialIndexPointer->bullets.forEachInRadius(pos, radius, function);
+		});
+	}
+	
+	/**
+	 * Point2 corner, Point2 oppositeCorner
+	 */
+	ScriptSystem::DataType ScriptSystem::bulletsInBox(const std::vector<DataType>& parameters){
+		throwIfNativeFunctionWrongArity(2, parameters, "bulletsInBox");
+		const Point2& corner{ std::get<Point2>(parameters[0]) };
+		const Point2& oppositeCorner{ std::get<Point2>(parameters[1]) };
+		const SpatialIndex* spatialIndexPointer{ getSpatialIndexPointer() };
+		if(!spatialIndexPointer){
+			return 0;
+		}
+		wasp::math::AABB box{
+			std::min(corner.x, oppositeCorner.x),
+			std::max(corner.x, oppositeCorner.x),
+			std::min(corner.y, oppositeCorner.y),
+			std::max(corner.y, oppositeCorner.y)
+		};
+		return countLiveEntries([&](const auto& function){
+			spatialIndexPointer->bullets.forEachInBox(box, function);
+		});
+	}
+	
+	/**
+	 * float angle, float width (on either side of the line)
+	 */
+	ScriptSystem::DataType ScriptSystem::isEnemyInLine(const std::vector<DataType>& parameters){
+		throwIfNativeFunctionWrongArity(2, parameters, "isEnemyInLine");
+		float angle{ getAsFloat(parameters[0]) };
+		float width{ getAsFloat(parameters[1]) };
+		const SpatialIndex* spatialIndexPointer{ getSpatialIndexPointer() };
+		if(!spatialIndexPointer){
+			return false;
+		}
+		const auto& dataStorage{ currentScenePointer->getDataStorage() };
+		Point2 pos{ dataStorage.getComponent<Position>(currentEntityID) };
+		Vector2 direction{ PolarVector{ 1.0f, angle } };
+		const auto& bounds{ spatialIndexPointer->enemies.getBounds() };
+		//long enough to cross the whole index from anywhere inside it
+		float length{ bounds.getWidth() + bounds.getHeight() };
+		return spatialIndexPointer->enemies.findFirstAlongRay(
+			pos,
+			direction,
+			length,
+			width,
+			[&](const SpatialIndex::Grid::Entry& entry){
+				return entry.id.entityID != currentEntityID
+					&& dataStorage.isAlive(entry.id);
+			}
+		) != nullptr;
+	}
+	
+	/**
+	 * returns the position of the entity which spawned this one, or this entity's own
+	 * position if that entity is gone or has no position
+	 */
+	ScriptSystem::DataType ScriptSystem::owner(const std::vector<DataType>& parameters){
+		throwIfNativeFunctionWrongArity(0, parameters, "owner");
+		const auto& dataStorage{ currentScenePointer->getDataStorage() };
+		EntityHandle entityHandle{ makeCurrentEntityHandle() };
+		const auto ownerHandle{ dataStorage.getParent(entityHandle) };
+		if(ownerHandle && dataStorage.containsComponent<Position>(*ownerHandle)){
+			return Point2{ dataStorage.getComponent<Position>(*ownerHandle) };
+		}
+		return Point2{ dataStorage.getComponent<Position>(entityHandle) };
+	}
+	
+	ScriptSystem::DataType ScriptSystem::hasOwner(const std::vector<DataType>& parameters){
+		throwIfNativeFunctionWrongArity(0, parameters, "hasOwner");
+		const auto& dataStorage{ currentScenePointer->getDataStorage() };
+		return dataStorage.getParent(makeCurrentEntityHandle()).has_value();
+	}
+	
+	//kills everything this entity spawned, everything those spawned, and so on
+	ScriptSystem::DataType ScriptSystem::killDescendants(
+		const std::vector<DataType>& parameters
+	){
+		throwIfNativeFunctionWrongArity(0, parameters, "killDescendants");
+		auto& deathsChannel{ currentScenePointer->getChannel(SceneTopics::deaths) };
+		currentScenePointer->getDataStorage().forEachDescendant(
+			makeCurrentEntityHandle(),
+			[&](const EntityHandle& descendantHandle){
+				deathsChannel.addMessage(descendantHandle);
+			}
+		);
+		return false;
+	}
+	
 	/**
 	 * float speed
 	 */
@@ -1902,13 +2183,8 @@ namespace process::game::systems {
 					sceneEntryChannel.addMessage(SceneNames::load);
 					
 					//send player data to global
-					static const Topic<Group*> playerGroupPointerStorageTopic{};
-					
 					auto playerGroupPointer{
-						getGroupPointer<PlayerData>(
-							*currentScenePointer,
-							playerGroupPointerStorageTopic
-						)
+						playerGroupQuery.getGroupPointer(currentScenePointer->getDataStorage())
 					};
 					
 					auto playerGroupIterator{
@@ -1960,7 +2236,9 @@ namespace process::game::systems {
 		throwIfNativeFunctionArityOutOfRange(1, 2, parameters, "broadcast");
 		if(parameters.size() == 1){
 			const std::string& message { std::get<std::string>(parameters[0]) };
-			currentScenePointer->getChannel(SceneTopics::flags).addMessage(message);
+			currentScenePointer->getChannel(SceneTopics::flags).addMessage(
+				internMessage(message)
+			);
 			return false;
 		}
 		else {
@@ -1969,7 +2247,7 @@ namespace process::game::systems {
 			if( std::holds_alternative<Point2>(data) ) {
 				const Point2& point { std::get<Point2>(data) };
 				currentScenePointer->getChannel(SceneTopics::points).addMessage(
-					{ point, message }
+					{ point, internMessage(message) }
 				);
 				return false;
 			}
@@ -1987,9 +2265,11 @@ namespace process::game::systems {
 	ScriptSystem::DataType ScriptSystem::readPoint(const std::vector<DataType>& parameters){
 		throwIfNativeFunctionWrongArity(1, parameters, "readPoint");
 		const std::string& message{ std::get<std::string>(parameters[0]) };
+		//a message never interned was never sent
+		std::optional<MessageHandle> messageHandle{ messageTable.find(message) };
 		const auto& pointsChannel{ currentScenePointer->getChannel(SceneTopics::points) };
 		for(const auto& tuple : pointsChannel.getMessages()){
-			if(std::get<1>(tuple) == message){
+			if(messageHandle && std::get<1>(tuple) == *messageHandle){
 				return std::get<0>(tuple);
 			}
 		}
@@ -2004,9 +2284,13 @@ namespace process::game::systems {
 	ScriptSystem::DataType ScriptSystem::readFlag(const std::vector<DataType>& parameters){
 		throwIfNativeFunctionWrongArity(1, parameters, "readFlag");
 		const std::string& flagID{ std::get<std::string>(parameters[0]) };
+		std::optional<MessageHandle> flagHandle{ messageTable.find(flagID) };
+		if(!flagHandle){
+			return false;
+		}
 		const auto& flagsChannel{ currentScenePointer->getChannel(SceneTopics::flags) };
 		for(const auto& flagToCheck : flagsChannel.getMessages()){
-			if(flagToCheck == flagID){
+			if(flagToCheck == *flagHandle){
 				return true;
 			}
 		}
@@ -2020,6 +2304,10 @@ namespace process::game::systems {
 		throwIfNativeFunctionArityOutOfRange(1, 2, parameters, "killMessage");
 		if(parameters.size() == 1){
 			const std::string& flagID { std::get<std::string>(parameters[0]) };
+			std::optional<MessageHandle> flagHandle { messageTable.find(flagID) };
+			if( !flagHandle ) {
+				return false;
+			}
 			auto& flagsChannel{
 				currentScenePointer->getChannel(SceneTopics::flags)
 			};
@@ -2028,7 +2316,7 @@ namespace process::game::systems {
 				std::remove_if(
 					messages.begin(),
 					messages.end(),
-					[&](const auto& flagToCheck) { return flagToCheck == flagID; }
+					[&](const auto& flagToCheck) { return flagToCheck == *flagHandle; }
 				),
 				messages.end()
 			);
@@ -2038,6 +2326,10 @@ namespace process::game::systems {
 			const DataType& dummy { parameters[0] };
 			const std::string& message { std::get<std::string>(parameters[1]) };
 			if( std::holds_alternative<Point2>(dummy) ) {
+				std::optional<MessageHandle> messageHandle { messageTable.find(message) };
+				if( !messageHandle ) {
+					return false;
+				}
 				auto& pointsChannel {
 					currentScenePointer->getChannel(SceneTopics::points)
 				};
@@ -2046,7 +2338,7 @@ namespace process::game::systems {
 					std::remove_if(
 						messages.begin(),
 						messages.end(),
-						[&](const auto& tuple) { return std::get<1>(tuple) == message; }
+						[&](const auto& tuple) { return std::get<1>(tuple) == *messageHandle; }
 					),
 					messages.end()
 				);
@@ -2064,25 +2356,31 @@ namespace process::game::systems {
 	//string prototypeID, Point pos, PolarVector vel, OPTIONAL string scriptID
 	ScriptSystem::DataType ScriptSystem::spawn(const std::vector<DataType>& parameters) {
 		throwIfNativeFunctionArityOutOfRange(3, 4, parameters, "spawn");
-		const std::string& prototypeID{ std::get<std::string>(parameters[0]) };
-		const auto& prototypePointer{ prototypes.get(prototypeID) };
+		const auto& prototypePointer{
+			prototypes.get(resolvePrototypeParameter(parameters, 0))
+		};
 		
 		const Position& position{ std::get<Point2>(parameters[1]) };
 		const Velocity& velocity{ std::get<PolarVector>(parameters[2]) };
 		
+		//the spawning entity owns whatever it spawns
+		EntityHandle ownerHandle{ makeCurrentEntityHandle() };
 		if(parameters.size() == 3){
 			spawnQueue.queueSpawn(
-				prototypePointer->addPositionVelocity(position, velocity)
+				prototypePointer->addPositionVelocity(position, velocity),
+				ownerHandle
 			);
 		}
 		else {
-			const std::string& scriptID{ std::get<std::string>(parameters[3]) };
-			const auto& scriptPointer{
-				scriptStoragePointer->get(convertToWideString(scriptID))
+			const ScriptEntry& scriptEntry{
+				scriptTable[resolveScriptParameter(parameters, 3)]
+			};
+			ScriptList scriptList{
+				ScriptContainer{ scriptEntry.scriptPointer, scriptEntry.name }
 			};
-			ScriptList scriptList{ ScriptContainer{ scriptPointer, scriptID }};
 			spawnQueue.queueSpawn(
-				prototypePointer->addPositionVelocityScript(position, velocity, scriptList)
+				prototypePointer->addPositionVelocityScript(position, velocity, scriptList),
+				ownerHandle
 			);
 		}
 		
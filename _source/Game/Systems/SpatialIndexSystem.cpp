@@ -0,0 +1,36 @@
+#include "Game/Systems/SpatialIndexSystem.h"
+
+namespace process::game::systems {
+
+	void SpatialIndexSystem::operator()(Scene& scene) {
+		auto& spatialIndexChannel{ scene.getChannel(SceneTopics::spatialIndex) };
+		//the index persists across ticks so its buffers keep their capacity
+		if (spatialIndexChannel.isEmpty()) {
+			spatialIndexChannel.addMessage({});
+		}
+		auto& spatialIndex{ spatialIndexChannel.getMessages()[0] };
+		rebuildGrid(spatialIndex.enemies, enemyGroupQuery, scene);
+		rebuildGrid(spatialIndex.bullets, bulletGroupQuery, scene);
+	}
+
+	template <typename GroupQuery>
+	void SpatialIndexSystem::rebuildGrid(
+		SpatialIndex::Grid& grid,
+		GroupQuery& groupQuery,
+		Scene& scene
+	) {
+		grid.clear();
+		auto& dataStorage{ scene.getDataStorage() };
+		auto groupPointer{ groupQuery.getGroupPointer(dataStorage) };
+		auto groupIterator{ groupPointer->template groupIterator<Position>() };
+		while (groupIterator.isValid()) {
+			const auto [position] = *groupIterator;
+			grid.insert(
+				dataStorage.makeHandle(groupIterator.getEntityID()),
+				static_cast<wasp::math::Point2>(position)
+			);
+			++groupIterator;
+		}
+		grid.build();
+	}
+}
\ No newline at end of file
@@ -5,13 +5,7 @@ namespace process::game::systems {
 	void SpriteSpinSystem::operator()(Scene& scene) {
 
 		//get the group iterator for SpriteInstruction, SpriteSpin
-		static const Topic<wasp::ecs::component::Group*> groupPointerStorageTopic{};
-		auto groupPointer{
-			getGroupPointer<SpriteInstruction, SpriteSpin>(
-				scene,
-				groupPointerStorageTopic
-			)
-		};
+		auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
 		auto groupIterator{ 
 			groupPointer->groupIterator<SpriteInstruction, SpriteSpin>() 
 		};
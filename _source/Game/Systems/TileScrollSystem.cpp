@@ -32,13 +32,7 @@ namespace process::game::systems {
 	}
 
 	void TileScrollSystem::operator()(Scene& scene) {
-		static const Topic<wasp::ecs::component::Group*> groupPointerStorageTopic{};
-
-		auto groupPointer{
-			getGroupPointer<TilingInstruction, SpriteInstruction, TileScroll>(
-				scene, groupPointerStorageTopic
-			)
-		};
+		auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
 
 		//step each offset by tile scroll
 		auto groupIterator{ groupPointer->groupIterator<
@@ -2,22 +2,22 @@
 
 namespace process::game::systems {
 
-	void VelocitySystem::operator()(Scene& scene) {
-		static const Topic<wasp::ecs::component::Group*> groupPointerStorageTopic{};
+	namespace {
+		//Adds each velocity to its position and steps the position. Positions and
+		//velocities are each packed in one array, and the loop makes no calls, so the
+		//compiler can turn it into a few vector instructions per entity.
+		void integrate(Position* positions, const Velocity* velocities, std::size_t count) {
+			for (std::size_t i{ 0 }; i < count; ++i) {
+				positions[i] += static_cast<wasp::math::Vector2>(velocities[i]);
+				positions[i].step();
+			}
+		}
+	}
 
-		auto groupPointer{
-			getGroupPointer<Position, Velocity>(
-				scene, groupPointerStorageTopic
-			)
-		};
+	void VelocitySystem::operator()(Scene& scene) {
+		auto groupPointer{ groupQuery.getGroupPointer(scene.getDataStorage()) };
 
-		//add each entity's velocity to its position and step the position
-		auto groupIterator{ groupPointer->groupIterator<Position, Velocity>() };
-		while (groupIterator.isValid()) {
-			const auto [position, velocity] = *groupIterator;
-			position += velocity;
-			position.step();
-			++groupIterator;
-		}
+		//one call per archetype rather than one iterator step per entity
+		groupPointer->forEachArchetype<Position, Velocity>(integrate);
 	}
 }
\ No newline at end of file
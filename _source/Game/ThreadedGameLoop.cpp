@@ -0,0 +1,86 @@
+#include "Game\ThreadedGameLoop.h"
+
+#include <thread>
+
+#include "Scheduling.h"
+
+#include "Logging.h"
+
+namespace process::game {
+
+	namespace{
+		constexpr uint64_t ratio100nsToSeconds { 10'000'000ull };
+		using clockType = std::chrono::steady_clock;
+		using ratioTimePointTo100ns = std::ratio<
+			clockType::period::num * ratio100nsToSeconds,
+			clockType::period::den
+		>;
+	}
+
+	void ThreadedGameLoop::run() {
+		running = true;
+		std::thread updateThread { &ThreadedGameLoop::runUpdates, this };
+
+		//render until either thread stops the loop
+		try {
+			while( running ) {
+				renderFunction();
+			}
+		}
+		catch( ... ) {
+			running = false;
+			updateThread.join();
+			throw;
+		}
+		updateThread.join();
+
+		if( updateExceptionPointer ) {
+			std::rethrow_exception(updateExceptionPointer);
+		}
+	}
+
+	void ThreadedGameLoop::stop() {
+		running = false;
+	}
+
+	void ThreadedGameLoop::runUpdates() {
+		DurationType timeBetweenUpdates {
+			static_cast<DurationType::rep>(
+				((1.0 / updatesPerSecond) * ClockType::period::den)
+					/ ClockType::period::num
+			)
+		};
+
+		TimePointType nextUpdate { getCurrentTime() };
+
+		try {
+			while( running ) {
+				//update if time
+				if( getCurrentTime() >= nextUpdate ) {
+					updateFunction();
+					nextUpdate += timeBetweenUpdates;
+					if( nextUpdate < getCurrentTime() ) {
+						nextUpdate = getCurrentTime();
+					}
+				}
+				//otherwise sleep until next update; rendering does not hold us back
+				else {
+					wasp::utility::sleep100ns(
+						((nextUpdate - getCurrentTime()).count() * ratioTimePointTo100ns::num)
+							/ ratioTimePointTo100ns::den
+					);
+				}
+			}
+		}
+		catch( ... ) {
+			//hand the exception to the render thread
+			updateExceptionPointer = std::current_exception();
+			running = false;
+		}
+	}
+
+	//static
+	ThreadedGameLoop::TimePointType ThreadedGameLoop::getCurrentTime() {
+		return ClockType::now();
+	}
+}
@@ -35,6 +35,7 @@ namespace process::game {
 	const Topic<> SceneTopics::clearFlag{};
 	const Topic<> SceneTopics::pauseFlag{};
 	const Topic<> SceneTopics::winFlag{};
-	const Topic<std::tuple<wasp::math::Point2, std::string>> SceneTopics::points{};
-	const Topic<std::string> SceneTopics::flags{};
+	const Topic<systems::SpatialIndex> SceneTopics::spatialIndex{};
+	const Topic<std::tuple<wasp::math::Point2, MessageHandle>> SceneTopics::points{};
+	const Topic<MessageHandle> SceneTopics::flags{};
 }
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include "Graphics/AtlasPacker.h"
+
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+
+namespace process::graphics {
+
+	std::vector<AtlasPlacement> AtlasPacker::pack(
+		const std::vector<unsigned int>& widths,
+		const std::vector<unsigned int>& heights
+	) {
+		if(widths.size() != heights.size()){
+			throw std::runtime_error{ "Error atlas widths and heights differ in size" };
+		}
+		pages.clear();
+		unpackedCount = 0;
+
+		//tallest first, then widest; stable so equal rectangles keep input order
+		std::vector<std::size_t> order(widths.size());
+		std::iota(order.begin(), order.end(), 0);
+		std::stable_sort(order.begin(), order.end(), [&](std::size_t left, std::size_t right){
+			if(heights[left] != heights[right]){
+				return heights[left] > heights[right];
+			}
+			return widths[left] > widths[right];
+		});
+
+		std::vector<AtlasPlacement> placements(widths.size());
+		for(std::size_t index : order){
+			unsigned int paddedWidth{ widths[index] + padding };
+			unsigned int paddedHeight{ heights[index] + padding };
+			AtlasPlacement& placement{ placements[index] };
+			if(paddedWidth > pageWidth || paddedHeight > pageHeight){
+				++unpackedCount;
+				continue;
+			}
+			for(std::size_t pageIndex{ 0 }; pageIndex < pages.size(); ++pageIndex){
+				if(tryPlace(pages[pageIndex], paddedWidth, paddedHeight, placement)){
+					placement.page = static_cast<int>(pageIndex);
+					break;
+				}
+			}
+			if(!placement.packed){
+				Page& newPage{ pages.emplace_back() };
+				newPage.skyline.push_back({ 0, 0, pageWidth });
+				tryPlace(newPage, paddedWidth, paddedHeight, placement);
+				placement.page = static_cast<int>(pages.size() - 1);
+			}
+			auto& occupancy{ pages[placement.page].occupancy };
+			++occupancy.rectCount;
+			occupancy.usedArea += static_cast<unsigned long long>(widths[index])
+				* heights[index];
+		}
+		return placements;
+	}
+
+	std::string AtlasPacker::makeOccupancyReport() const {
+		std::ostringstream report{};
+		report << "atlas " << pages.size() << " page(s) of "
+			<< pageWidth << "x" << pageHeight << "\n";
+		double pageArea{ static_cast<double>(pageWidth) * pageHeight };
+		for(std::size_t pageIndex{ 0 }; pageIndex < pages.size(); ++pageIndex){
+			const auto& occupancy{ pages[pageIndex].occupancy };
+			report << "page " << pageIndex << ": "
+				<< occupancy.rectCount << " sprite(s), "
+				<< std::fixed << std::setprecision(1)
+				<< (100.0 * static_cast<double>(occupancy.usedArea) / pageArea)
+				<< "% occupied, skyline at " << occupancy.skylineHeight << "\n";
+		}
+		report << "unpacked: " << unpackedCount;
+		return report.str();
+	}
+
+	//helper functions
+
+	bool AtlasPacker::tryPlace(
+		Page& page,
+		unsigned int width,
+		unsigned int height,
+		AtlasPlacement& placement
+	) const {
+		//bottom left: lowest resting y, then narrowest segment to waste less space
+		constexpr auto none{ std::numeric_limits<std::size_t>::max() };
+		std::size_t bestIndex{ none };
+		unsigned int bestY{ std::numeric_limits<unsigned int>::max() };
+		unsigned int bestWidth{ std::numeric_limits<unsigned int>::max() };
+		for(std::size_t nodeIndex{ 0 }; nodeIndex < page.skyline.size(); ++nodeIndex){
+			unsigned int restingY;	//not initialized!
+			if(fitsAt(page, nodeIndex, width, height, restingY)){
+				unsigned int nodeWidth{ page.skyline[nodeIndex].width };
+				if(restingY < bestY || (restingY == bestY && nodeWidth < bestWidth)){
+					bestIndex = nodeIndex;
+					bestY = restingY;
+					bestWidth = nodeWidth;
+				}
+			}
+		}
+		if(bestIndex == none){
+			return false;
+		}
+		unsigned int x{ page.skyline[bestIndex].x };
+		addToSkyline(page, bestIndex, x, bestY, width, height);
+		page.occupancy.skylineHeight = std::max(page.occupancy.skylineHeight, bestY + height);
+		placement.packed = true;
+		placement.x = x;
+		placement.y = bestY;
+		return true;
+	}
+
+	bool AtlasPacker::fitsAt(
+		const Page& page,
+		std::size_t nodeIndex,
+		unsigned int width,
+		unsigned int height,
+		unsigned int& restingY
+	) const {
+		const auto& skyline{ page.skyline };
+		unsigned int x{ skyline[nodeIndex].x };
+		if(x + width > pageWidth){
+			return false;
+		}
+		//rest on the highest segment spanned
+		restingY = 0;
+		unsigned int widthLeft{ width };
+		for(std::size_t index{ nodeIndex }; widthLeft > 0; ++index){
+			restingY = std::max(restingY, skyline[index].y);
+			if(restingY + height > pageHeight){
+				return false;
+			}
+			widthLeft -= std::min(widthLeft, skyline[index].width);
+		}
+		return true;
+	}
+
+	void AtlasPacker::addToSkyline(
+		Page& page,
+		std::size_t nodeIndex,
+		unsigned int x,
+		unsigned int y,
+		unsigned int width,
+		unsigned int height
+	) {
+		auto& skyline{ page.skyline };
+		skyline.insert(skyline.begin() + nodeIndex, { x, y + height, width });
+
+		//shrink or remove the segments now covered by the new one
+		unsigned int right{ x + width };
+		for(std::size_t index{ nodeIndex + 1 }; index < skyline.size();){
+			SkylineNode& node{ skyline[index] };
+			if(node.x >= right){
+				break;
+			}
+			unsigned int nodeRight{ node.x + node.width };
+			if(nodeRight <= right){
+				skyline.erase(skyline.begin() + index);
+				continue;
+			}
+			node.width = nodeRight - right;
+			node.x = right;
+			break;
+		}
+
+		//merge neighbouring segments of equal height
+		for(std::size_t index{ 0 }; index + 1 < skyline.size();){
+			if(skyline[index].y == skyline[index + 1].y){
+				skyline[index].width += skyline[index + 1].width;
+				skyline.erase(skyline.begin() + index + 1);
+			}
+			else{
+				++index;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "Graphics/DrawCommand.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace process::graphics {
+
+	namespace{
+		//64 bit FNV-1a
+		constexpr std::uint64_t fnvOffsetBasis{ 14695981039346656037ull };
+		constexpr std::uint64_t fnvPrime{ 1099511628211ull };
+
+		template <typename T>
+		void hashValue(std::uint64_t& hash, const T& value){
+			static_assert(std::is_trivially_copyable_v<T>);
+			unsigned char bytes[sizeof(T)];
+			std::memcpy(bytes, &value, sizeof(T));
+			for(unsigned char byte : bytes){
+				hash ^= byte;
+				hash *= fnvPrime;
+			}
+		}
+	}
+
+	void DrawCommandList::endScene() {
+		//stable so that equal depths keep the order they were extracted in
+		std::stable_sort(
+			drawCommands.begin() + getSceneBeginIndex(sceneEndIndices.size()),
+			drawCommands.end(),
+			[](const DrawCommand& left, const DrawCommand& right){
+				return left.depth < right.depth;
+			}
+		);
+		sceneEndIndices.push_back(drawCommands.size());
+	}
+
+	std::uint64_t DrawCommandList::hash() const {
+		std::uint64_t hash{ fnvOffsetBasis };
+		for(const DrawCommand& drawCommand : drawCommands){
+			//hash field by field to skip padding
+			hashValue(hash, drawCommand.drawType);
+			hashValue(hash, drawCommand.depth);
+			hashValue(hash, drawCommand.textureWidth);
+			hashValue(hash, drawCommand.textureHeight);
+			hashValue(hash, drawCommand.pastX);
+			hashValue(hash, drawCommand.pastY);
+			hashValue(hash, drawCommand.x);
+			hashValue(hash, drawCommand.y);
+			hashValue(hash, drawCommand.offsetX);
+			hashValue(hash, drawCommand.offsetY);
+			hashValue(hash, drawCommand.rotation);
+			hashValue(hash, drawCommand.scale);
+			hashValue(hash, drawCommand.rectX);
+			hashValue(hash, drawCommand.rectY);
+			hashValue(hash, drawCommand.rectWidth);
+			hashValue(hash, drawCommand.rectHeight);
+			hashValue(hash, drawCommand.pixelOffsetX);
+			hashValue(hash, drawCommand.pixelOffsetY);
+			hashValue(hash, drawCommand.atlasULow);
+			hashValue(hash, drawCommand.atlasVLow);
+			hashValue(hash, drawCommand.atlasUHigh);
+			hashValue(hash, drawCommand.atlasVHigh);
+		}
+		for(std::size_t sceneEndIndex : sceneEndIndices){
+			hashValue(hash, sceneEndIndex);
+		}
+		return hash;
+	}
+}
@@ -0,0 +1,129 @@
+#include "Graphics/SpriteBatcher.h"
+
+#include <cmath>
+
+#include "Math/MathUtil.h"
+
+namespace process::graphics {
+
+	void SpriteBatcher::add(const DrawCommand& drawCommand, float interpolation) {
+		SpriteInstance instance;	//not initialized!
+		if(!makeInstance(drawCommand, interpolation, instance)){
+			return;
+		}
+		if(batches.empty() || batches.back().textureView != drawCommand.textureView){
+			batches.push_back({
+				drawCommand.textureView,
+				static_cast<std::uint32_t>(instances.size()),
+				0u
+			});
+		}
+		instances.push_back(instance);
+		++batches.back().instanceCount;
+	}
+
+	void SpriteBatcher::add(
+		const DrawCommand* begin,
+		const DrawCommand* end,
+		float interpolation
+	) {
+		for(const DrawCommand* itr{ begin }; itr != end; ++itr){
+			add(*itr, interpolation);
+		}
+	}
+
+	//mirrors the transform the graphics wrapper used to build per sprite
+	bool SpriteBatcher::makeInstance(
+		const DrawCommand& drawCommand,
+		float interpolation,
+		SpriteInstance& instance
+	) const {
+		float textureWidth{ static_cast<float>(drawCommand.textureWidth) };
+		float textureHeight{ static_cast<float>(drawCommand.textureHeight) };
+
+		float centerX;		//not initialized!
+		float centerY;		//not initialized!
+		float quadWidth;	//not initialized!
+		float quadHeight;	//not initialized!
+		float uLow{ 0.0f };
+		float vLow{ 0.0f };
+		float uHigh{ 1.0f };
+		float vHigh{ 1.0f };
+
+		switch(drawCommand.drawType){
+			case DrawCommand::DrawType::sprite:
+				centerX = drawCommand.interpolateX(interpolation);
+				centerY = drawCommand.interpolateY(interpolation);
+				quadWidth = textureWidth;
+				quadHeight = textureHeight;
+				break;
+			case DrawCommand::DrawType::subSprite:
+				//if width and height are small, draw nothing
+				if(drawCommand.rectWidth < 0.5f && drawCommand.rectHeight < 0.5f){
+					return false;
+				}
+				uLow = drawCommand.rectX / textureWidth;
+				uHigh = (drawCommand.rectX + drawCommand.rectWidth) / textureWidth;
+				vLow = drawCommand.rectY / textureHeight;
+				vHigh = (drawCommand.rectY + drawCommand.rectHeight) / textureHeight;
+				//move the center from that of the full sprite to that of the sub sprite
+				centerX = drawCommand.interpolateX(interpolation)
+					+ drawCommand.rectX + (drawCommand.rectWidth / 2.0f)
+					- (textureWidth / 2.0f);
+				centerY = drawCommand.interpolateY(interpolation)
+					+ drawCommand.rectY + (drawCommand.rectHeight / 2.0f)
+					- (textureHeight / 2.0f);
+				quadWidth = drawCommand.rectWidth;
+				quadHeight = drawCommand.rectHeight;
+				break;
+			case DrawCommand::DrawType::tileSprite:
+				//tile the draw rectangle
+				uLow = drawCommand.pixelOffsetX / textureWidth;
+				uHigh = uLow + (drawCommand.rectWidth / textureWidth);
+				vLow = drawCommand.pixelOffsetY / textureHeight;
+				vHigh = vLow + (drawCommand.rectHeight / textureHeight);
+				centerX = drawCommand.rectX + (drawCommand.rectWidth / 2.0f);
+				centerY = drawCommand.rectY + (drawCommand.rectHeight / 2.0f);
+				quadWidth = drawCommand.rectWidth;
+				quadHeight = drawCommand.rectHeight;
+				break;
+			default:
+				return false;
+		}
+		centerX += drawCommand.offsetX;
+		centerY += drawCommand.offsetY;
+
+		//scale by sprite dimensions and scale factor, rotate with aspect correction
+		float aspect{ graphicsWidth / graphicsHeight };
+		float widthScale{ (quadWidth / graphicsWidth) * drawCommand.scale };
+		float heightScale{ (quadHeight / graphicsHeight) * drawCommand.scale };
+		float radians{ wasp::math::toRadians(drawCommand.rotation) };
+		float cosine{ std::cos(radians) };
+		float sine{ std::sin(radians) };
+
+		instance.transform[0] = widthScale * cosine;
+		instance.transform[1] = aspect * widthScale * sine;
+		instance.transform[2] = -(heightScale * sine) / aspect;
+		instance.transform[3] = heightScale * cosine;
+
+		//translate to the center in NDC
+		instance.translation[0] = (centerX / (graphicsWidth / 2.0f)) - 1.0f;
+		instance.translation[1] = -((centerY / (graphicsHeight / 2.0f)) - 1.0f);
+		instance.translation[2] = static_cast<float>(drawCommand.depth)
+			/ static_cast<float>(DrawCommand::depthRange);
+
+		instance.uvRect[0] = uLow;
+		instance.uvRect[1] = vLow;
+		instance.uvRect[2] = uHigh;
+		instance.uvRect[3] = vHigh;
+
+		instance.atlasRect[0] = drawCommand.atlasULow;
+		instance.atlasRect[1] = drawCommand.atlasVLow;
+		instance.atlasRect[2] = drawCommand.atlasUHigh;
+		instance.atlasRect[3] = drawCommand.atlasVHigh;
+		instance.tiling = drawCommand.drawType == DrawCommand::DrawType::tileSprite
+			? 1.0f
+			: 0.0f;
+		return true;
+	}
+}
@@ -125,8 +125,64 @@ namespace process::graphics {
 		const ComPtr<IWICBitmapFrameDecode>& framePointer,
 		const ComPtr<ID3D11Device>& devicePointer
 	) {
-		PixelDataBuffer pixelDataBuffer{ getPixelDataBuffer(framePointer) };
-		DXGI_FORMAT format{ getD3DFormatFromWicFrame(framePointer) };
+		return convertPixelDataBufferToSprite(
+			getPixelDataBuffer(framePointer),
+			getD3DFormatFromWicFrame(framePointer),
+			devicePointer
+		);
+	}
+	
+	SpriteLoader::PixelDataBuffer SpriteLoader::getAtlasPixelDataBuffer(
+		const ComPtr<IWICBitmapFrameDecode>& framePointer
+	) {
+		ComPtr<IWICFormatConverter> converterPointer{};
+		HRESULT result{ wicFactoryPointer->CreateFormatConverter(
+			converterPointer.GetAddressOf()
+		) };
+		if(FAILED(result)){
+			throw HResultError{ "Error creating WIC format converter" };
+		}
+		result = converterPointer->Initialize(
+			framePointer.Get(),
+			GUID_WICPixelFormat32bppBGRA,
+			WICBitmapDitherTypeNone,
+			nullptr,
+			0.0,
+			WICBitmapPaletteTypeCustom
+		);
+		if(FAILED(result)){
+			throw HResultError{ "Error converting frame to atlas format" };
+		}
+		
+		UINT width{};
+		UINT height{};
+		result = converterPointer->GetSize(&width, &height);
+		if(FAILED(result)){
+			throw HResultError{ "Error determining WIC pixel size" };
+		}
+		
+		std::size_t widthBytes{ width * atlasBytesPerPixel };
+		std::size_t bufferSize{ widthBytes * height };
+		std::vector<byte> buffer(bufferSize);
+		
+		result = converterPointer->CopyPixels(
+			nullptr,
+			static_cast<UINT>(widthBytes),
+			static_cast<UINT>(bufferSize),
+			buffer.data()
+		);
+		if(FAILED(result)){
+			throw HResultError{ "Error copying data into buffer" };
+		}
+		
+		return { buffer, bufferSize, widthBytes, height, width, height };
+	}
+	
+	Sprite SpriteLoader::convertPixelDataBufferToSprite(
+		const PixelDataBuffer& pixelDataBuffer,
+		DXGI_FORMAT format,
+		const ComPtr<ID3D11Device>& devicePointer
+	) {
 		// Create texture
 		D3D11_TEXTURE2D_DESC desc{};
 		desc.Width = pixelDataBuffer.width;
@@ -3,7 +3,10 @@
 #endif
 
 #include <thread>
+#include <mutex>
+#include <atomic>
 #include <chrono>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include "windowsInclude.h"
@@ -11,7 +14,9 @@
 #include "MainConfig.h"
 
 #include "Game\GameLoop.h"
+#include "Game\ThreadedGameLoop.h"
 #include "Game\Resources\ResourceMasterStorage.h"
+#include "Game\Resources\ResidencyManager.h"
 #include "Game\WindowModes.h"
 #include "Window\WindowUtil.h"
 #include "Window\BaseWindow.h"
@@ -19,6 +24,7 @@
 #include "Input\KeyInputTable.h"
 #include "Sound\MidiHub.h"
 #include "ComLibraryGuard.h"
+#include "Utility\ThreadPool.h"
 #include "Game/Game.h"
 #include "Settings.h"
 
@@ -35,11 +41,13 @@ using wasp::window::getWindowBorderHeightPadding;
 
 //forward declarations
 void pumpMessages();
+void logTimeSince(const std::string& label, std::chrono::steady_clock::time_point start);
 
 #pragma warning(suppress : 28251) //suppress inconsistent annotation warning
 
 int WINAPI WinMain(HINSTANCE instanceHandle, HINSTANCE, PSTR, int windowShowMode) {
 	try {
+		const auto startTime { std::chrono::steady_clock::now() };
 		wasp::debug::initConsoleOutput();
 		
 		//read settings
@@ -58,16 +66,36 @@ int WINAPI WinMain(HINSTANCE instanceHandle, HINSTANCE, PSTR, int windowShowMode
 		resources::ResourceMasterStorage resourceMasterStorage {};
 		
 		resource::ResourceLoader resourceLoader {
-			std::array<wasp::resource::Loadable*, 6> {
+			std::array<wasp::resource::Loadable*, 7> {
 				&resourceMasterStorage.directoryStorage,
 				&resourceMasterStorage.manifestStorage,
 				&resourceMasterStorage.spriteStorage,
 				&resourceMasterStorage.midiSequenceStorage,
 				&resourceMasterStorage.dialogueStorage,
-				&resourceMasterStorage.scriptStorage
+				&resourceMasterStorage.scriptStorage,
+				&resourceMasterStorage.resourceGroupStorage
 			}
 		};
-		resourceLoader.loadFile({ config::mainManifestPath });
+		if constexpr (config::parallelResourceLoading) {
+			//the loading thread works through the tasks as well
+			unsigned int threadCount { std::max(std::thread::hardware_concurrency(), 1u) };
+			wasp::utility::ThreadPool threadPool { threadCount - 1 };
+			resourceLoader.loadFileInParallel({ config::mainManifestPath }, threadPool);
+		}
+		else {
+			resourceLoader.loadFile({ config::mainManifestPath });
+		}
+		resourceMasterStorage.scriptStorage.saveScriptCache();
+		if constexpr (config::hotReloadScripts) {
+			resourceMasterStorage.scriptStorage.watchForChanges();
+		}
+		logTimeSince("resources loaded", startTime);
+		
+		//loads the resource groups the manifest declares as they are needed
+		resources::ResidencyManager residencyManager {
+			&resourceMasterStorage,
+			&resourceLoader
+		};
 		
 		//init window
 		window::MainWindow window {
@@ -87,18 +115,25 @@ int WINAPI WinMain(HINSTANCE instanceHandle, HINSTANCE, PSTR, int windowShowMode
 
 		//init input
 		wasp::input::KeyInputTable keyInputTable {};
+		//guards the key input table if updates run on a different thread than the window
+		std::mutex keyInputMutex {};
 		window.setKeyDownCallback(
 			[&](WPARAM wParam, LPARAM lParam) {
+				std::lock_guard lock { keyInputMutex };
 				keyInputTable.handleKeyDown(wParam, lParam);
 			}
 		);
 		window.setKeyUpCallback(
 			[&](WPARAM wParam, LPARAM lParam) {
+				std::lock_guard lock { keyInputMutex };
 				keyInputTable.handleKeyUp(wParam, lParam);
 			}
 		);
 		window.setOutOfFocusCallback(
-			[&] { keyInputTable.allKeysOff(); }
+			[&] {
+				std::lock_guard lock { keyInputMutex };
+				keyInputTable.allKeysOff();
+			}
 		);
 		
 		//init midi
@@ -108,12 +143,13 @@ int WINAPI WinMain(HINSTANCE instanceHandle, HINSTANCE, PSTR, int windowShowMode
 		Game game{
 				&settings,
 				&resourceMasterStorage,
+				&residencyManager,
 				&window.getGraphicsWrapper(),
 				&keyInputTable,
 				&midiHub
 		};
 
-		game.setUpdateFullscreenCallback(
+		auto updateWindowMode {
 			[&]() {
 				if (settings.fullscreen) {
 					window.changeWindowMode(windowmodes::fullscreen);
@@ -122,6 +158,29 @@ int WINAPI WinMain(HINSTANCE instanceHandle, HINSTANCE, PSTR, int windowShowMode
 					window.changeWindowMode(windowmodes::windowed);
 				}
 			}
+		};
+		
+		bool firstFramePresented { false };
+		auto logFirstFrame {
+			[&]() {
+				if (!firstFramePresented) {
+					firstFramePresented = true;
+					logTimeSince("time to first frame", startTime);
+				}
+			}
+		};
+		
+		//the window mode can only be changed from the window thread
+		std::atomic_bool windowModeChangeRequested { false };
+		game.setUpdateFullscreenCallback(
+			[&]() {
+				if constexpr (config::threadedUpdates) {
+					windowModeChangeRequested = true;
+				}
+				else {
+					updateWindowMode();
+				}
+			}
 		);
 
 		game.setWriteSettingsCallback(
@@ -133,32 +192,71 @@ int WINAPI WinMain(HINSTANCE instanceHandle, HINSTANCE, PSTR, int windowShowMode
 			}
 		);
 		
-		//note: unlike previous engines, no interpolation thus no render scheduler
-		game::GameLoop gameLoop {
-			config::updatesPerSecond,
-			config::maxUpdatesWithoutFrame,
-			//update function
-			[&] {
-				game.update();
-				pumpMessages();
-			},
-			//draw function
-			[&]() {
-				game.render();
-				window.getGraphicsWrapper().present();
-			}
-		};
-		
-		auto stopGameLoopCallback { [&] { gameLoop.stop(); } };
-		
-		window.setDestroyCallback(stopGameLoopCallback);
-		game.setExitCallback(stopGameLoopCallback);
-		
-		//make the game visible and begin running
-		window.show(windowShowMode);
-		gameLoop.run();
+		if constexpr (config::threadedUpdates) {
+			//updates run on their own thread and publish snapshots, which this thread
+			//renders with interpolation while also pumping messages for the window
+			game::ThreadedGameLoop gameLoop {
+				config::updatesPerSecond,
+				//update function
+				[&] {
+					{
+						std::lock_guard lock { keyInputMutex };
+						game.update();
+					}
+					game.publishRenderSnapshot();
+				},
+				//draw function
+				[&]() {
+					pumpMessages();
+					if (windowModeChangeRequested.exchange(false)) {
+						updateWindowMode();
+					}
+					game.renderSnapshot();
+					window.getGraphicsWrapper().present();
+					logFirstFrame();
+				}
+			};
+			
+			auto stopGameLoopCallback { [&] { gameLoop.stop(); } };
+			
+			window.setDestroyCallback(stopGameLoopCallback);
+			game.setExitCallback(stopGameLoopCallback);
+			
+			//make the game visible and begin running
+			window.show(windowShowMode);
+			gameLoop.run();
+		}
+		else {
+			//note: unlike previous engines, no interpolation thus no render scheduler
+			game::GameLoop gameLoop {
+				config::updatesPerSecond,
+				config::maxUpdatesWithoutFrame,
+				//update function
+				[&] {
+					game.update();
+					pumpMessages();
+				},
+				//draw function
+				[&]() {
+					game.render();
+					window.getGraphicsWrapper().present();
+					logFirstFrame();
+				}
+			};
+			
+			auto stopGameLoopCallback { [&] { gameLoop.stop(); } };
+			
+			window.setDestroyCallback(stopGameLoopCallback);
+			game.setExitCallback(stopGameLoopCallback);
+			
+			//make the game visible and begin running
+			window.show(windowShowMode);
+			gameLoop.run();
+		}
 		
-		//after the game has ended, write settings and exit
+		//after the game has ended, write settings and exit; scripts parsed since startup,
+		//by hot reload or by resource groups, go into the script cache as well
+		resourceMasterStorage.scriptStorage.saveScriptCache();
 		wasp::game::settings::writeSettingsToFile(settings, config::mainConfigPath);
 		return 0;
 	}
@@ -220,4 +318,11 @@ void pumpMessages() {
 		TranslateMessage(&msg);
 		DispatchMessage(&msg);
 	}
+}
+
+void logTimeSince(const std::string& label, std::chrono::steady_clock::time_point start) {
+	std::chrono::duration<double, std::milli> elapsed {
+		std::chrono::steady_clock::now() - start
+	};
+	wasp::debug::log(label + ": " + std::to_string(elapsed.count()) + "ms");
 }
\ No newline at end of file
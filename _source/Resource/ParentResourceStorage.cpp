@@ -9,6 +9,10 @@ namespace process::resource {
 	using ResourceType = Resource<ChildList>;
 	
 	ChildListResource::~ChildListResource() {
+		//a declared but never loaded resource has no child list
+		if( !dataPointer ) {
+			return;
+		}
 		//erase children first
 		for( auto& childPointer : *dataPointer ) {
 			childPointer->setParentPointer(nullptr);
@@ -56,7 +60,8 @@ namespace process::resource {
 	}
 	
 	static void removeChildren(ResourceType& resource) {
-		ChildList& childList { *resource.getDataPointerCopy() };
+		//each removed child erases itself from the list, so walk a copy
+		ChildList childList { *resource.getDataPointerCopy() };
 		
 		for( ResourceBase* childPointer : childList ) {
 			if( childPointer->isLoaded() ) {
@@ -66,6 +71,22 @@ namespace process::resource {
 		}
 	}
 	
+	std::size_t ParentResourceStorage::getMemoryUsage(const std::wstring& id) const {
+		const ChildList* childListPointer { findData(id) };
+		if( !childListPointer ) {
+			return 0;
+		}
+		std::size_t memoryUsage { 0 };
+		for( ResourceBase* childPointer : *childListPointer ) {
+			if( childPointer->isLoaded() ) {
+				memoryUsage += childPointer->getStoragePointer()->getMemoryUsage(
+					childPointer->getID()
+				);
+			}
+		}
+		return memoryUsage;
+	}
+	
 	void ParentResourceStorage::remove(const std::wstring& id) {
 		auto found { resourceMap.find(id) };
 		if( found != resourceMap.end() ) {
@@ -61,6 +61,67 @@ namespace process::resource {
 			throw;
 		}
 	}
+	
+	ResourceLoader::ResourceBase* ResourceLoader::loadFileInParallel(
+		const FileOrigin& fileOrigin,
+		wasp::utility::ThreadPool& threadPool
+	) {
+		deferring = true;
+		ResourceBase* resourcePointer {};
+		try {
+			resourcePointer = loadFile(fileOrigin);
+			deferring = false;
+			threadPool.run(deferredTasks);
+		}
+		catch( ... ) {
+			deferring = false;
+			deferredTasks.clear();
+			throw;
+		}
+		deferredTasks.clear();
+		return resourcePointer;
+	}
+	
+	ResourceLoader::ResourceBase* ResourceLoader::loadManifestEntryDeferred(
+		const ManifestOrigin& manifestOrigin,
+		std::vector<std::function<void()>>& decodingTasks
+	) {
+		deferring = true;
+		ResourceBase* resourcePointer {};
+		try {
+			resourcePointer = loadManifestEntry(manifestOrigin);
+		}
+		catch( ... ) {
+			deferring = false;
+			deferredTasks.clear();
+			throw;
+		}
+		deferring = false;
+		decodingTasks = std::move(deferredTasks);
+		deferredTasks.clear();
+		return resourcePointer;
+	}
+	
+	void ResourceLoader::runOrDefer(
+		const std::wstring& fileName,
+		std::function<void()> task
+	) const {
+		auto loggingTask { [fileName, task{ std::move(task) }] {
+			try {
+				task();
+			}
+			catch( ... ) {
+				wasp::debug::log(L"failed to decode: " + fileName);
+				throw;
+			}
+		} };
+		if( deferring ) {
+			deferredTasks.push_back(std::move(loggingTask));
+		}
+		else {
+			loggingTask();
+		}
+	}
 }
 
 //ignoring possibility loading resources creates new resource types
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "Window\GraphicsWrapper.h"
 
+#include <algorithm>
+
 #include "Adaptor\HResultError.h"
 
 #include "Logging.h"
@@ -21,6 +23,37 @@ namespace process::window {
 		}
 		
 		constexpr unsigned int numVertices{ 4u };
+		constexpr UINT initInstanceCapacity{ 1024u };
+		
+		using DrawCommand = graphics::DrawCommand;
+		
+		DrawCommand makeDrawCommand(
+			Point2 preOffsetCenter,
+			const graphics::SpriteDrawInstruction& spriteDrawInstruction
+		){
+			const auto& sprite{ spriteDrawInstruction.getSprite() };
+			return {
+				DrawCommand::DrawType::sprite,
+				spriteDrawInstruction.getDepth(),
+				sprite.textureView.Get(),
+				sprite.width,
+				sprite.height,
+				preOffsetCenter.x,
+				preOffsetCenter.y,
+				preOffsetCenter.x,
+				preOffsetCenter.y,
+				spriteDrawInstruction.getOffset().x,
+				spriteDrawInstruction.getOffset().y,
+				spriteDrawInstruction.getRotation().getAngle(),
+				spriteDrawInstruction.getScale(),
+				0.0f, 0.0f, 0.0f, 0.0f,		//rect
+				0.0f, 0.0f,					//pixel offset
+				sprite.uLow,
+				sprite.vLow,
+				sprite.uHigh,
+				sprite.vHigh
+			};
+		}
 	}
 	
 	GraphicsWrapper::GraphicsWrapper(
@@ -28,7 +61,8 @@ namespace process::window {
 		int graphicsHeight
 	)
 		: graphicsWidth { graphicsWidth }
-		, graphicsHeight { graphicsHeight } {
+		, graphicsHeight { graphicsHeight }
+		, spriteBatcher { graphicsWidth, graphicsHeight } {
 	}
 	
 	void GraphicsWrapper::init(HWND windowHandle) {
@@ -150,9 +184,9 @@ namespace process::window {
 		auto vsBlobPointer{ setVertexShader() };
 		setPixelShader();
 		setSampler();
-		setVSConstantBuffer();
 		setInputLayout(vsBlobPointer);
 		setVertexBuffer();
+		setInstanceBuffer(initInstanceCapacity);
 		setViewport();
 		setDepthStencilState();
 		setBlendState();
@@ -221,25 +255,6 @@ namespace process::window {
 		);
 	}
 	
-	void GraphicsWrapper::setVSConstantBuffer(){
-		D3D11_BUFFER_DESC cbDesc{};
-		cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-		cbDesc.Usage = D3D11_USAGE_DYNAMIC;
-		cbDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-		cbDesc.MiscFlags = 0u;
-		cbDesc.ByteWidth = sizeof(VSConstantBuffer);
-		cbDesc.StructureByteStride = 0u;
-		HRESULT result{ devicePointer->CreateBuffer(
-			&cbDesc,
-			nullptr,
-			VSConstantBufferPointer.GetAddressOf()
-		) };
-		if(FAILED(result)){
-			throw HResultError{ "failed to create VS constant buffer" };
-		}
-		updateVSConstantBuffer();
-	}
-	
 	void GraphicsWrapper::setInputLayout(const ComPtr<ID3DBlob>& vsBlobPointer){
 		ComPtr<ID3D11InputLayout> inputLayoutPointer{};
 		const D3D11_INPUT_ELEMENT_DESC inputElementDesc[] {
@@ -260,6 +275,52 @@ namespace process::window {
 				12u,
 				D3D11_INPUT_PER_VERTEX_DATA,
 				0u
+			},
+			//per instance data in slot 1, see graphics::SpriteInstance
+			{
+				"InstanceTransform",
+				0u,
+				DXGI_FORMAT_R32G32B32A32_FLOAT,
+				1u,
+				0u,
+				D3D11_INPUT_PER_INSTANCE_DATA,
+				1u
+			},
+			{
+				"InstanceTranslation",
+				0u,
+				DXGI_FORMAT_R32G32B32_FLOAT,
+				1u,
+				16u,
+				D3D11_INPUT_PER_INSTANCE_DATA,
+				1u
+			},
+			{
+				"InstanceUVRect",
+				0u,
+				DXGI_FORMAT_R32G32B32A32_FLOAT,
+				1u,
+				28u,
+				D3D11_INPUT_PER_INSTANCE_DATA,
+				1u
+			},
+			{
+				"InstanceAtlasRect",
+				0u,
+				DXGI_FORMAT_R32G32B32A32_FLOAT,
+				1u,
+				44u,
+				D3D11_INPUT_PER_INSTANCE_DATA,
+				1u
+			},
+			{
+				"InstanceTiling",
+				0u,
+				DXGI_FORMAT_R32_FLOAT,
+				1u,
+				60u,
+				D3D11_INPUT_PER_INSTANCE_DATA,
+				1u
 			}
 		};
 		HRESULT result{ devicePointer->CreateInputLayout(
@@ -275,13 +336,14 @@ namespace process::window {
 		contextPointer->IASetInputLayout(inputLayoutPointer.Get());
 	}
 	
-	void GraphicsWrapper::setVertexBuffer(float uLow, float uHigh, float vLow, float vHigh) {
+	//texture coordinates of the quad are remapped per instance by the vertex shader
+	void GraphicsWrapper::setVertexBuffer() {
 		static constexpr float baseDepth{ 0.5f };
 		const Vertex vertices[] {
-			{-1.0f, -1.0f, baseDepth, uLow, vHigh },
-			{-1.0f, 1.0f, baseDepth, uLow, vLow },
-			{1.0f, -1.0f, baseDepth, uHigh, vHigh },
-			{1.0f, 1.0f, baseDepth, uHigh, vLow },
+			{-1.0f, -1.0f, baseDepth, 0.0f, 1.0f },
+			{-1.0f, 1.0f, baseDepth, 0.0f, 0.0f },
+			{1.0f, -1.0f, baseDepth, 1.0f, 1.0f },
+			{1.0f, 1.0f, baseDepth, 1.0f, 0.0f },
 		};
 		
 		contextPointer->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
@@ -315,6 +377,35 @@ namespace process::window {
 		);
 	}
 	
+	void GraphicsWrapper::setInstanceBuffer(UINT capacity) {
+		D3D11_BUFFER_DESC bufferDesc{};
+		bufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+		bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		bufferDesc.MiscFlags = 0u;
+		bufferDesc.ByteWidth = capacity * sizeof(graphics::SpriteInstance);
+		bufferDesc.StructureByteStride = sizeof(graphics::SpriteInstance);
+		instanceBufferPointer.Reset();
+		HRESULT result{ devicePointer->CreateBuffer(
+			&bufferDesc,
+			nullptr,
+			instanceBufferPointer.GetAddressOf()
+		) };
+		if(FAILED(result)){
+			throw HResultError{ "Failed to create instance buffer!" };
+		}
+		instanceBufferCapacity = capacity;
+		const UINT stride = bufferDesc.StructureByteStride;
+		const UINT offset = 0u;
+		contextPointer->IASetVertexBuffers(
+			1u,
+			1u,
+			instanceBufferPointer.GetAddressOf(),
+			&stride,
+			&offset
+		);
+	}
+	
 	void GraphicsWrapper::setViewport(){
 		D3D11_VIEWPORT viewport{};
 		viewport.Width = (float)graphicsWidth;
@@ -417,17 +508,9 @@ namespace process::window {
 		const Point2 preOffsetCenter,
 		const SpriteDrawInstruction& spriteDrawInstruction
 	) {
-		updatePSTexture(spriteDrawInstruction);
-		
-		VSConstantBuffer constantBuffer{makeTransform(
-			preOffsetCenter,
-			spriteDrawInstruction,
-			static_cast<float>(spriteDrawInstruction.getSprite().width),
-			static_cast<float>(spriteDrawInstruction.getSprite().height)
-		) };
-		mapVSConstantBuffer(&constantBuffer);
-		
-		contextPointer->Draw(numVertices, 0u);
+		spriteBatcher.clear();
+		spriteBatcher.add(makeDrawCommand(preOffsetCenter, spriteDrawInstruction), 1.0f);
+		drawBatches();
 	}
 	
 	void GraphicsWrapper::drawSubSprite(
@@ -435,46 +518,16 @@ namespace process::window {
 		const SpriteDrawInstruction& spriteDrawInstruction,
 		const Rectangle& sourceRectangle
 	) {
-		//if width and height are small, draw nothing
-		if(sourceRectangle.width < 0.5f && sourceRectangle.height < 0.5f){
-			return;
-		}
-		
-		//change texture coordinates : recall that they range from 0 to 1
-		float fullWidth{ static_cast<float>(spriteDrawInstruction.getSprite().width) };
-		float fullHeight{ static_cast<float>(spriteDrawInstruction.getSprite().height) };
-		float uLow{ sourceRectangle.x / fullWidth };
-		float uHigh{ (sourceRectangle.x + sourceRectangle.width) / fullWidth };
-		float vLow{ sourceRectangle.y / fullHeight };
-		float vHigh{ (sourceRectangle.y + sourceRectangle.height) / fullHeight };
-		setVertexBuffer(uLow, uHigh, vLow, vHigh);
-		
-		//find the new center for the quad
-		Point2 subCenter{
-			sourceRectangle.x + sourceRectangle.width / 2.0f,
-			sourceRectangle.y + sourceRectangle.height / 2.0f
-		};
-		Point2 fullCenter{fullWidth / 2.0f, fullHeight / 2.0f};
-		Vector2 subOffset{
-			wasp::math::vectorFromAToB(fullCenter, subCenter)
-		};
-		Point2 newPreOffsetCenter{ preOffsetCenter + subOffset };
-		
-		//draw sprite at that new center and with updated texture coords
-		updatePSTexture(spriteDrawInstruction);
-		
-		VSConstantBuffer constantBuffer{makeTransform(
-			newPreOffsetCenter,
-			spriteDrawInstruction,
-			sourceRectangle.width,
-			sourceRectangle.height
-		) };
-		mapVSConstantBuffer(&constantBuffer);
-		
-		contextPointer->Draw(numVertices, 0u);
-		
-		//expect sub-sprite calls to be rare, so change texture coords back
-		setVertexBuffer();
+		DrawCommand drawCommand{ makeDrawCommand(preOffsetCenter, spriteDrawInstruction) };
+		drawCommand.drawType = DrawCommand::DrawType::subSprite;
+		drawCommand.rectX = sourceRectangle.x;
+		drawCommand.rectY = sourceRectangle.y;
+		drawCommand.rectWidth = sourceRectangle.width;
+		drawCommand.rectHeight = sourceRectangle.height;
+		
+		spriteBatcher.clear();
+		spriteBatcher.add(drawCommand, 1.0f);
+		drawBatches();
 	}
 	
 	void GraphicsWrapper::drawTileSprite(
@@ -482,34 +535,18 @@ namespace process::window {
 		const SpriteDrawInstruction& spriteDrawInstruction,
 		Point2 pixelOffset
 	){
-		//change texture coordinates to tile the draw rectangle
-		float tileWidth{ static_cast<float>(spriteDrawInstruction.getSprite().width) };
-		float tileHeight{ static_cast<float>(spriteDrawInstruction.getSprite().height) };
-		float uLow{ pixelOffset.x / tileWidth };
-		float uHigh{ uLow + drawRectangle.width / tileWidth };
-		float vLow{ pixelOffset.y / tileHeight };
-		float vHigh{ vLow + drawRectangle.height / tileHeight };
-		setVertexBuffer(uLow, uHigh, vLow, vHigh);
-		
-		//draw sprite covering draw rectangle
-		Point2 preOffsetCenter{
-			drawRectangle.x + drawRectangle.width / 2.0f,
-			drawRectangle.y + drawRectangle.height / 2.0f
-		};
-		updatePSTexture(spriteDrawInstruction);
-		
-		VSConstantBuffer constantBuffer{makeTransform(
-			preOffsetCenter,
-			spriteDrawInstruction,
-			drawRectangle.width,
-			drawRectangle.height
-		) };
-		mapVSConstantBuffer(&constantBuffer);
-		
-		contextPointer->Draw(numVertices, 0u);
-		
-		//expect tile draws to be rare so change texture coords back
-		setVertexBuffer();
+		DrawCommand drawCommand{ makeDrawCommand({}, spriteDrawInstruction) };
+		drawCommand.drawType = DrawCommand::DrawType::tileSprite;
+		drawCommand.rectX = drawRectangle.x;
+		drawCommand.rectY = drawRectangle.y;
+		drawCommand.rectWidth = drawRectangle.width;
+		drawCommand.rectHeight = drawRectangle.height;
+		drawCommand.pixelOffsetX = pixelOffset.x;
+		drawCommand.pixelOffsetY = pixelOffset.y;
+		
+		spriteBatcher.clear();
+		spriteBatcher.add(drawCommand, 1.0f);
+		drawBatches();
 	}
 	
 	void GraphicsWrapper::drawText(
@@ -539,6 +576,7 @@ namespace process::window {
 		}};
 		wchar_t currentChar;//uninitialized
 		Point2 currentPos{};
+		spriteBatcher.clear();
 		for(int stringPos{ 0 }; stringPos < text.length(); ++stringPos){
 			currentPos.x = static_cast<float>(currentX);
 			currentPos.y = static_cast<float>(currentY);
@@ -557,111 +595,84 @@ namespace process::window {
 					currentY += verticalSpacing;
 				default:	//all other chars
 					stepCurrentCoordinates();
-					drawSprite(currentPos, symbolMap.get(currentChar));
+					spriteBatcher.add(
+						makeDrawCommand(currentPos, symbolMap.get(currentChar)),
+						1.0f
+					);
 			}
 		}
+		drawBatches();
 	}
 	
-	void GraphicsWrapper::updatePSTexture(const SpriteDrawInstruction& spriteDrawInstruction) {
-		contextPointer->PSSetShaderResources(
-			0u,
-			1u,
-			spriteDrawInstruction.getSprite().textureView.GetAddressOf()
-		);
+	void GraphicsWrapper::drawCommands(
+		const DrawCommand* begin,
+		const DrawCommand* end,
+		float interpolation
+	){
+		spriteBatcher.clear();
+		spriteBatcher.add(begin, end, interpolation);
+		drawBatches();
 	}
 	
-	#pragma warning(suppress : 4068) //suppress unknown pragma
-	#pragma clang diagnostic push
-	#pragma warning(suppress : 4068) //suppress unknown pragma
-	#pragma clang diagnostic ignored "-Wshadow"
-	DirectX::XMMATRIX GraphicsWrapper::makeTransform(
-		const Point2 preOffsetCenter,
-		const SpriteDrawInstruction& spriteDrawInstruction,
-		float quadWidthPixels,
-		float quadHeightPixels
-	) const {
-		
-		float graphicsWidth{ static_cast<float>(this->graphicsWidth) };
-		float graphicsHeight{ static_cast<float>(this->graphicsHeight) };
-		
-		float aspect{ graphicsWidth / graphicsHeight };
-		
-		float widthScale{
-			quadWidthPixels / graphicsWidth
-		};
-		float heightScale{
-			quadHeightPixels / graphicsHeight
-		};
-		
-		Point2 offsetCenter{ preOffsetCenter + spriteDrawInstruction.getOffset() };
-		Point2 centerNDC{ convertPointToNDC(
-			offsetCenter,
-			graphicsWidth,
-			graphicsHeight)
-		};
-		
-		static constexpr float depthRange{
-			SpriteDrawInstruction::maxDepth - SpriteDrawInstruction::minDepth + 1
-		};
-		float depthShift{ static_cast<float>(spriteDrawInstruction.getDepth()) / depthRange };
-
-		return DirectX::XMMatrixTranspose(
-			//reverse aspect correction
-			//scale by sprite dimensions
-			//scale by scale factor
-			DirectX::XMMatrixScaling(
-				aspect * widthScale * spriteDrawInstruction.getScale(),
-				heightScale * spriteDrawInstruction.getScale(),
-				1.0f
-			) *
-			//rotate on xy plane
-			DirectX::XMMatrixRotationZ(
-				spriteDrawInstruction.getRotation().getAngleRadians()
-			) *
-			//aspect correction
-			DirectX::XMMatrixScaling(
-				1.0f / aspect,
-				1.0f,
-				1.0f
-			) *
-			//translation last
-			DirectX::XMMatrixTranslation(
-				centerNDC.x,
-				centerNDC.y,
-				depthShift
-			)
-		);
+	void GraphicsWrapper::updatePSTexture(ID3D11ShaderResourceView* textureView) {
+		contextPointer->PSSetShaderResources(0u, 1u, &textureView);
+	}
+	
+	void GraphicsWrapper::drawBatches() {
+		const auto& instances{ spriteBatcher.getInstances() };
+		if(instances.empty()){
+			return;
+		}
+		mapInstanceBuffer(instances);
+		
+		//one draw per batch, only rebinding the texture when it changes
+		ID3D11ShaderResourceView* boundTextureView{ nullptr };
+		for(const graphics::SpriteBatch& spriteBatch : spriteBatcher.getBatches()){
+			if(spriteBatch.textureView != boundTextureView){
+				updatePSTexture(spriteBatch.textureView);
+				boundTextureView = spriteBatch.textureView;
+			}
+			contextPointer->DrawInstanced(
+				numVertices,
+				spriteBatch.instanceCount,
+				0u,
+				spriteBatch.firstInstance
+			);
+		}
 	}
-	#pragma warning(suppress : 4068) //suppress unknown pragma
-	#pragma clang diagnostic pop
 	
-	void GraphicsWrapper::mapVSConstantBuffer(const VSConstantBuffer* const constantBuffer) {
+	void GraphicsWrapper::mapInstanceBuffer(
+		const std::vector<graphics::SpriteInstance>& instances
+	) {
+		//grow the instance buffer if needed
+		if(instances.size() > instanceBufferCapacity){
+			setInstanceBuffer(std::max(
+				static_cast<UINT>(instances.size()),
+				instanceBufferCapacity * 2u
+			));
+		}
+		
 		//disable GPU access
 		D3D11_MAPPED_SUBRESOURCE mappedResource{};
-		contextPointer->Map(
-			VSConstantBufferPointer.Get(),
+		HRESULT result{ contextPointer->Map(
+			instanceBufferPointer.Get(),
 			0,
 			D3D11_MAP_WRITE_DISCARD,
 			0,
 			&mappedResource
-		);
+		) };
+		if(FAILED(result)){
+			throw HResultError{ "Failed to map instance buffer!" };
+		}
 		
 		//update buffer
 		memcpy(
 			mappedResource.pData,
-			constantBuffer,
-			sizeof(VSConstantBuffer)
+			instances.data(),
+			instances.size() * sizeof(graphics::SpriteInstance)
 		);
 		
 		//re-enable GPU access
-		contextPointer->Unmap(VSConstantBufferPointer.Get(), 0);
-	}
-	
-	void GraphicsWrapper::updateVSConstantBuffer() {
-		contextPointer->VSSetConstantBuffers(
-			0u,
-			1u,
-			VSConstantBufferPointer.GetAddressOf()
-		);
+		contextPointer->Unmap(instanceBufferPointer.Get(), 0);
 	}
 }
\ No newline at end of file
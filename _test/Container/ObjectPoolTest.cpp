@@ -0,0 +1,43 @@
+#include <string>
+
+#include "Container/ObjectPool.h"
+#include "TestUtil.h"
+
+using wasp::container::ObjectPool;
+using wasp::test::check;
+
+namespace {
+	using Pool = ObjectPool<std::string>;
+	
+	void copiesComeFromTheSamePool() {
+		auto poolPointer{ Pool::makeObjectPool(2) };
+		Pool::pointer_type original{ poolPointer->acquire() };
+		*original = "state";
+		{
+			Pool::pointer_type copy{ Pool::acquireCopy(original) };
+			check(*copy == "state", "the copy has the original's value");
+			check(copy.get() != original.get(), "the copy is a separate object");
+			check(poolPointer->size() == 0, "the copy is taken from the pool");
+		}
+		check(poolPointer->size() == 1, "the copy goes back to the pool");
+	}
+	
+	void copiesWithoutAPool() {
+		Pool::pointer_type original{};
+		{
+			auto poolPointer{ Pool::makeObjectPool() };
+			original = poolPointer->acquire();
+			*original = "state";
+		}
+		Pool::pointer_type copy{ Pool::acquireCopy(original) };
+		check(*copy == "state", "a copy is made after the pool is gone");
+		check(!Pool::acquireCopy(Pool::pointer_type{}), "null copies to null");
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "copiesComeFromTheSamePool", copiesComeFromTheSamePool },
+		{ "copiesWithoutAPool", copiesWithoutAPool }
+	});
+}
\ No newline at end of file
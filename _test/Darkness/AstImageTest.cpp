@@ -0,0 +1,280 @@
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "AstImage.h"
+#include "Lexer.h"
+#include "Parser.h"
+#include "TestUtil.h"
+
+using namespace darkness;
+using wasp::test::check;
+
+namespace {
+	//uses every node type the parser makes
+	constexpr const char* testScript{
+		"let counter = 0;\n"
+		"let unset;\n"
+		"func clamp(value, low, high){\n"
+		"	if(value < low){ return low; }\n"
+		"	else if(value > high){ return high; }\n"
+		"	return value;\n"
+		"}\n"
+		"func nothing(){ return; }\n"
+		"for(let i = 0; i <= 10; i = i + 1){\n"
+		"	counter = counter + (i * 2) - (-i / 3);\n"
+		"}\n"
+		"while(!(counter == 5) & counter != 6 | counter >= +7){\n"
+		"	counter = clamp(counter - 1, 0, 100);\n"
+		"	{ unset = \"text\"; }\n"
+		"}\n"
+		"let ratio = 0.75;\n"
+		"let flag = true;\n"
+		"spawn(\"text\", makePolar(ratio, 90.0), false);\n"
+	};
+	
+	AstNode parseTestScript() {
+		Lexer lexer{};
+		Parser parser{};
+		return parser.parse(lexer.lex(testScript));
+	}
+	
+	//the reader needs word aligned memory, as it gets from a mapped file
+	std::vector<std::uint32_t> toWords(const std::vector<std::uint8_t>& image) {
+		std::vector<std::uint32_t> words((image.size() + 3) / 4);
+		std::memcpy(words.data(), image.data(), image.size());
+		return words;
+	}
+	
+	AstNode readImage(const std::vector<std::uint8_t>& image) {
+		std::vector<std::uint32_t> words{ toWords(image) };
+		AstImageReader astImageReader{};
+		return astImageReader.read(
+			reinterpret_cast<const std::uint8_t*>(words.data()),
+			image.size()
+		);
+	}
+	
+	bool equal(const AstNode& left, const AstNode& right);
+	
+	bool equal(const std::unique_ptr<AstNode>& left, const std::unique_ptr<AstNode>& right) {
+		if(!left || !right){
+			return !left && !right;
+		}
+		return equal(*left, *right);
+	}
+	
+	bool equal(const std::shared_ptr<AstNode>& left, const std::shared_ptr<AstNode>& right) {
+		if(!left || !right){
+			return !left && !right;
+		}
+		return equal(*left, *right);
+	}
+	
+	bool equal(const std::vector<AstNode>& left, const std::vector<AstNode>& right) {
+		if(left.size() != right.size()){
+			return false;
+		}
+		for(std::size_t i{ 0 }; i < left.size(); ++i){
+			if(!equal(left[i], right[i])){
+				return false;
+			}
+		}
+		return true;
+	}
+	
+	bool equalData(const AstStmtVarDeclareData& left, const AstStmtVarDeclareData& right) {
+		return left.varName == right.varName && equal(left.initializer, right.initializer);
+	}
+	
+	bool equalData(const AstStmtFuncDeclareData& left, const AstStmtFuncDeclareData& right) {
+		return left.funcName == right.funcName
+			&& left.paramNames == right.paramNames
+			&& equal(left.body, right.body);
+	}
+	
+	bool equalData(const AstStmtIfData& left, const AstStmtIfData& right) {
+		return equal(left.condition, right.condition)
+			&& equal(left.trueBranch, right.trueBranch)
+			&& equal(left.falseBranch, right.falseBranch);
+	}
+	
+	bool equalData(const AstStmtWhileData& left, const AstStmtWhileData& right) {
+		return equal(left.condition, right.condition) && equal(left.body, right.body);
+	}
+	
+	bool equalData(const AstStmtReturnData& left, const AstStmtReturnData& right) {
+		return left.hasValue == right.hasValue && equal(left.value, right.value);
+	}
+	
+	bool equalData(const AstStmtBlockData& left, const AstStmtBlockData& right) {
+		return equal(left.statements, right.statements);
+	}
+	
+	bool equalData(const AstStmtExpressionData& left, const AstStmtExpressionData& right) {
+		return equal(left.expression, right.expression);
+	}
+	
+	bool equalData(const AstBinData& left, const AstBinData& right) {
+		return equal(left.left, right.left) && equal(left.right, right.right);
+	}
+	
+	bool equalData(const AstAssignData& left, const AstAssignData& right) {
+		return left.varName == right.varName && equal(left.right, right.right);
+	}
+	
+	bool equalData(const AstUnaryData& left, const AstUnaryData& right) {
+		return equal(left.arg, right.arg);
+	}
+	
+	bool equalData(const AstVariableData& left, const AstVariableData& right) {
+		return left.varName == right.varName;
+	}
+	
+	bool equalData(const AstCallData& left, const AstCallData& right) {
+		return equal(left.funcExpr, right.funcExpr) && equal(left.args, right.args);
+	}
+	
+	bool equalData(const AstLitBoolData& left, const AstLitBoolData& right) {
+		return left.value == right.value;
+	}
+	
+	bool equalData(const AstLitIntData& left, const AstLitIntData& right) {
+		return left.value == right.value;
+	}
+	
+	bool equalData(const AstLitFloatData& left, const AstLitFloatData& right) {
+		return left.value == right.value;
+	}
+	
+	bool equalData(const AstLitStringData& left, const AstLitStringData& right) {
+		return left.value == right.value;
+	}
+	
+	bool equalData(const AstParenthesisData& left, const AstParenthesisData& right) {
+		return equal(left.inside, right.inside);
+	}
+	
+	bool equal(const AstNode& left, const AstNode& right) {
+		if(left.type != right.type || left.dataVariant.index() != right.dataVariant.index()){
+			return false;
+		}
+		return std::visit(
+			[&](const auto& leftData){
+				using DataType = std::decay_t<decltype(leftData)>;
+				return equalData(leftData, std::get<DataType>(right.dataVariant));
+			},
+			left.dataVariant
+		);
+	}
+	
+	bool readThrows(const std::vector<std::uint8_t>& image) {
+		try{
+			readImage(image);
+		}
+		catch(const std::runtime_error&){
+			return true;
+		}
+		return false;
+	}
+	
+	void setWord(std::vector<std::uint8_t>& image, std::size_t wordIndex, std::uint32_t word) {
+		std::memcpy(image.data() + (wordIndex * 4), &word, 4);
+	}
+	
+	std::uint32_t getWord(const std::vector<std::uint8_t>& image, std::size_t wordIndex) {
+		std::uint32_t word;	//not initialized!
+		std::memcpy(&word, image.data() + (wordIndex * 4), 4);
+		return word;
+	}
+	
+	void roundTripsParsedScript() {
+		AstNode script{ parseTestScript() };
+		check(static_cast<bool>(script), "test script parses");
+		
+		AstImageWriter astImageWriter{};
+		std::vector<std::uint8_t> image{ astImageWriter.write(script) };
+		AstNode readScript{ readImage(image) };
+		check(equal(script, readScript), "read ast equals parsed ast");
+		
+		//the writer is deterministic, so writing the read ast gives the same image
+		check(astImageWriter.write(readScript) == image, "same image");
+	}
+	
+	void rejectsMalformedImages() {
+		AstImageWriter astImageWriter{};
+		std::vector<std::uint8_t> image{ astImageWriter.write(parseTestScript()) };
+		check(!readThrows(image), "valid image reads");
+		
+		for(std::size_t size{ 0 }; size < image.size(); size += 4){
+			std::vector<std::uint8_t> truncated(image.begin(), image.begin() + size);
+			check(readThrows(truncated), "truncated at " + std::to_string(size));
+		}
+		
+		std::vector<std::uint8_t> badMagic{ image };
+		setWord(badMagic, 0, 0);
+		check(readThrows(badMagic), "bad magic");
+		
+		std::vector<std::uint8_t> badVersion{ image };
+		setWord(badVersion, 1, astimage::version + 1);
+		check(readThrows(badVersion), "bad version");
+		
+		std::uint32_t nodeCount{ getWord(image, 2) };
+		std::vector<std::uint8_t> badRoot{ image };
+		setWord(badRoot, 5, nodeCount);
+		check(readThrows(badRoot), "root out of range");
+		
+		//an unknown type in any node
+		std::size_t firstNodeWord{ astimage::headerWords };
+		for(std::uint32_t node{ 0 }; node < nodeCount; ++node){
+			std::vector<std::uint8_t> badType{ image };
+			std::size_t recordWord{ firstNodeWord + (node * astimage::nodeWords) };
+			setWord(badType, recordWord, static_cast<std::uint32_t>(AstType::numAstTypes));
+			check(readThrows(badType), "bad node type");
+		}
+	}
+	
+	//An image whose nodes are shared between parents: node i + 1 is a binPlus with
+	//node i as both operands. As a tree it would have 2^depth leaves.
+	std::vector<std::uint8_t> makeSharedChildImage(std::uint32_t depth) {
+		std::vector<std::uint32_t> words{
+			astimage::magic,
+			astimage::version,
+			depth + 1,
+			0,
+			0,
+			depth
+		};
+		words.insert(words.end(), {
+			static_cast<std::uint32_t>(AstType::litInt), 1, astimage::none, astimage::none
+		});
+		for(std::uint32_t i{ 0 }; i < depth; ++i){
+			words.insert(words.end(), {
+				static_cast<std::uint32_t>(AstType::binPlus), i, i, astimage::none
+			});
+		}
+		std::vector<std::uint8_t> image(words.size() * 4);
+		std::memcpy(image.data(), words.data(), image.size());
+		return image;
+	}
+	
+	void rejectsSharedChildren() {
+		//one level is a tree, so it reads
+		std::vector<std::uint8_t> tree{ makeSharedChildImage(0) };
+		check(!readThrows(tree), "single node reads");
+		
+		check(readThrows(makeSharedChildImage(1)), "child shared by one parent");
+		//would take 2^64 node reads if shared children were allowed
+		check(readThrows(makeSharedChildImage(64)), "deeply shared children");
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "roundTripsParsedScript", roundTripsParsedScript },
+		{ "rejectsMalformedImages", rejectsMalformedImages },
+		{ "rejectsSharedChildren", rejectsSharedChildren }
+	});
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include <string>
+#include <vector>
+
+#include "Interpreter.h"
+#include "Lexer.h"
+#include "Parser.h"
+#include "TestUtil.h"
+
+using wasp::test::check;
+
+namespace {
+	//stands in for ScriptSystem resolving IDs through handle tables
+	class LookupInterpreter : private darkness::Interpreter<> {
+	public:
+		//fields
+		std::vector<std::string> names{ "a", "b", "c" };
+		std::vector<std::string> firstTableResolves{};
+		std::vector<std::string> secondTableResolves{};
+		std::vector<std::uint32_t> handles{};
+		
+	private:
+		int firstTable{};
+		int secondTable{};
+		
+	public:
+		LookupInterpreter() {
+			addNativeFunction("first", [&](const std::vector<DataType>& parameters){
+				return lookUp(parameters, &firstTable, firstTableResolves);
+			});
+			addNativeFunction("second", [&](const std::vector<DataType>& parameters){
+				return lookUp(parameters, &secondTable, secondTableResolves);
+			});
+		}
+		
+		void run(const std::string& source) {
+			darkness::Lexer lexer{};
+			darkness::Parser parser{};
+			darkness::AstNode script{ parser.parse(lexer.lex(source)) };
+			ScriptExecutionState state{};
+			runScript(script, state);
+		}
+		
+	private:
+		DataType lookUp(
+			const std::vector<DataType>& parameters,
+			const void* tablePointer,
+			std::vector<std::string>& resolves
+		) {
+			handles.push_back(resolveStringArg(
+				parameters,
+				0,
+				tablePointer,
+				[&](const std::string& name){
+					resolves.push_back(name);
+					for(std::uint32_t i{ 0 }; i < names.size(); ++i){
+						if(names[i] == name){
+							return i;
+						}
+					}
+					throw std::runtime_error{ "no such name " + name };
+				}
+			));
+			return false;
+		}
+	};
+	
+	void resolvesLiteralsOncePerCallSite() {
+		LookupInterpreter lookupInterpreter{};
+		lookupInterpreter.run(
+			"let i = 0;\n"
+			"while(i < 4){\n"
+			"	first(\"b\");\n"
+			"	first(\"c\");\n"
+			"	i = i + 1;\n"
+			"}\n"
+		);
+		check(
+			lookupInterpreter.firstTableResolves == std::vector<std::string>{ "b", "c" },
+			"each literal resolved once"
+		);
+		check(
+			lookupInterpreter.handles
+				== std::vector<std::uint32_t>{ 1, 2, 1, 2, 1, 2, 1, 2 },
+			"cached handles"
+		);
+	}
+	
+	void resolvesOtherStringsEveryCall() {
+		LookupInterpreter lookupInterpreter{};
+		lookupInterpreter.run(
+			"let name = \"a\";\n"
+			"let i = 0;\n"
+			"while(i < 3){\n"
+			"	first(name);\n"
+			"	first((\"c\"));\n"
+			"	i = i + 1;\n"
+			"}\n"
+		);
+		check(lookupInterpreter.firstTableResolves.size() == 6, "resolved every call");
+		check(
+			lookupInterpreter.handles == std::vector<std::uint32_t>{ 0, 2, 0, 2, 0, 2 },
+			"handles"
+		);
+	}
+	
+	//one call site reaching two natives through a variable
+	void keepsTablesApart() {
+		LookupInterpreter lookupInterpreter{};
+		lookupInterpreter.run(
+			"let lookUp = first;\n"
+			"let i = 0;\n"
+			"while(i < 4){\n"
+			"	lookUp(\"c\");\n"
+			"	if(i == 0 | i == 2){ lookUp = second; }\n"
+			"	else{ lookUp = first; }\n"
+			"	i = i + 1;\n"
+			"}\n"
+		);
+		check(lookupInterpreter.firstTableResolves.size() == 2, "first table");
+		check(lookupInterpreter.secondTableResolves.size() == 2, "second table");
+		check(
+			lookupInterpreter.handles == std::vector<std::uint32_t>{ 2, 2, 2, 2 },
+			"handles"
+		);
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "resolvesLiteralsOncePerCallSite", resolvesLiteralsOncePerCallSite },
+		{ "resolvesOtherStringsEveryCall", resolvesOtherStringsEveryCall },
+		{ "keepsTablesApart", keepsTablesApart }
+	});
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+#include "ECS/DataStorage.h"
+#include "ECS/TestComponents.h"
+
+using namespace wasp::ecs;
+using namespace wasp::ecs::test;
+
+//Times the per entity GroupIterator loop against forEachArchetype over the velocity
+//integration VelocitySystem runs, with entities split over two archetypes.
+namespace {
+	using clockType = std::chrono::steady_clock;
+	
+	constexpr int runCount { 200 };
+	
+	void addEntities(DataStorage& dataStorage, int count) {
+		for( int i { 0 }; i < count; ++i ) {
+			Position position { wasp::math::Point2 { static_cast<float>(i), 0.0f } };
+			Velocity velocity { 1.0f, static_cast<float>(i) };
+			if( i % 2 == 0 ) {
+				dataStorage.addEntity(AddEntityOrder { std::tuple { position, velocity } });
+			}
+			else {
+				dataStorage.addEntity(
+					AddEntityOrder { std::tuple { position, velocity, Marker {} } }
+				);
+			}
+		}
+	}
+	
+	template <typename Function>
+	double bestNanosecondsPerEntity(Function&& function, int entityCount) {
+		double best { 1e30 };
+		for( int run { 0 }; run < runCount; ++run ) {
+			auto start { clockType::now() };
+			function();
+			std::chrono::duration<double, std::nano> elapsed { clockType::now() - start };
+			best = std::min(best, elapsed.count());
+		}
+		return best / entityCount;
+	}
+}
+
+int main() {
+	std::cout << "best of " << runCount << " runs, ns per entity\n";
+	for( int entityCount : { 1'000, 5'000, 20'000, 50'000 } ) {
+		DataStorage dataStorage { static_cast<std::size_t>(entityCount) + 10, 50 };
+		addEntities(dataStorage, entityCount);
+		auto groupPointer { dataStorage.getGroupPointer<Position, Velocity>() };
+		
+		double iteratorNanoseconds { bestNanosecondsPerEntity([&] {
+			auto groupIterator { groupPointer->groupIterator<Position, Velocity>() };
+			while( groupIterator.isValid() ) {
+				const auto [position, velocity] = *groupIterator;
+				position += velocity;
+				position.step();
+				++groupIterator;
+			}
+		}, entityCount) };
+		double batchNanoseconds { bestNanosecondsPerEntity([&] {
+			groupPointer->forEachArchetype<Position, Velocity>(integrate);
+		}, entityCount) };
+		
+		float checksum { 0.0f };
+		groupPointer->forEachArchetype<Position>(
+			[&](Position* positions, std::size_t count) {
+				for( std::size_t i { 0 }; i < count; ++i ) {
+					checksum += positions[i].x;
+				}
+			}
+		);
+		std::cout << "  " << entityCount << " entities: group iterator "
+			<< iteratorNanoseconds << ", forEachArchetype " << batchNanoseconds
+			<< " (checksum " << checksum << ")\n";
+	}
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include <vector>
+
+#include "ECS/DataStorage.h"
+#include "ECS/TestComponents.h"
+#include "TestUtil.h"
+
+using namespace wasp::ecs;
+using namespace wasp::ecs::test;
+using wasp::test::check;
+
+namespace {
+	//Adds count entities spread over three archetypes, two of which have both a
+	//Position and a Velocity. Each entity's x position is its index.
+	std::vector<entity::EntityHandle> addEntities(DataStorage& dataStorage, int count) {
+		std::vector<entity::EntityHandle> handles {};
+		for( int i { 0 }; i < count; ++i ) {
+			Position position { wasp::math::Point2 { static_cast<float>(i), 0.0f } };
+			Velocity velocity { static_cast<float>(i % 7) + 0.5f, static_cast<float>(i * 13) };
+			if( i % 3 == 0 ) {
+				handles.push_back(dataStorage.addEntity(
+					AddEntityOrder { std::tuple { position, velocity } }
+				));
+			}
+			else if( i % 3 == 1 ) {
+				handles.push_back(dataStorage.addEntity(
+					AddEntityOrder { std::tuple { position, velocity, Marker {} } }
+				));
+			}
+			else {
+				handles.push_back(dataStorage.addEntity(
+					AddEntityOrder { std::tuple { position } }
+				));
+			}
+		}
+		return handles;
+	}
+	
+	void visitsEveryMatchingEntityOnce() {
+		DataStorage dataStorage { 1000, 50 };
+		addEntities(dataStorage, 300);
+		auto groupPointer { dataStorage.getGroupPointer<Position, Velocity>() };
+		
+		int archetypeCount { 0 };
+		std::size_t entityCount { 0 };
+		std::vector<bool> seen(300);
+		groupPointer->forEachArchetype<Position, Velocity>(
+			[&](Position* positions, Velocity* velocities, std::size_t count) {
+				++archetypeCount;
+				entityCount += count;
+				for( std::size_t i { 0 }; i < count; ++i ) {
+					int index { static_cast<int>(positions[i].x) };
+					check(index % 3 != 2, "only entities with a velocity");
+					check(!seen[index], "each entity once");
+					seen[index] = true;
+					//the arrays share one entity order
+					check(
+						velocities[i].getMagnitude() == static_cast<float>(index % 7) + 0.5f,
+						"velocity matches position"
+					);
+				}
+			}
+		);
+		check(archetypeCount == 2, "both archetypes with a velocity");
+		check(entityCount == 200, "every entity with a velocity");
+	}
+	
+	//the batch path must give exactly the result of the per entity iterator
+	void matchesGroupIterator() {
+		DataStorage batchStorage { 1000, 50 };
+		DataStorage iteratorStorage { 1000, 50 };
+		auto batchHandles { addEntities(batchStorage, 300) };
+		auto iteratorHandles { addEntities(iteratorStorage, 300) };
+		//holes in the dense arrays must not break the shared order
+		for( int i { 0 }; i < 300; i += 11 ) {
+			batchStorage.removeEntity({ batchHandles[i] });
+			iteratorStorage.removeEntity({ iteratorHandles[i] });
+		}
+		
+		for( int tick { 0 }; tick < 3; ++tick ) {
+			batchStorage.getGroupPointer<Position, Velocity>()
+				->forEachArchetype<Position, Velocity>(integrate);
+			
+			auto groupIterator {
+				iteratorStorage.getGroupPointer<Position, Velocity>()
+					->groupIterator<Position, Velocity>()
+			};
+			while( groupIterator.isValid() ) {
+				const auto [position, velocity] = *groupIterator;
+				position += velocity;
+				position.step();
+				++groupIterator;
+			}
+		}
+		
+		for( std::size_t i { 0 }; i < batchHandles.size(); ++i ) {
+			if( !batchStorage.isAlive(batchHandles[i]) ) {
+				continue;
+			}
+			const auto& batchPosition { batchStorage.getComponent<Position>(batchHandles[i]) };
+			const auto& iteratorPosition {
+				iteratorStorage.getComponent<Position>(iteratorHandles[i])
+			};
+			check(batchPosition.x == iteratorPosition.x, "same x");
+			check(batchPosition.y == iteratorPosition.y, "same y");
+		}
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "visitsEveryMatchingEntityOnce", visitsEveryMatchingEntityOnce },
+		{ "matchesGroupIterator", matchesGroupIterator }
+	});
+}
\ No newline at end of file
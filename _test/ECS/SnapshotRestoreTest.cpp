@@ -0,0 +1,146 @@
+#include <vector>
+
+#include "ECS/DataStorage.h"
+#include "ECS/TestComponents.h"
+#include "TestUtil.h"
+
+using namespace wasp::ecs;
+using namespace wasp::ecs::test;
+using wasp::test::check;
+
+namespace {
+	using EntityHandle = entity::EntityHandle;
+
+	Position makePosition(int i) {
+		return Position { wasp::math::Point2 { static_cast<float>(i), 0.0f } };
+	}
+
+	//Adds count entities over two archetypes, each odd entity the child of the one
+	//before it.
+	std::vector<EntityHandle> addEntities(DataStorage& dataStorage, int count) {
+		std::vector<EntityHandle> handles {};
+		for( int i { 0 }; i < count; ++i ) {
+			if( i % 2 == 0 ) {
+				handles.push_back(dataStorage.addEntity(
+					AddEntityOrder { std::tuple { makePosition(i) } }
+				));
+			}
+			else {
+				handles.push_back(dataStorage.addEntity(
+					AddEntityOrder {
+						std::tuple { makePosition(i), Velocity { 1.0f, 0.0f } }
+					}
+				));
+				dataStorage.setParent(handles[i], handles[i - 1]);
+			}
+		}
+		return handles;
+	}
+
+	//Adds entities until one is given the entity ID, and returns its handle. The
+	//others are removed again, so that the free IDs wrap around.
+	EntityHandle addUntilReused(DataStorage& dataStorage, entity::EntityID entityID) {
+		for( int i { 0 }; i < 1000; ++i ) {
+			EntityHandle handle {
+				dataStorage.addEntity(AddEntityOrder { std::tuple { makePosition(-i) } })
+			};
+			if( handle.entityID == entityID ) {
+				return handle;
+			}
+			dataStorage.removeEntity({ handle });
+		}
+		check(false, "entity ID reused");
+		return {};
+	}
+
+	void restoresHash() {
+		DataStorage dataStorage { 100, 20 };
+		auto handles { addEntities(dataStorage, 40) };
+		const std::uint64_t hash { dataStorage.getHash() };
+		DataStorageSnapshot snapshot {};
+		dataStorage.snapshot(snapshot);
+
+		//change values, archetypes, relations and which entities live
+		dataStorage.setComponent<Position>({ handles[0], makePosition(100) });
+		dataStorage.addComponent<Marker>({ handles[2], Marker {} });
+		dataStorage.removeComponent<Velocity>({ handles[3] });
+		dataStorage.removeParent(handles[5]);
+		dataStorage.removeEntity({ handles[6] });
+		addEntities(dataStorage, 10);
+		check(dataStorage.getHash() != hash, "mutations change the hash");
+
+		dataStorage.restore(snapshot);
+		check(dataStorage.getHash() == hash, "restored hash matches");
+		check(
+			dataStorage.getComponent<Position>(handles[0]).x == 0.0f,
+			"restored component value"
+		);
+		check(dataStorage.containsComponent<Velocity>(handles[3]), "restored archetype");
+		check(dataStorage.getParent(handles[5]).has_value(), "restored relation");
+		check(dataStorage.isAlive(handles[6]), "restored entity");
+
+		//restoring twice from one snapshot gives the same result
+		addEntities(dataStorage, 10);
+		dataStorage.restore(snapshot);
+		check(dataStorage.getHash() == hash, "restored again");
+	}
+
+	void killsHandlesMadeAfterSnapshot() {
+		DataStorage dataStorage { 16, 20 };
+		auto handles { addEntities(dataStorage, 6) };
+		DataStorageSnapshot snapshot {};
+		dataStorage.snapshot(snapshot);
+
+		//the new entity takes the removed one's ID
+		dataStorage.removeEntity({ handles[4] });
+		EntityHandle reusedHandle { addUntilReused(dataStorage, handles[4].entityID) };
+		auto newHandles { addEntities(dataStorage, 4) };
+
+		dataStorage.restore(snapshot);
+		check(dataStorage.isAlive(handles[4]), "snapshot handle alive");
+		check(dataStorage.isDead(reusedHandle), "handle on a reused ID dead");
+		for( const EntityHandle& handle : newHandles ) {
+			check(dataStorage.isDead(handle), "new handle dead");
+		}
+
+		//and stay dead once the restored storage hands their IDs out again
+		for( const EntityHandle& handle : newHandles ) {
+			EntityHandle handleAfter { addUntilReused(dataStorage, handle.entityID) };
+			check(handleAfter.generation != handle.generation, "fresh generation");
+			check(dataStorage.isDead(handle), "old handle still dead");
+		}
+	}
+
+	void givesRestoredEntityFreshGenerationOnDeath() {
+		DataStorage dataStorage { 16, 20 };
+		auto handles { addEntities(dataStorage, 6) };
+		const EntityHandle handle { handles[2] };
+		DataStorageSnapshot snapshot {};
+		dataStorage.snapshot(snapshot);
+
+		//issue a newer generation on the same ID, then roll it back
+		dataStorage.removeEntity({ handle });
+		EntityHandle newerHandle { addUntilReused(dataStorage, handle.entityID) };
+		check(newerHandle.generation > handle.generation, "newer generation");
+		dataStorage.restore(snapshot);
+		check(dataStorage.isAlive(handle), "restored entity alive");
+
+		//the restored entity dies again; its ID must skip every generation issued
+		dataStorage.removeEntity({ handle });
+		EntityHandle handleAfter { addUntilReused(dataStorage, handle.entityID) };
+		check(handleAfter.generation > newerHandle.generation, "past every issued");
+		check(dataStorage.isDead(handle), "restored handle dead");
+		check(dataStorage.isDead(newerHandle), "newer handle dead");
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "restoresHash", restoresHash },
+		{ "killsHandlesMadeAfterSnapshot", killsHandlesMadeAfterSnapshot },
+		{
+			"givesRestoredEntityFreshGenerationOnDeath",
+			givesRestoredEntityFreshGenerationOnDeath
+		}
+	});
+}
\ No newline at end of file
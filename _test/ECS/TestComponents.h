@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+
+#include "Game/Components/TwoFramePosition.h"
+#include "Math/PolarVector.h"
+
+//the same shapes as the game's Position and Velocity, which pull in the whole game
+namespace wasp::ecs::test {
+	
+	struct Position : game::components::TwoFramePosition {
+		using game::components::TwoFramePosition::TwoFramePosition;
+	};
+	
+	struct Velocity : math::PolarVector {
+		using math::PolarVector::PolarVector;
+	};
+	
+	struct Marker {};
+	
+	//what VelocitySystem runs over each archetype
+	inline void integrate(Position* positions, const Velocity* velocities, std::size_t count) {
+		for( std::size_t i { 0 }; i < count; ++i ) {
+			positions[i] += static_cast<math::Vector2>(velocities[i]);
+			positions[i].step();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,234 @@
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+
+#include "Game/Systems/SpatialGrid.h"
+#include "TestUtil.h"
+
+using process::game::systems::SpatialGrid;
+using wasp::math::AABB;
+using wasp::math::Point2;
+using wasp::math::Vector2;
+using wasp::test::check;
+
+namespace {
+	using Grid = SpatialGrid<int>;
+	using Entry = Grid::Entry;
+
+	//a width and height which are not multiples of the cell size, so the last
+	//column and row hang past the bounds
+	const AABB bounds{ 0.0f, 100.0f, 0.0f, 60.0f };
+	constexpr float cellSize{ 7.0f };
+	constexpr int queryCount{ 2000 };
+
+	//a fixed xorshift so every run makes the same points and queries
+	class Generator {
+	private:
+		std::uint32_t state{ 0x9E3779B9u };
+	public:
+		float next(float min, float max) {
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return min + (max - min) * static_cast<float>(state % 100001u) / 100000.0f;
+		}
+	};
+
+	//queries reach well past the bounds, where the grid clamps to its edge cells
+	Point2 makeCenter(Generator& generator) {
+		return { generator.next(-80.0f, 180.0f), generator.next(-80.0f, 140.0f) };
+	}
+
+	bool accept(const Entry& entry) {
+		return entry.id % 3 != 0;
+	}
+
+	float getDistanceSquared(const Point2& a, const Point2& b) {
+		float x{ b.x - a.x };
+		float y{ b.y - a.y };
+		return x * x + y * y;
+	}
+
+	//Fills the grid and returns the points it should keep: random points spread
+	//past the bounds, and points on each edge and corner.
+	std::vector<Entry> fill(Grid& grid, Generator& generator) {
+		std::vector<Point2> points{
+			{ 0.0f, 0.0f }, { 100.0f, 60.0f }, { 0.0f, 60.0f }, { 100.0f, 0.0f },
+			{ 50.0f, 0.0f }, { 50.0f, 60.0f }, { 0.0f, 30.0f }, { 100.0f, 30.0f },
+			{ 49.0f, 28.0f }, { 49.0f, 28.0f }	//two in one place
+		};
+		for (int i{ 0 }; i < 600; ++i) {
+			float x{ generator.next(-20.0f, 120.0f) };
+			points.push_back({ x, generator.next(-20.0f, 80.0f) });
+		}
+		std::vector<Entry> kept{};
+		for (int i{ 0 }; i < static_cast<int>(points.size()); ++i) {
+			grid.insert(i, points[i]);
+			if (wasp::math::isPointWithinAABB(points[i], bounds)) {
+				kept.push_back({ i, points[i] });
+			}
+		}
+		grid.build();
+		return kept;
+	}
+
+	std::vector<int> sorted(std::vector<int> ids) {
+		std::sort(ids.begin(), ids.end());
+		return ids;
+	}
+
+	void dropsPointsOutsideBounds() {
+		Grid grid{ bounds, cellSize };
+		check(grid.isEmpty(), "empty before insert");
+		Generator generator{};
+		auto kept{ fill(grid, generator) };
+		check(grid.size() == kept.size(), "kept every point in bounds");
+		check(kept.size() < 610, "dropped some points");
+
+		//a cleared grid is refilled from scratch
+		grid.clear();
+		check(grid.isEmpty(), "empty after clear");
+		check(grid.findNearest({ 50.0f, 30.0f }, 1000.0f, accept) == nullptr, "nothing");
+		Generator sameGenerator{};
+		fill(grid, sameGenerator);
+		check(grid.size() == kept.size(), "refilled");
+	}
+
+	void findNearestMatchesBruteForce() {
+		Grid grid{ bounds, cellSize };
+		Generator generator{};
+		auto kept{ fill(grid, generator) };
+		for (int i{ 0 }; i < queryCount; ++i) {
+			Point2 center{ makeCenter(generator) };
+			float maxDistance{ generator.next(0.0f, 250.0f) };
+
+			const Entry* expectedPointer{ nullptr };
+			float expectedDistanceSquared{ maxDistance * maxDistance };
+			for (const Entry& entry : kept) {
+				float distanceSquared{ getDistanceSquared(center, entry.position) };
+				if (distanceSquared <= expectedDistanceSquared && accept(entry)) {
+					expectedPointer = &entry;
+					expectedDistanceSquared = distanceSquared;
+				}
+			}
+
+			const Entry* foundPointer{ grid.findNearest(center, maxDistance, accept) };
+			check((foundPointer == nullptr) == (expectedPointer == nullptr), "found");
+			if (foundPointer) {
+				//ties may go to either entry
+				check(
+					getDistanceSquared(center, foundPointer->position)
+						== expectedDistanceSquared,
+					"nearest distance"
+				);
+				check(accept(*foundPointer), "accepted");
+			}
+		}
+	}
+
+	void forEachInRadiusMatchesBruteForce() {
+		Grid grid{ bounds, cellSize };
+		Generator generator{};
+		auto kept{ fill(grid, generator) };
+		for (int i{ 0 }; i < queryCount; ++i) {
+			Point2 center{ makeCenter(generator) };
+			float radius{ generator.next(0.0f, 120.0f) };
+
+			std::vector<int> expected{};
+			for (const Entry& entry : kept) {
+				if (getDistanceSquared(center, entry.position) <= radius * radius) {
+					expected.push_back(entry.id);
+				}
+			}
+			std::vector<int> found{};
+			grid.forEachInRadius(center, radius, [&](const Entry& entry) {
+				found.push_back(entry.id);
+			});
+			check(sorted(found) == sorted(expected), "entries in radius");
+			check(grid.countInRadius(center, radius) == expected.size(), "radius count");
+		}
+	}
+
+	void forEachInBoxMatchesBruteForce() {
+		Grid grid{ bounds, cellSize };
+		Generator generator{};
+		auto kept{ fill(grid, generator) };
+		for (int i{ 0 }; i < queryCount; ++i) {
+			Point2 corner{ makeCenter(generator) };
+			AABB box{
+				corner.x,
+				corner.x + generator.next(0.0f, 120.0f),
+				corner.y,
+				corner.y + generator.next(0.0f, 120.0f)
+			};
+
+			std::vector<int> expected{};
+			for (const Entry& entry : kept) {
+				if (wasp::math::isPointWithinAABB(entry.position, box)) {
+					expected.push_back(entry.id);
+				}
+			}
+			std::vector<int> found{};
+			grid.forEachInBox(box, [&](const Entry& entry) {
+				found.push_back(entry.id);
+			});
+			check(sorted(found) == sorted(expected), "entries in box");
+			check(grid.countInBox(box) == expected.size(), "box count");
+		}
+	}
+
+	void findFirstAlongRayMatchesBruteForce() {
+		Grid grid{ bounds, cellSize };
+		Generator generator{};
+		auto kept{ fill(grid, generator) };
+		for (int i{ 0 }; i < queryCount; ++i) {
+			Point2 origin{ makeCenter(generator) };
+			float angle{ generator.next(0.0f, 6.2832f) };
+			Vector2 direction{ std::cos(angle), std::sin(angle) };
+			float length{ generator.next(0.0f, 250.0f) };
+			float halfWidth{ generator.next(0.0f, 12.0f) };
+
+			const Entry* expectedPointer{ nullptr };
+			float expectedAlong{ length };
+			for (const Entry& entry : kept) {
+				float offsetX{ entry.position.x - origin.x };
+				float offsetY{ entry.position.y - origin.y };
+				float along{ offsetX * direction.x + offsetY * direction.y };
+				float across{ offsetX * direction.y - offsetY * direction.x };
+				if (along >= 0.0f
+					&& along <= expectedAlong
+					&& std::abs(across) <= halfWidth
+					&& accept(entry)
+				) {
+					expectedPointer = &entry;
+					expectedAlong = along;
+				}
+			}
+
+			const Entry* foundPointer{
+				grid.findFirstAlongRay(origin, direction, length, halfWidth, accept)
+			};
+			check((foundPointer == nullptr) == (expectedPointer == nullptr), "hit");
+			if (foundPointer) {
+				//ties may go to either entry
+				float offsetX{ foundPointer->position.x - origin.x };
+				float offsetY{ foundPointer->position.y - origin.y };
+				check(
+					offsetX * direction.x + offsetY * direction.y == expectedAlong,
+					"first along ray"
+				);
+			}
+		}
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "dropsPointsOutsideBounds", dropsPointsOutsideBounds },
+		{ "findNearestMatchesBruteForce", findNearestMatchesBruteForce },
+		{ "forEachInRadiusMatchesBruteForce", forEachInRadiusMatchesBruteForce },
+		{ "forEachInBoxMatchesBruteForce", forEachInBoxMatchesBruteForce },
+		{ "findFirstAlongRayMatchesBruteForce", findFirstAlongRayMatchesBruteForce }
+	});
+}
\ No newline at end of file
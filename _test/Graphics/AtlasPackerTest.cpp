@@ -0,0 +1,102 @@
+#include <cstdint>
+#include <vector>
+
+#include "Graphics/AtlasPacker.h"
+#include "TestUtil.h"
+
+using process::graphics::AtlasPacker;
+using process::graphics::AtlasPlacement;
+using wasp::test::check;
+
+namespace {
+	constexpr unsigned int pageSize{ 1024 };
+	constexpr unsigned int padding{ 1 };
+	
+	//a fixed xorshift so every run packs the same rectangles
+	class SizeGenerator {
+	private:
+		std::uint32_t state{ 0x2545F491u };
+	public:
+		unsigned int next(unsigned int min, unsigned int max) {
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return min + state % (max - min + 1);
+		}
+	};
+	
+	//sprite sized rectangles, a font's worth of glyphs, and one too large for a page
+	void makeSizes(std::vector<unsigned int>& widths, std::vector<unsigned int>& heights) {
+		SizeGenerator sizeGenerator{};
+		for(int i{ 0 }; i < 400; ++i){
+			widths.push_back(sizeGenerator.next(8, 128));
+			heights.push_back(sizeGenerator.next(8, 128));
+		}
+		for(int i{ 0 }; i < 200; ++i){
+			widths.push_back(sizeGenerator.next(4, 16));
+			heights.push_back(16);
+		}
+		widths.push_back(pageSize + 1);
+		heights.push_back(32);
+	}
+	
+	void placementsFitWithoutOverlap() {
+		std::vector<unsigned int> widths{};
+		std::vector<unsigned int> heights{};
+		makeSizes(widths, heights);
+		AtlasPacker atlasPacker{ pageSize, pageSize, padding };
+		std::vector<AtlasPlacement> placements{ atlasPacker.pack(widths, heights) };
+		check(placements.size() == widths.size(), "one placement per rectangle");
+		
+		std::vector<unsigned long long> pageAreas(atlasPacker.getPageCount());
+		for(std::size_t i{ 0 }; i < placements.size(); ++i){
+			const AtlasPlacement& placement{ placements[i] };
+			if(!placement.packed){
+				check(widths[i] > pageSize || heights[i] > pageSize, "only oversize is unpacked");
+				continue;
+			}
+			check(placement.x + widths[i] <= pageSize, "inside the page horizontally");
+			check(placement.y + heights[i] <= pageSize, "inside the page vertically");
+			pageAreas[placement.page] += widths[i] * heights[i];
+			
+			for(std::size_t j{ 0 }; j < i; ++j){
+				const AtlasPlacement& other{ placements[j] };
+				if(!other.packed || other.page != placement.page){
+					continue;
+				}
+				//rectangles must stay padding apart so filtering never bleeds
+				bool apart{
+					placement.x >= other.x + widths[j] + padding
+						|| other.x >= placement.x + widths[i] + padding
+						|| placement.y >= other.y + heights[j] + padding
+						|| other.y >= placement.y + heights[i] + padding
+				};
+				check(apart, "rectangles do not overlap");
+			}
+		}
+		for(std::size_t page{ 0 }; page < atlasPacker.getPageCount(); ++page){
+			check(atlasPacker.getOccupancy(page).usedArea == pageAreas[page], "used area");
+		}
+		check(placements.back().packed == false, "oversize rectangle is left unpacked");
+	}
+	
+	void packingIsRepeatable() {
+		std::vector<unsigned int> widths{};
+		std::vector<unsigned int> heights{};
+		makeSizes(widths, heights);
+		AtlasPacker atlasPacker{ pageSize, pageSize, padding };
+		std::vector<AtlasPlacement> first{ atlasPacker.pack(widths, heights) };
+		std::vector<AtlasPlacement> second{ atlasPacker.pack(widths, heights) };
+		for(std::size_t i{ 0 }; i < first.size(); ++i){
+			check(first[i].page == second[i].page, "same page");
+			check(first[i].x == second[i].x && first[i].y == second[i].y, "same position");
+		}
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "placementsFitWithoutOverlap", placementsFitWithoutOverlap },
+		{ "packingIsRepeatable", packingIsRepeatable }
+	});
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "Graphics/DrawCommand.h"
+#include "TestUtil.h"
+
+using process::graphics::DrawCommand;
+using process::graphics::DrawCommandList;
+using wasp::test::check;
+
+namespace {
+	//stands in for a texture; only its address is used
+	struct FakeTexture {};
+	FakeTexture firstTexture{};
+	FakeTexture secondTexture{};
+	
+	ID3D11ShaderResourceView* toTextureView(FakeTexture& fakeTexture) {
+		return reinterpret_cast<ID3D11ShaderResourceView*>(&fakeTexture);
+	}
+	
+	//Builds a command in storage filled with the given byte, so any padding the
+	//command has holds that byte. Each field is set on its own; x marks the command.
+	DrawCommand makeDrawCommand(
+		int depth,
+		float x,
+		ID3D11ShaderResourceView* textureView,
+		unsigned char fillByte
+	) {
+		alignas(DrawCommand) unsigned char storage[sizeof(DrawCommand)];
+		std::memset(storage, fillByte, sizeof(storage));
+		DrawCommand* drawCommandPointer{ new(storage) DrawCommand };
+		drawCommandPointer->drawType = DrawCommand::DrawType::sprite;
+		drawCommandPointer->depth = depth;
+		drawCommandPointer->textureView = textureView;
+		drawCommandPointer->textureWidth = 32;
+		drawCommandPointer->textureHeight = 16;
+		drawCommandPointer->pastX = x - 1.0f;
+		drawCommandPointer->pastY = 2.0f;
+		drawCommandPointer->x = x;
+		drawCommandPointer->y = 3.0f;
+		drawCommandPointer->offsetX = 0.0f;
+		drawCommandPointer->offsetY = 0.0f;
+		drawCommandPointer->rotation = 0.0f;
+		drawCommandPointer->scale = 1.0f;
+		drawCommandPointer->rectX = 0.0f;
+		drawCommandPointer->rectY = 0.0f;
+		drawCommandPointer->rectWidth = 0.0f;
+		drawCommandPointer->rectHeight = 0.0f;
+		drawCommandPointer->pixelOffsetX = 0.0f;
+		drawCommandPointer->pixelOffsetY = 0.0f;
+		drawCommandPointer->atlasULow = 0.0f;
+		drawCommandPointer->atlasVLow = 0.0f;
+		drawCommandPointer->atlasUHigh = 1.0f;
+		drawCommandPointer->atlasVHigh = 1.0f;
+		return *drawCommandPointer;
+	}
+	
+	//two scenes, each added out of depth order with ties
+	DrawCommandList makeDrawCommandList(unsigned char fillByte) {
+		DrawCommandList drawCommandList{};
+		ID3D11ShaderResourceView* first{ toTextureView(firstTexture) };
+		ID3D11ShaderResourceView* second{ toTextureView(secondTexture) };
+		drawCommandList.add(makeDrawCommand(5, 0.0f, first, fillByte));
+		drawCommandList.add(makeDrawCommand(-3, 1.0f, second, fillByte));
+		drawCommandList.add(makeDrawCommand(5, 2.0f, second, fillByte));
+		drawCommandList.add(makeDrawCommand(0, 3.0f, first, fillByte));
+		drawCommandList.endScene();
+		drawCommandList.add(makeDrawCommand(1, 4.0f, first, fillByte));
+		drawCommandList.add(makeDrawCommand(-1, 5.0f, first, fillByte));
+		drawCommandList.endScene();
+		return drawCommandList;
+	}
+	
+	void sortsEachSceneByDepth() {
+		DrawCommandList drawCommandList{ makeDrawCommandList(0) };
+		check(drawCommandList.getSceneCount() == 2, "two scenes");
+		
+		//equal depths keep the order they were added in
+		std::vector<float> expectedFirstScene{ 1.0f, 3.0f, 0.0f, 2.0f };
+		const DrawCommand* itr{ drawCommandList.sceneBegin(0) };
+		check(drawCommandList.sceneEnd(0) - itr == 4, "first scene size");
+		for(float expectedX : expectedFirstScene){
+			check(itr->x == expectedX, "first scene order");
+			++itr;
+		}
+		
+		//scenes are sorted separately
+		itr = drawCommandList.sceneBegin(1);
+		check(drawCommandList.sceneEnd(1) - itr == 2, "second scene size");
+		check(itr[0].x == 5.0f && itr[1].x == 4.0f, "second scene order");
+	}
+	
+	void equalListsHashEqual() {
+		check(
+			makeDrawCommandList(0).hash() == makeDrawCommandList(0).hash(),
+			"same list, same hash"
+		);
+		//padding holds whatever was there before
+		DrawCommandList zeroPaddedList{ makeDrawCommandList(0x00) };
+		DrawCommandList otherPaddedList{ makeDrawCommandList(0xAB) };
+		check(
+			std::memcmp(
+				zeroPaddedList.getDrawCommands().data(),
+				otherPaddedList.getDrawCommands().data(),
+				zeroPaddedList.getDrawCommands().size() * sizeof(DrawCommand)
+			) != 0,
+			"padding differs"
+		);
+		check(zeroPaddedList.hash() == otherPaddedList.hash(), "padding ignored");
+		
+		//texture identity differs between runs, so it is left out
+		DrawCommandList drawCommandList{};
+		drawCommandList.add(makeDrawCommand(0, 0.0f, toTextureView(firstTexture), 0));
+		drawCommandList.endScene();
+		DrawCommandList otherTextureList{};
+		otherTextureList.add(makeDrawCommand(0, 0.0f, toTextureView(secondTexture), 0));
+		otherTextureList.endScene();
+		check(drawCommandList.hash() == otherTextureList.hash(), "texture ignored");
+	}
+	
+	void differentListsHashDifferent() {
+		std::uint64_t hash{ makeDrawCommandList(0).hash() };
+		ID3D11ShaderResourceView* first{ toTextureView(firstTexture) };
+		
+		DrawCommandList extendedList{ makeDrawCommandList(0) };
+		extendedList.add(makeDrawCommand(0, 0.0f, first, 0));
+		check(extendedList.hash() != hash, "extra command");
+		
+		//the same commands split into scenes differently
+		DrawCommandList oneScene{};
+		DrawCommandList twoScenes{};
+		for(DrawCommandList* drawCommandListPointer : { &oneScene, &twoScenes }){
+			drawCommandListPointer->add(makeDrawCommand(0, 0.0f, first, 0));
+			if(drawCommandListPointer == &twoScenes){
+				drawCommandListPointer->endScene();
+			}
+			drawCommandListPointer->add(makeDrawCommand(1, 1.0f, first, 0));
+			drawCommandListPointer->endScene();
+		}
+		check(oneScene.hash() != twoScenes.hash(), "scene boundaries");
+		
+		DrawCommandList nudgedList{};
+		DrawCommand drawCommand{ makeDrawCommand(0, 0.0f, first, 0) };
+		DrawCommandList unnudgedList{};
+		unnudgedList.add(drawCommand);
+		unnudgedList.endScene();
+		drawCommand.atlasVHigh = 0.5f;
+		nudgedList.add(drawCommand);
+		nudgedList.endScene();
+		check(nudgedList.hash() != unnudgedList.hash(), "last field");
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "sortsEachSceneByDepth", sortsEachSceneByDepth },
+		{ "equalListsHashEqual", equalListsHashEqual },
+		{ "differentListsHashDifferent", differentListsHashDifferent }
+	});
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+#include <cmath>
+#include <vector>
+
+#include "Graphics/SpriteBatcher.h"
+#include "TestUtil.h"
+
+using process::graphics::DrawCommand;
+using process::graphics::SpriteBatch;
+using process::graphics::SpriteBatcher;
+using process::graphics::SpriteInstance;
+using wasp::test::check;
+
+namespace {
+	constexpr int graphicsWidth{ 400 };
+	constexpr int graphicsHeight{ 200 };
+	
+	//stands in for a texture; only its address is used
+	struct FakeTexture {};
+	FakeTexture firstTexture{};
+	FakeTexture secondTexture{};
+	
+	ID3D11ShaderResourceView* toTextureView(FakeTexture& fakeTexture) {
+		return reinterpret_cast<ID3D11ShaderResourceView*>(&fakeTexture);
+	}
+	
+	bool near(float left, float right) {
+		return std::abs(left - right) < 1e-5f;
+	}
+	
+	//a 40 by 20 sprite centered at (x, y)
+	DrawCommand makeDrawCommand(int depth, float x, float y, FakeTexture& fakeTexture) {
+		return {
+			DrawCommand::DrawType::sprite,
+			depth,
+			toTextureView(fakeTexture),
+			40, 20,
+			x, y,			//past
+			x, y,
+			0.0f, 0.0f,		//offset
+			0.0f,			//rotation
+			1.0f,			//scale
+			0.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 0.0f,
+			0.0f, 0.0f, 1.0f, 1.0f
+		};
+	}
+	
+	void checkBatch(
+		const SpriteBatch& spriteBatch,
+		FakeTexture& fakeTexture,
+		std::uint32_t firstInstance,
+		std::uint32_t instanceCount
+	) {
+		check(spriteBatch.textureView == toTextureView(fakeTexture), "batch texture");
+		check(spriteBatch.firstInstance == firstInstance, "batch first instance");
+		check(spriteBatch.instanceCount == instanceCount, "batch instance count");
+	}
+	
+	void batchesConsecutiveTextures() {
+		std::vector<DrawCommand> drawCommands{
+			makeDrawCommand(0, 10.0f, 0.0f, firstTexture),
+			makeDrawCommand(1, 20.0f, 0.0f, firstTexture),
+			makeDrawCommand(2, 30.0f, 0.0f, secondTexture),
+			makeDrawCommand(3, 40.0f, 0.0f, secondTexture),
+			makeDrawCommand(3, 50.0f, 0.0f, secondTexture),
+			makeDrawCommand(4, 60.0f, 0.0f, firstTexture)
+		};
+		SpriteBatcher spriteBatcher{ graphicsWidth, graphicsHeight };
+		spriteBatcher.add(
+			drawCommands.data(),
+			drawCommands.data() + drawCommands.size(),
+			1.0f
+		);
+		
+		const auto& batches{ spriteBatcher.getBatches() };
+		check(batches.size() == 3, "a batch per texture change");
+		checkBatch(batches[0], firstTexture, 0, 2);
+		checkBatch(batches[1], secondTexture, 2, 3);
+		checkBatch(batches[2], firstTexture, 5, 1);
+		check(spriteBatcher.getInstances().size() == 6, "an instance per command");
+		
+		//clearing starts over
+		spriteBatcher.clear();
+		check(spriteBatcher.getBatches().empty(), "no batches");
+		check(spriteBatcher.getInstances().empty(), "no instances");
+	}
+	
+	//the first of two equal depths drawn shows where they overlap, so submission order
+	//is kept even when that splits a texture over several batches
+	void keepsOrderWithinEqualDepth() {
+		std::vector<DrawCommand> drawCommands{
+			makeDrawCommand(5, 10.0f, 0.0f, firstTexture),
+			makeDrawCommand(5, 20.0f, 0.0f, secondTexture),
+			makeDrawCommand(5, 30.0f, 0.0f, firstTexture)
+		};
+		SpriteBatcher spriteBatcher{ graphicsWidth, graphicsHeight };
+		spriteBatcher.add(
+			drawCommands.data(),
+			drawCommands.data() + drawCommands.size(),
+			1.0f
+		);
+		
+		const auto& batches{ spriteBatcher.getBatches() };
+		check(batches.size() == 3, "not regrouped by texture");
+		checkBatch(batches[0], firstTexture, 0, 1);
+		checkBatch(batches[1], secondTexture, 1, 1);
+		checkBatch(batches[2], firstTexture, 2, 1);
+		
+		const auto& instances{ spriteBatcher.getInstances() };
+		for(std::size_t i{ 0 }; i < drawCommands.size(); ++i){
+			float expectedX{ (drawCommands[i].x / (graphicsWidth / 2.0f)) - 1.0f };
+			check(near(instances[i].translation[0], expectedX), "instance order");
+		}
+	}
+	
+	void transformsSprites() {
+		SpriteBatcher spriteBatcher{ graphicsWidth, graphicsHeight };
+		
+		//halfway between past and present, shifted by the offset
+		DrawCommand drawCommand{ makeDrawCommand(2000, 300.0f, 50.0f, firstTexture) };
+		drawCommand.pastX = 100.0f;
+		drawCommand.pastY = 150.0f;
+		drawCommand.offsetX = 10.0f;
+		drawCommand.offsetY = -10.0f;
+		drawCommand.scale = 2.0f;
+		drawCommand.atlasULow = 0.25f;
+		drawCommand.atlasVLow = 0.5f;
+		drawCommand.atlasUHigh = 0.75f;
+		drawCommand.atlasVHigh = 1.0f;
+		spriteBatcher.add(drawCommand, 0.5f);
+		
+		const SpriteInstance& instance{ spriteBatcher.getInstances()[0] };
+		check(near(instance.transform[0], 0.2f), "width scale");
+		check(near(instance.transform[1], 0.0f), "no xy shear");
+		check(near(instance.transform[2], 0.0f), "no yx shear");
+		check(near(instance.transform[3], 0.2f), "height scale");
+		//center (210, 90) in a 400 by 200 target
+		check(near(instance.translation[0], 0.05f), "ndc x");
+		check(near(instance.translation[1], 0.1f), "ndc y");
+		check(
+			near(instance.translation[2], 2000.0f / DrawCommand::depthRange),
+			"depth shift"
+		);
+		check(
+			instance.uvRect[0] == 0.0f && instance.uvRect[1] == 0.0f
+				&& instance.uvRect[2] == 1.0f && instance.uvRect[3] == 1.0f,
+			"whole sprite"
+		);
+		check(
+			instance.atlasRect[0] == 0.25f && instance.atlasRect[1] == 0.5f
+				&& instance.atlasRect[2] == 0.75f && instance.atlasRect[3] == 1.0f,
+			"atlas rect"
+		);
+		check(instance.tiling == 0.0f, "not tiled");
+		
+		//a quarter turn maps x onto y, corrected for the 2:1 aspect
+		spriteBatcher.clear();
+		drawCommand.rotation = 90.0f;
+		drawCommand.scale = 1.0f;
+		spriteBatcher.add(drawCommand, 1.0f);
+		const SpriteInstance& rotated{ spriteBatcher.getInstances()[0] };
+		check(near(rotated.transform[0], 0.0f), "rotated xx");
+		check(near(rotated.transform[1], 0.2f), "rotated xy");
+		check(near(rotated.transform[2], -0.05f), "rotated yx");
+		check(near(rotated.transform[3], 0.0f), "rotated yy");
+	}
+	
+	void mapsSubAndTileSprites() {
+		SpriteBatcher spriteBatcher{ graphicsWidth, graphicsHeight };
+		
+		//the right half of the sprite's top row, drawn where it lies in the sprite
+		DrawCommand subSprite{ makeDrawCommand(0, 100.0f, 100.0f, firstTexture) };
+		subSprite.drawType = DrawCommand::DrawType::subSprite;
+		subSprite.rectX = 20.0f;
+		subSprite.rectY = 0.0f;
+		subSprite.rectWidth = 20.0f;
+		subSprite.rectHeight = 10.0f;
+		spriteBatcher.add(subSprite, 1.0f);
+		const SpriteInstance& subInstance{ spriteBatcher.getInstances()[0] };
+		check(
+			near(subInstance.uvRect[0], 0.5f) && near(subInstance.uvRect[1], 0.0f)
+				&& near(subInstance.uvRect[2], 1.0f) && near(subInstance.uvRect[3], 0.5f),
+			"sub sprite uvs"
+		);
+		check(near(subInstance.transform[0], 0.05f), "sub sprite width");
+		check(near(subInstance.transform[3], 0.05f), "sub sprite height");
+		//center (110, 95)
+		check(near(subInstance.translation[0], -0.45f), "sub sprite ndc x");
+		check(near(subInstance.translation[1], 0.05f), "sub sprite ndc y");
+		
+		//a sub sprite too small to see draws nothing
+		subSprite.rectWidth = 0.25f;
+		subSprite.rectHeight = 0.25f;
+		spriteBatcher.add(subSprite, 1.0f);
+		check(spriteBatcher.getInstances().size() == 1, "tiny sub sprite skipped");
+		
+		//tiles cover the draw rectangle from the pixel offset on
+		DrawCommand tileSprite{ makeDrawCommand(0, 0.0f, 0.0f, secondTexture) };
+		tileSprite.drawType = DrawCommand::DrawType::tileSprite;
+		tileSprite.rectX = 0.0f;
+		tileSprite.rectY = 0.0f;
+		tileSprite.rectWidth = 400.0f;
+		tileSprite.rectHeight = 200.0f;
+		tileSprite.pixelOffsetX = 10.0f;
+		tileSprite.pixelOffsetY = 5.0f;
+		spriteBatcher.add(tileSprite, 1.0f);
+		const SpriteInstance& tileInstance{ spriteBatcher.getInstances()[1] };
+		check(
+			near(tileInstance.uvRect[0], 0.25f) && near(tileInstance.uvRect[1], 0.25f)
+				&& near(tileInstance.uvRect[2], 10.25f)
+				&& near(tileInstance.uvRect[3], 10.25f),
+			"tile uvs"
+		);
+		check(
+			near(tileInstance.transform[0], 1.0f) && near(tileInstance.transform[3], 1.0f),
+			"tiles cover the target"
+		);
+		check(
+			near(tileInstance.translation[0], 0.0f)
+				&& near(tileInstance.translation[1], 0.0f),
+			"tiles centered"
+		);
+		check(tileInstance.tiling == 1.0f, "tiled");
+		check(spriteBatcher.getBatches().size() == 2, "texture change");
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "batchesConsecutiveTextures", batchesConsecutiveTextures },
+		{ "keepsOrderWithinEqualDepth", keepsOrderWithinEqualDepth },
+		{ "transformsSprites", transformsSprites },
+		{ "mapsSubAndTileSprites", mapsSubAndTileSprites }
+	});
+}
\ No newline at end of file
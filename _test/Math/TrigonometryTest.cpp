@@ -0,0 +1,70 @@
+#include <cmath>
+#include <vector>
+
+#include "Math/Trigonometry.h"
+#include "TestUtil.h"
+
+using namespace wasp::math;
+using wasp::test::check;
+
+namespace {
+	constexpr double piDouble { 3.14159265358979323846 };
+	
+	double toRadiansDouble(double degrees) {
+		return degrees * piDouble / 180.0;
+	}
+	
+	//every angle in steps of 0.0001 degrees over ten turns each way
+	void sinCosWithinBound() {
+		double maxError { 0.0 };
+		for( long i { -36'000'000 }; i <= 36'000'000; ++i ) {
+			float degrees { static_cast<float>(i / 10'000.0) };
+			SinCos sinCos { sinCosDegrees(degrees) };
+			double radians { toRadiansDouble(degrees) };
+			maxError = std::fmax(maxError, std::fabs(sinCos.sin - std::sin(radians)));
+			maxError = std::fmax(maxError, std::fabs(sinCos.cos - std::cos(radians)));
+		}
+		check(maxError < 1e-7, "sin and cos are within 1e-7");
+	}
+	
+	void atan2WithinBound() {
+		double maxError { 0.0 };
+		for( int i { 0 }; i < 2'000'000; ++i ) {
+			double radians { -piDouble + 2.0 * piDouble * i / 2'000'000.0 };
+			float x { static_cast<float>(std::cos(radians)) };
+			float y { static_cast<float>(std::sin(radians)) };
+			double expected { std::atan2(static_cast<double>(y), static_cast<double>(x))
+				* 180.0 / piDouble };
+			double error { std::fabs(atan2Degrees(y, x) - expected) };
+			//+180 and -180 are the same angle
+			maxError = std::fmax(maxError, std::fmin(error, 360.0 - error));
+		}
+		check(maxError < 3e-5, "atan2 is within 3e-5 degrees");
+	}
+	
+	//the batch loop may be vectorized, but must round exactly as a single conversion
+	void batchMatchesSingle() {
+		constexpr std::size_t count { 10'007 };
+		std::vector<float> magnitudes(count);
+		std::vector<float> degrees(count);
+		for( std::size_t i { 0 }; i < count; ++i ) {
+			magnitudes[i] = 0.5f + static_cast<float>(i % 17);
+			degrees[i] = -1000.0f + static_cast<float>(i) * 0.2003f;
+		}
+		std::vector<Vector2> vectors(count);
+		toVector2s(magnitudes.data(), degrees.data(), vectors.data(), count);
+		for( std::size_t i { 0 }; i < count; ++i ) {
+			SinCos sinCos { sinCosDegrees(degrees[i]) };
+			check(vectors[i].x == magnitudes[i] * sinCos.cos, "batch x matches");
+			check(vectors[i].y == -1 * magnitudes[i] * sinCos.sin, "batch y matches");
+		}
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "sinCosWithinBound", sinCosWithinBound },
+		{ "atan2WithinBound", atan2WithinBound },
+		{ "batchMatchesSingle", batchMatchesSingle }
+	});
+}
\ No newline at end of file
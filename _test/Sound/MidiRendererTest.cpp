@@ -0,0 +1,83 @@
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "Sound/MidiRenderer.h"
+#include "Sound/TestSequences.h"
+#include "TestUtil.h"
+
+using namespace wasp::sound::midi;
+using namespace wasp::sound::midi::test;
+using wasp::test::check;
+
+namespace {
+	using namespace std::chrono_literals;
+	
+	//At 480 ticks per beat and the default 500000us per beat, 48 ticks take 50ms. The
+	//loop halves the tempo partway through, and the new tempo carries into every pass
+	//after the first, so the first pass takes 150ms and each one after it 125ms.
+	std::shared_ptr<MidiSequence> makeLoopingSequence() {
+		auto midiSequencePointer { std::make_shared<MidiSequence>() };
+		midiSequencePointer->ticks = 480;
+		appendShortMsg(*midiSequencePointer, 0, makeShortMsg(noteOn, 60, 100));
+		appendLoopPoint(*midiSequencePointer, 48);
+		appendShortMsg(*midiSequencePointer, 96, makeShortMsg(noteOn, 64, 100));
+		appendTempo(*midiSequencePointer, 0, 250'000);
+		appendShortMsg(*midiSequencePointer, 96, makeShortMsg(noteOff, 64, 0));
+		appendLoopPoint(*midiSequencePointer, 48);
+		return midiSequencePointer;
+	}
+	
+	void rendersTempoChangesAndLoops() {
+		MidiRenderer midiRenderer { 500ms };
+		midiRenderer.start(makeLoopingSequence());
+		
+		const std::vector<std::chrono::nanoseconds> expectedTimes {
+			0ms, 150ms, 200ms, 275ms, 325ms, 400ms, 450ms
+		};
+		const auto& renderedEvents { midiRenderer.getRenderedEvents() };
+		check(renderedEvents.size() == expectedTimes.size(), "event count");
+		for( std::size_t i { 0 }; i < expectedTimes.size(); ++i ) {
+			check(renderedEvents[i].time == expectedTimes[i], "event " + std::to_string(i));
+			check(!renderedEvents[i].isSystemExclusive, "only short messages");
+		}
+		check(renderedEvents[3].shortMsg == makeShortMsg(noteOn, 64, 100), "looped event");
+		check(midiRenderer.getLoopCount() == 3, "loop count");
+		check(midiRenderer.wasCutOff(), "cut off at the maximum length");
+		check(midiRenderer.getLength() == 450ms, "length");
+	}
+	
+	//a tick of a third of a beat is not a whole number of nanoseconds
+	void carriesTheRemainder() {
+		constexpr std::size_t eventCount { 3'000 };
+		auto midiSequencePointer { std::make_shared<MidiSequence>() };
+		midiSequencePointer->ticks = 3;
+		for( std::size_t i { 0 }; i < eventCount; ++i ) {
+			appendShortMsg(*midiSequencePointer, 1, makeShortMsg(noteOn, 60, 100));
+		}
+		MidiRenderer midiRenderer { 1h };
+		midiRenderer.start(midiSequencePointer);
+		
+		check(midiRenderer.getRenderedEvents().size() == eventCount, "event count");
+		check(!midiRenderer.wasCutOff(), "not cut off");
+		check(midiRenderer.getLoopCount() == 0, "no loops");
+		check(midiRenderer.getLength() == 500s, "no drift after every event");
+	}
+	
+	void stopDiscardsTheRender() {
+		MidiRenderer midiRenderer { 500ms };
+		midiRenderer.start(makeLoopingSequence());
+		midiRenderer.stop();
+		check(midiRenderer.getRenderedEvents().empty(), "no events");
+		check(midiRenderer.getLoopCount() == 0, "no loops");
+		check(!midiRenderer.wasCutOff(), "not cut off");
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "rendersTempoChangesAndLoops", rendersTempoChangesAndLoops },
+		{ "carriesTheRemainder", carriesTheRemainder },
+		{ "stopDiscardsTheRender", stopDiscardsTheRender }
+	});
+}
\ No newline at end of file
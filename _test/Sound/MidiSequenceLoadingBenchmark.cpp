@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Sound/MidiSequenceLoading.h"
+#include "Sound/TestMidiFiles.h"
+
+using namespace wasp::sound::midi;
+using namespace wasp::sound::midi::test;
+
+//Times the stream parser against the span parser over a synthetic soundtrack of 18
+//format 1 files with 6 to 16 tracks and 4 large format 0 files. The span parser reads
+//bytes already in memory, as it would from a mapped file whose pages are resident.
+namespace {
+	using clockType = std::chrono::steady_clock;
+	
+	constexpr int runCount { 30 };
+	
+	struct SoundtrackFile {
+		std::filesystem::path path {};
+		std::vector<uint8_t> bytes {};
+	};
+	
+	std::vector<SoundtrackFile> makeSoundtrack() {
+		std::vector<SoundtrackFile> soundtrack {};
+		std::filesystem::path directory {
+			std::filesystem::temp_directory_path() / "waspMidiSequenceLoadingBenchmark"
+		};
+		std::filesystem::create_directories(directory);
+		MidiFileBuilder midiFileBuilder { 17 };
+		for( int i { 0 }; i < 22; ++i ) {
+			SoundtrackFile soundtrackFile {};
+			if( i < 18 ) {
+				uint16_t trackCount { static_cast<uint16_t>(6 + (i * 10) / 17) };
+				soundtrackFile.bytes = midiFileBuilder.build(1, trackCount, 1'500);
+			}
+			else {
+				soundtrackFile.bytes = midiFileBuilder.build(0, 1, 60'000);
+			}
+			soundtrackFile.path = directory / ("track" + std::to_string(i) + ".mid");
+			std::ofstream outStream { soundtrackFile.path, std::ios::binary | std::ios::trunc };
+			outStream.write(
+				reinterpret_cast<const char*>(soundtrackFile.bytes.data()),
+				soundtrackFile.bytes.size()
+			);
+			soundtrack.push_back(std::move(soundtrackFile));
+		}
+		return soundtrack;
+	}
+	
+	template <typename Function>
+	double bestMilliseconds(Function&& function) {
+		double best { 1e30 };
+		for( int run { 0 }; run < runCount; ++run ) {
+			auto start { clockType::now() };
+			function();
+			std::chrono::duration<double, std::milli> elapsed { clockType::now() - start };
+			best = std::min(best, elapsed.count());
+		}
+		return best;
+	}
+}
+
+int main() {
+	std::vector<SoundtrackFile> soundtrack { makeSoundtrack() };
+	std::size_t totalBytes { 0 };
+	for( const auto& soundtrackFile : soundtrack ) {
+		totalBytes += soundtrackFile.bytes.size();
+	}
+	
+	std::size_t checksum { 0 };
+	double streamMilliseconds { bestMilliseconds([&] {
+		for( const auto& soundtrackFile : soundtrack ) {
+			checksum += parseMidiFile(soundtrackFile.path.wstring()).compiledTrack.size();
+		}
+	}) };
+	double spanMilliseconds { bestMilliseconds([&] {
+		for( const auto& soundtrackFile : soundtrack ) {
+			checksum += parseMidiData(
+				soundtrackFile.bytes.data(),
+				soundtrackFile.bytes.size()
+			).compiledTrack.size();
+		}
+	}) };
+	
+	std::cout << soundtrack.size() << " files, " << totalBytes << " bytes, best of "
+		<< runCount << " runs\n"
+		<< "  stream parser " << streamMilliseconds << " ms\n"
+		<< "  span parser   " << spanMilliseconds << " ms\n"
+		<< "  (checksum " << checksum << ")\n";
+	return 0;
+}
\ No newline at end of file
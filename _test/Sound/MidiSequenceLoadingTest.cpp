@@ -0,0 +1,99 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "Sound/MidiSequenceLoading.h"
+#include "Sound/TestMidiFiles.h"
+#include "TestUtil.h"
+
+using namespace wasp::sound::midi;
+using namespace wasp::sound::midi::test;
+using wasp::test::check;
+
+namespace {
+	//the stream parser reads from a file, so each input is written out first
+	std::filesystem::path writeTempFile(const std::vector<uint8_t>& bytes) {
+		std::filesystem::path path {
+			std::filesystem::temp_directory_path() / "waspMidiSequenceLoadingTest.mid"
+		};
+		std::ofstream outStream { path, std::ios::binary | std::ios::trunc };
+		outStream.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+		if( outStream.fail() ) {
+			throw std::runtime_error { "failed to write temp MIDI file" };
+		}
+		return path;
+	}
+	
+	bool isSame(const MidiSequence& left, const MidiSequence& right) {
+		return left.ticks == right.ticks
+			&& left.compiledTrack.size() == right.compiledTrack.size()
+			&& std::memcmp(
+				left.compiledTrack.data(),
+				right.compiledTrack.data(),
+				left.compiledTrack.size() * sizeof(MidiSequence::EventUnit)
+			) == 0;
+	}
+	
+	//the stream parser is the reference the span parser must match
+	void spanMatchesStream() {
+		MidiFileBuilder midiFileBuilder { 7 };
+		for( uint16_t trackCount : { 1, 2, 6, 16 } ) {
+			uint16_t format { static_cast<uint16_t>(trackCount == 1 ? 0 : 1) };
+			std::vector<uint8_t> bytes { midiFileBuilder.build(format, trackCount, 500) };
+			std::filesystem::path path { writeTempFile(bytes) };
+			
+			MidiSequence fromStream { parseMidiFile(path.wstring()) };
+			MidiSequence fromSpan { parseMidiData(bytes.data(), bytes.size()) };
+			check(!fromSpan.compiledTrack.empty(), "something is parsed");
+			check(isSame(fromStream, fromSpan), "same track for " + std::to_string(trackCount));
+		}
+	}
+	
+	void loopedSpanMatchesStream() {
+		MidiFileBuilder midiFileBuilder { 11 };
+		const std::pair<int64_t, int64_t> loopPoints[] {
+			{ 0, -1 }, { 2'000, -1 }, { 2'000, 60'000 }, { 0, 30'000 }
+		};
+		for( uint16_t trackCount : { 1, 8 } ) {
+			uint16_t format { static_cast<uint16_t>(trackCount == 1 ? 0 : 1) };
+			std::vector<uint8_t> bytes { midiFileBuilder.build(format, trackCount, 300) };
+			std::filesystem::path path { writeTempFile(bytes) };
+			for( const auto& [loopStart, loopEnd] : loopPoints ) {
+				MidiSequence fromStream {
+					parseLoopedMidiFile(path.wstring(), loopStart, loopEnd)
+				};
+				MidiSequence fromSpan {
+					parseLoopedMidiData(bytes.data(), bytes.size(), loopStart, loopEnd)
+				};
+				check(isSame(fromStream, fromSpan), "same looped track");
+			}
+		}
+	}
+	
+	//every truncation must throw rather than read past the end
+	void truncatedDataThrows() {
+		MidiFileBuilder midiFileBuilder { 13 };
+		std::vector<uint8_t> bytes { midiFileBuilder.build(1, 3, 40) };
+		for( std::size_t size { 0 }; size < bytes.size(); ++size ) {
+			std::vector<uint8_t> truncated { bytes.begin(), bytes.begin() + size };
+			bool threw { false };
+			try {
+				parseMidiData(truncated.data(), truncated.size());
+			}
+			catch( const std::runtime_error& ) {
+				threw = true;
+			}
+			check(threw, "truncated to " + std::to_string(size) + " bytes throws");
+		}
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "spanMatchesStream", spanMatchesStream },
+		{ "loopedSpanMatchesStream", loopedSpanMatchesStream },
+		{ "truncatedDataThrows", truncatedDataThrows }
+	});
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "Sound/MidiSequencer.h"
+#include "Sound/MidiTimer.h"
+#include "Sound/RecordingMidiOut.h"
+#include "Sound/TestSequences.h"
+#include "TestUtil.h"
+
+using namespace wasp::sound::midi;
+using namespace wasp::sound::midi::test;
+using wasp::test::check;
+
+namespace {
+	using namespace std::chrono_literals;
+	
+	//generous, since the test may share the machine with a whole build
+	constexpr std::chrono::nanoseconds maxTimingError { 20ms };
+	
+	//four notes over 100ms, with a tempo change halfway
+	std::shared_ptr<MidiSequence> makeSequence() {
+		auto midiSequencePointer { std::make_shared<MidiSequence>() };
+		midiSequencePointer->ticks = 480;
+		appendShortMsg(*midiSequencePointer, 0, makeShortMsg(noteOn, 60, 100));
+		appendShortMsg(*midiSequencePointer, 48, makeShortMsg(noteOff, 60, 0));
+		appendTempo(*midiSequencePointer, 0, 250'000);
+		appendShortMsg(*midiSequencePointer, 48, makeShortMsg(noteOn, 64, 100));
+		appendShortMsg(*midiSequencePointer, 48, makeShortMsg(noteOff, 64, 0));
+		return midiSequencePointer;
+	}
+	
+	void playsEventsOnTime() {
+		RecordingMidiOut recordingMidiOut {};
+		MidiTimer midiTimer {};
+		auto midiSequencePointer { makeSequence() };
+		{
+			MidiSequencer midiSequencer { &recordingMidiOut, &midiTimer };
+			midiSequencer.start(midiSequencePointer);
+			std::this_thread::sleep_for(250ms);
+		}
+		auto records { recordingMidiOut.takeRecords() };
+		auto timingError { RecordingMidiOut::measureTimingError(records, *midiSequencePointer) };
+		check(timingError.eventCount == 4, "every event is sent once");
+		check(timingError.max < maxTimingError, "events are sent on time");
+	}
+	
+	void stopSilencesPlayback() {
+		RecordingMidiOut recordingMidiOut {};
+		MidiTimer midiTimer {};
+		MidiSequencer midiSequencer { &recordingMidiOut, &midiTimer };
+		midiSequencer.start(makeSequence());
+		std::this_thread::sleep_for(30ms);
+		midiSequencer.stop();
+		std::this_thread::sleep_for(150ms);
+		
+		auto records { recordingMidiOut.takeRecords() };
+		check(!records.empty() && records.back().isReset, "stop ends with a reset");
+		std::size_t shortMsgCount { 0 };
+		for( const auto& record : records ) {
+			if( !record.isReset ) {
+				++shortMsgCount;
+			}
+		}
+		check(shortMsgCount == 1, "nothing due after the stop is sent");
+	}
+	
+	//far more commands than the queue holds; a lost wakeup would hang here
+	void commandsWaitForSpace() {
+		RecordingMidiOut recordingMidiOut {};
+		MidiTimer midiTimer {};
+		auto midiSequencePointer { makeSequence() };
+		MidiSequencer midiSequencer { &recordingMidiOut, &midiTimer };
+		for( int i { 0 }; i < 1000; ++i ) {
+			midiSequencer.start(midiSequencePointer);
+			midiSequencer.stop();
+		}
+		std::this_thread::sleep_for(20ms);
+		recordingMidiOut.takeRecords();
+		
+		midiSequencer.start(midiSequencePointer);
+		std::this_thread::sleep_for(250ms);
+		auto records { recordingMidiOut.takeRecords() };
+		auto timingError { RecordingMidiOut::measureTimingError(records, *midiSequencePointer) };
+		check(timingError.eventCount == 4, "playback still works after a full queue");
+	}
+}
+
+int main() {
+	return wasp::test::runTests({
+		{ "playsEventsOnTime", playsEventsOnTime },
+		{ "stopSilencesPlayback", stopSilencesPlayback },
+		{ "commandsWaitForSpace", commandsWaitForSpace }
+	});
+}
\ No newline at end of file
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//builds standard MIDI files in memory with a fixed pseudo random mix of events
+namespace wasp::sound::midi::test {
+	
+	class MidiFileBuilder {
+	private:
+		//fields
+		std::vector<uint8_t> bytes {};
+		std::uint32_t state {};
+		
+	public:
+		explicit MidiFileBuilder(std::uint32_t seed)
+			: state { seed | 1u } {
+		}
+		
+		//Each track gets the given number of events. Format 0 files always have one
+		//track. Running status is used wherever the status repeats.
+		std::vector<uint8_t> build(
+			uint16_t format,
+			uint16_t trackCount,
+			std::size_t eventsPerTrack,
+			uint16_t ticks = 480
+		) {
+			bytes.clear();
+			appendText("MThd");
+			appendBigEndian(6, 4);
+			appendBigEndian(format, 2);
+			appendBigEndian(trackCount, 2);
+			appendBigEndian(ticks, 2);
+			for( uint16_t i { 0 }; i < trackCount; ++i ) {
+				appendTrack(i, eventsPerTrack);
+			}
+			return std::move(bytes);
+		}
+	
+	private:
+		//helper functions
+		std::uint32_t next(std::uint32_t bound) {
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return state % bound;
+		}
+		
+		void appendText(const std::string& text) {
+			for( char c : text ) {
+				bytes.push_back(static_cast<uint8_t>(c));
+			}
+		}
+		
+		void appendBigEndian(std::uint32_t value, int byteCount) {
+			for( int i { byteCount - 1 }; i >= 0; --i ) {
+				bytes.push_back(static_cast<uint8_t>(value >> (i * 8)));
+			}
+		}
+		
+		void appendVariableLength(std::uint32_t value) {
+			uint8_t groups[5] {};
+			int groupCount { 0 };
+			do {
+				groups[groupCount++] = static_cast<uint8_t>(value & 0b0111'1111);
+				value >>= 7;
+			} while( value > 0 );
+			while( groupCount > 1 ) {
+				bytes.push_back(groups[--groupCount] | 0b1000'0000);
+			}
+			bytes.push_back(groups[0]);
+		}
+		
+		std::uint32_t nextDeltaTime() {
+			std::uint32_t roll { next(100) };
+			if( roll < 10 ) {
+				return 0;
+			}
+			if( roll < 75 ) {
+				return next(120);
+			}
+			return 128 + next(2000);
+		}
+		
+		void appendMeta(uint8_t metaStatus, const std::vector<uint8_t>& data) {
+			bytes.push_back(0xFF);
+			bytes.push_back(metaStatus);
+			appendVariableLength(static_cast<std::uint32_t>(data.size()));
+			bytes.insert(bytes.end(), data.begin(), data.end());
+		}
+		
+		void appendTrack(uint16_t trackIndex, std::size_t eventCount) {
+			appendText("MTrk");
+			std::size_t lengthIndex { bytes.size() };
+			appendBigEndian(0, 4);
+			std::size_t trackBegin { bytes.size() };
+			
+			uint8_t channel { static_cast<uint8_t>(trackIndex % 16) };
+			uint8_t lastStatus { 0 };
+			if( trackIndex == 0 ) {
+				appendVariableLength(0);
+				appendMeta(0x51, { 0x07, 0xA1, 0x20 });
+			}
+			appendVariableLength(0);
+			appendMeta(0x03, { 'T', 'r', 'a', 'c', 'k' });
+			
+			for( std::size_t i { 0 }; i < eventCount; ++i ) {
+				appendVariableLength(nextDeltaTime());
+				std::uint32_t roll { next(100) };
+				if( roll < 93 ) {
+					uint8_t status {};
+					int dataCount { 2 };
+					if( roll < 60 ) {
+						status = static_cast<uint8_t>((next(2) ? 0x90 : 0x80) | channel);
+					}
+					else if( roll < 75 ) {
+						status = static_cast<uint8_t>(0xB0 | channel);
+					}
+					else if( roll < 85 ) {
+						status = static_cast<uint8_t>(0xC0 | channel);
+						dataCount = 1;
+					}
+					else {
+						status = static_cast<uint8_t>(0xE0 | channel);
+					}
+					if( status != lastStatus ) {
+						bytes.push_back(status);
+						lastStatus = status;
+					}
+					for( int j { 0 }; j < dataCount; ++j ) {
+						bytes.push_back(static_cast<uint8_t>(next(128)));
+					}
+					continue;
+				}
+				//meta and system exclusive events cancel running status
+				lastStatus = 0;
+				if( roll < 96 ) {
+					std::uint32_t microsecondsPerBeat { 300'000 + next(400'000) };
+					appendMeta(0x51, {
+						static_cast<uint8_t>(microsecondsPerBeat >> 16),
+						static_cast<uint8_t>(microsecondsPerBeat >> 8),
+						static_cast<uint8_t>(microsecondsPerBeat)
+					});
+				}
+				else if( roll < 98 ) {
+					std::vector<uint8_t> data(1 + next(20));
+					for( auto& byte : data ) {
+						byte = static_cast<uint8_t>(next(128));
+					}
+					data.push_back(0xF7);
+					bytes.push_back(0xF0);
+					appendVariableLength(static_cast<std::uint32_t>(data.size()));
+					bytes.insert(bytes.end(), data.begin(), data.end());
+				}
+				else {
+					std::vector<uint8_t> data(next(40), static_cast<uint8_t>('a'));
+					appendMeta(0x01, data);
+				}
+			}
+			appendVariableLength(0);
+			appendMeta(0x2F, {});
+			
+			std::size_t trackLength { bytes.size() - trackBegin };
+			for( int i { 0 }; i < 4; ++i ) {
+				bytes[lengthIndex + i] = static_cast<uint8_t>(trackLength >> ((3 - i) * 8));
+			}
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "Sound/MidiConstants.h"
+#include "Sound/MidiSequence.h"
+
+//builds compiled tracks by hand, in the same layout MidiSequenceLoading produces
+namespace wasp::sound::midi::test {
+	
+	inline uint32_t makeShortMsg(uint8_t status, uint8_t data1, uint8_t data2) {
+		return static_cast<uint32_t>(status)
+			| (static_cast<uint32_t>(data1) << 8)
+			| (static_cast<uint32_t>(data2) << 16);
+	}
+	
+	inline void appendShortMsg(MidiSequence& midiSequence, uint32_t deltaTime, uint32_t shortMsg) {
+		midiSequence.compiledTrack.push_back({ deltaTime, shortMsg });
+	}
+	
+	inline void appendTempo(
+		MidiSequence& midiSequence,
+		uint32_t deltaTime,
+		uint32_t microsecondsPerBeat
+	) {
+		auto& track { midiSequence.compiledTrack };
+		track.push_back({ deltaTime, (static_cast<uint32_t>(tempo) << 8) | metaEvent });
+		//3 bytes of data fit in one block
+		track.push_back({ 3, 1 });
+		uint8_t data[sizeof(MidiSequence::EventUnit)] {
+			static_cast<uint8_t>(microsecondsPerBeat >> 16),
+			static_cast<uint8_t>(microsecondsPerBeat >> 8),
+			static_cast<uint8_t>(microsecondsPerBeat)
+		};
+		//the loader reads the bytes straight over the unit, so lay them out the same way
+		uint32_t words[2] {};
+		std::memcpy(words, data, sizeof(data));
+		track.push_back({ words[0], words[1] });
+	}
+	
+	//the first loop point marks the loop start, the second the loop end
+	inline void appendLoopPoint(MidiSequence& midiSequence, uint32_t deltaTime) {
+		auto& track { midiSequence.compiledTrack };
+		track.push_back({ deltaTime, (static_cast<uint32_t>(tempo) << 8) | metaEvent });
+		track.push_back(MidiSequence::loopEncoding);
+	}
+}
\ No newline at end of file
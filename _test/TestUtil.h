@@ -0,0 +1,35 @@
+#pragma once
+
+#include <initializer_list>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace wasp::test {
+	
+	using TestCase = std::pair<const char*, void(*)()>;
+	
+	//a failed check ends the current test case by throwing
+	inline void check(bool condition, const std::string& message) {
+		if( !condition ) {
+			throw std::runtime_error { "check failed: " + message };
+		}
+	}
+	
+	//runs every test case, even after one fails, and returns the exit code for main
+	inline int runTests(std::initializer_list<TestCase> testCases) {
+		int failures { 0 };
+		for( const auto& [name, function] : testCases ) {
+			try {
+				function();
+				std::cout << "passed " << name << '\n';
+			}
+			catch( const std::exception& exception ) {
+				std::cout << "FAILED " << name << ": " << exception.what() << '\n';
+				++failures;
+			}
+		}
+		return failures == 0 ? 0 : 1;
+	}
+}
\ No newline at end of file
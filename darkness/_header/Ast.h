@@ -4,6 +4,7 @@
 #include <string>
 #include <variant>
 #include <memory>
+#include <cstdint>
 
 namespace darkness{
 	enum class AstType{
@@ -131,6 +132,10 @@ namespace darkness{
 	
 	struct AstLitStringData{
 		std::string value{};
+		//a handle the value resolves to, filled in on first use by the interpreter's
+		//user; owner is whatever the handle indexes, or nullptr if not yet resolved
+		mutable std::uint32_t handle{};
+		mutable const void* handleOwnerPointer{};
 	};
 	
 	struct AstParenthesisData{
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Ast.h"
+
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+namespace darkness{
+	//A script AST flattened into one relocatable block of memory; every reference is an
+	//offset, so the image can be written to disk and read back from a mapped file.
+	//
+	//layout, all words are native endian uint32:
+	//	header		magic, version, node count, list word count, string byte count, root
+	//	nodes		node count records of { type, operand, operand, operand }
+	//	lists		list word count words; a list is its length followed by node indices
+	//	strings		string byte count bytes; a string is its length word then its chars
+	//
+	//operands by node type:
+	//	script, stmtBlock		list of statements
+	//	stmtVarDeclare			name, initializer or none
+	//	stmtFuncDeclare			name, list of parameter names, body
+	//	stmtIf					condition, true branch, false branch or none
+	//	stmtWhile				condition, body
+	//	stmtReturn				has value, value
+	//	stmtExpression			expression
+	//	bin...					left, right
+	//	binAssign				name, right
+	//	unary...				arg
+	//	variable				name
+	//	call					function expression, list of args
+	//	litBool, litInt			value
+	//	litFloat				value bits
+	//	litString				string
+	//	parenthesis				inside
+	//	error					nothing
+	//list operands are word offsets into lists; strings are byte offsets into strings.
+	//A list of parameter names holds string offsets instead of node indices.
+	namespace astimage{
+		constexpr std::uint32_t magic{ 0x49414b44u };	//DKAI
+		constexpr std::uint32_t version{ 1u };
+		constexpr std::uint32_t none{ 0xffffffffu };
+		constexpr std::size_t headerWords{ 6 };
+		constexpr std::size_t nodeWords{ 4 };
+	}
+
+	class AstImageWriter{
+	private:
+		std::vector<std::uint32_t> nodes{};
+		std::vector<std::uint32_t> lists{};
+		std::vector<std::uint8_t> strings{};
+		std::unordered_map<std::string, std::uint32_t> stringOffsets{};
+
+	public:
+		//entry point for the writer
+		std::vector<std::uint8_t> write(const AstNode& script);
+
+	private:
+		//writes children before their parent and returns the index of the node
+		std::uint32_t writeNode(const AstNode& node);
+		std::uint32_t writeNodePointer(const AstNode* nodePointer);
+		std::uint32_t writeList(const std::vector<std::uint32_t>& words);
+		std::uint32_t writeString(const std::string& string);
+	};
+
+	class AstImageReader{
+	private:
+		const std::uint32_t* nodes{};
+		std::uint32_t nodeCount{};
+		const std::uint32_t* lists{};
+		std::uint32_t listWordCount{};
+		const std::uint8_t* strings{};
+		std::uint32_t stringByteCount{};
+		std::vector<bool> readNodes{};
+
+	public:
+		//entry point for the reader; throws if the image is malformed
+		AstNode read(const std::uint8_t* image, std::size_t imageSize);
+
+	private:
+		AstNode readNode(std::uint32_t nodeIndex);
+		//children are written before their parent, so a child index must be lower, and
+		//every node has one parent, so no index may be read twice; together these rule
+		//out cycles and shared children in a corrupt image
+		AstNode readChild(std::uint32_t nodeIndex, std::uint32_t parentIndex);
+		std::unique_ptr<AstNode> readChildPointer(
+			std::uint32_t nodeIndex,
+			std::uint32_t parentIndex
+		);
+		std::vector<AstNode> readChildList(std::uint32_t listOffset, std::uint32_t parentIndex);
+		std::vector<std::string> readStringList(std::uint32_t listOffset);
+		std::string readString(std::uint32_t stringOffset);
+
+		const std::uint32_t* getList(std::uint32_t listOffset);
+	};
+}
\ No newline at end of file
@@ -123,6 +123,61 @@ namespace darkness{
 			std::vector<StallNodeInfo> stallInfoStack{};
 			std::vector<DataType> stallDataStack{};
 			StallingNativeFunctionCall stallingNativeFunctionCall{};
+			
+			ScriptExecutionState() = default;
+			
+			/**
+			 * Copies the state deeply enough for the copy to be resumed on its own; every
+			 * environment below the native environment is copied, so variables assigned by
+			 * one copy are never seen by the other. Functions captured in values still share
+			 * the environments they close over.
+			 */
+			ScriptExecutionState(const ScriptExecutionState& other)
+				: stalled{ other.stalled }
+				, innermostEnvironmentPointer{
+					Environment::copyChain(other.innermostEnvironmentPointer)
+				}
+				, stallInfoStack{ other.stallInfoStack }
+				, stallDataStack{ other.stallDataStack }
+				, stallingNativeFunctionCall{ other.stallingNativeFunctionCall }{
+			}
+			
+			ScriptExecutionState(ScriptExecutionState&& other) = default;
+			
+			//reuses the capacity of this state's stacks
+			ScriptExecutionState& operator=(const ScriptExecutionState& other){
+				stalled = other.stalled;
+				innermostEnvironmentPointer
+					= Environment::copyChain(other.innermostEnvironmentPointer);
+				stallInfoStack = other.stallInfoStack;
+				stallDataStack = other.stallDataStack;
+				stallingNativeFunctionCall = other.stallingNativeFunctionCall;
+				return *this;
+			}
+			
+			ScriptExecutionState& operator=(ScriptExecutionState&& other) = default;
+			
+			/**
+			 * Empties the state as if the script had finished, but keeps the capacity of its
+			 * stacks so that the state can be reused. A script level environment held by
+			 * nothing else is kept as well, emptied, for the next script to start in.
+			 */
+			void clear(){
+				stalled = false;
+				if(innermostEnvironmentPointer
+					&& innermostEnvironmentPointer.use_count() == 1
+					&& innermostEnvironmentPointer->isScriptLevel())
+				{
+					innermostEnvironmentPointer->clear();
+				}
+				else{
+					innermostEnvironmentPointer = nullptr;
+				}
+				stallInfoStack.clear();
+				stallDataStack.clear();
+				stallingNativeFunctionCall.stallingNativeFunction = nullptr;
+				stallingNativeFunctionCall.args.clear();
+			}
 		};
 		
 	protected:
@@ -144,6 +199,8 @@ namespace darkness{
 		StallingNativeFunctionCall stallingNativeFunctionCall{};
 		bool isStalled{ false };
 		DataType stallReturn{ false };
+		//the call a running native function was called from; nullptr while resuming one
+		const AstCallData* nativeCallDataPointer{};
 		
 	public:
 		/**
@@ -190,6 +247,34 @@ namespace darkness{
 			nativeEnvironmentPointer->define(name, data);
 		}
 		
+		/**
+		 * Resolves a string argument of the running native function to a handle. If the
+		 * argument was written as a string literal, the handle is stored in the literal's
+		 * node, so each call site calls resolve only once. Otherwise, resolve is called
+		 * with the string every time. The owner pointer names what the handle indexes, so
+		 * that a literal resolved for one table is never read as a handle into another.
+		 */
+		template <typename Resolve>
+		std::uint32_t resolveStringArg(
+			const std::vector<DataType>& args,
+			std::size_t argIndex,
+			const void* ownerPointer,
+			Resolve&& resolve
+		){
+			if(nativeCallDataPointer && argIndex < nativeCallDataPointer->args.size()){
+				const AstNode& argNode{ nativeCallDataPointer->args[argIndex] };
+				if(argNode.type == AstType::litString){
+					const auto& data{ std::get<AstLitStringData>(argNode.dataVariant) };
+					if(data.handleOwnerPointer != ownerPointer){
+						data.handle = resolve(data.value);
+						data.handleOwnerPointer = ownerPointer;
+					}
+					return data.handle;
+				}
+			}
+			return resolve(std::get<std::string>(args[argIndex]));
+		}
+		
 		/**
 		 * Binds a function script to the native environment under the specified name.
 		 */
@@ -210,10 +295,11 @@ namespace darkness{
 	public:
 		/**
 		 * Runs a darkness script. If the given AstNode is of any other type, throws an error.
-		 * A script may stall on any of its statements. Returns true if the script completed,
-		 * false if the script stalled.
+		 * A script may stall on any of its statements. The given state must not be stalled;
+		 * afterwards it is stalled if the script stalled. The stacks of the state are reused
+		 * rather than reallocated.
 		 */
-		ScriptExecutionState runScript(const AstNode& script){
+		void runScript(const AstNode& script, ScriptExecutionState& state){
 			throwIfNotType(script, AstType::script, "trying to run not script!");
 			resetState();
 			
@@ -223,21 +309,18 @@ namespace darkness{
 				if(isStalled){
 					//stalled on a native function! vomit onto the stack and exit
 					pushStallNodeInfo({ AstType::script, currentIndex });
-					return packageState();
+					packageState(state);
+					return;
 				}
 			}
-			return ScriptExecutionState{};
 		}
 		
 		/**
 		 * Resumes a stalled darkness script. If the given AstNode is of any other type, throws
 		 * an error. The script may stall on the same statement, or it may stall on a new
-		 * statement. Returns true if the script completed, false if the script stalled again.
+		 * statement. Afterwards the given state is stalled if the script stalled again.
 		 */
-		ScriptExecutionState resumeScript(
-			const AstNode& script,
-			const ScriptExecutionState& state
-		){
+		void resumeScript(const AstNode& script, ScriptExecutionState& state){
 			throwIfNotType(script, AstType::script, "trying to resume not script!");
 			loadState(state);
 			//make sure interpreter was stalled
@@ -246,14 +329,17 @@ namespace darkness{
 			}
 			
 			//try rerunning the stalled native function
+			nativeCallDataPointer = nullptr;
 			stallReturn = stallingNativeFunctionCall.run();
 			if(isStalled){
 				//stalled again on the same native function! exit prematurely
-				return packageState();
+				packageState(state);
+				return;
 			}
 			
 			//successfully ran - reset stalling native function call to nothing
-			stallingNativeFunctionCall = {};
+			stallingNativeFunctionCall.stallingNativeFunction = nullptr;
+			stallingNativeFunctionCall.args.clear();
 			
 			//get the stall info
 			const StallNodeInfo& stallNodeInfo{ popLastStallNodeInfo() };
@@ -270,7 +356,8 @@ namespace darkness{
 			if(isStalled){
 				//stalled on a different native function! vomit onto the stack and exit
 				pushStallNodeInfo({ AstType::script, currentIndex });
-				return packageState();
+				packageState(state);
+				return;
 			}
 			++currentIndex;
 			
@@ -280,10 +367,10 @@ namespace darkness{
 				if(isStalled){
 					//stalled on a different native function! stack and exit
 					pushStallNodeInfo({ AstType::script, currentIndex });
-					return packageState();
+					packageState(state);
+					return;
 				}
 			}
-			return ScriptExecutionState{};
 		 }
 		 
 	private:
@@ -2299,23 +2386,32 @@ namespace darkness{
 				args.push_back(temp);
 			}
 			//pass to native function, which may stall (in fact this is where stalls start)
-			return evaluateNativeFunctionWithArgs(nativeFunction, args, functionWrapperData);
+			return evaluateNativeFunctionWithArgs(
+				data,
+				nativeFunction,
+				args,
+				functionWrapperData
+			);
 		}
 		
 		/**
 		 * Runs and returns the result of a native function. Begins a stall cycle if it stalls.
 		 */
 		DataType evaluateNativeFunctionWithArgs(
+			const AstCallData& data,
 			const NativeFunction& nativeFunction,
 			const std::vector<DataType>& args,
 			const DataType& functionWrapperData
 		){
 			//try to run the native function
+			nativeCallDataPointer = &data;
 			DataType toRet{ nativeFunction(args) };
+			nativeCallDataPointer = nullptr;
 			//stalled on native function!
 			if(isStalled){
 				//don't push the args - instead set the stalling native function call
-				stallingNativeFunctionCall = { nativeFunction, args };
+				stallingNativeFunctionCall.stallingNativeFunction = nativeFunction;
+				stallingNativeFunctionCall.args.assign(args.begin(), args.end());
 				//next, push the function wrapper
 				pushStallNodeData(functionWrapperData);
 				//last, push a stall info for a native call stall
@@ -2557,7 +2653,12 @@ namespace darkness{
 				args.push_back(temp);
 			}
 			//pass to native function, which may stall (in fact this is where stalls start)
-			return evaluateNativeFunctionWithArgs(nativeFunction, args, functionWrapperData);
+			return evaluateNativeFunctionWithArgs(
+				data,
+				nativeFunction,
+				args,
+				functionWrapperData
+			);
 		}
 		
 		DataType resumeEvaluatingUserFunctionCall(
@@ -2677,7 +2778,7 @@ namespace darkness{
 			}
 			else{
 				throwError("tried to unwrapNativeFunctionFromData a non-function!");
-				return false;//dummy return
+				return nullptr;//dummy return
 			}
 		}
 		
@@ -2692,7 +2793,7 @@ namespace darkness{
 			}
 			else{
 				throwError("tried to unwrapNativeFunctionFromData a user function!");
-				return false;//dummy return
+				return nullptr;//dummy return
 			}
 		}
 		
@@ -2748,42 +2849,61 @@ namespace darkness{
 		}
 		
 		/**
-		 * Packages up the interpreter state. Invalidates the following fields:
-		 * innermostEnvironmentPointer, stallInfoStack, stallDataStack,
-		 * and stallingNativeFunctionCall.
+		 * Packages up the interpreter state into the given state, which must be empty. The
+		 * stacks are swapped rather than moved, so the interpreter is left with the empty
+		 * stacks of the state and neither side gives up its capacity. Invalidates
+		 * innermostEnvironmentPointer and stallingNativeFunctionCall.
 		 */
-		ScriptExecutionState packageState(){
-			return {
-				true,
-				std::move(innermostEnvironmentPointer),
-				std::move(stallInfoStack),
-				std::move(stallDataStack),
-				std::move(stallingNativeFunctionCall)
-			};
+		void packageState(ScriptExecutionState& state){
+			state.stalled = true;
+			//the state may hold a spare environment, which resetState can reuse
+			std::swap(state.innermostEnvironmentPointer, innermostEnvironmentPointer);
+			std::swap(state.stallInfoStack, stallInfoStack);
+			std::swap(state.stallDataStack, stallDataStack);
+			state.stallingNativeFunctionCall.stallingNativeFunction
+				= std::move(stallingNativeFunctionCall.stallingNativeFunction);
+			stallingNativeFunctionCall.stallingNativeFunction = nullptr;
+			std::swap(state.stallingNativeFunctionCall.args, stallingNativeFunctionCall.args);
 		}
 		
 		/**
 		 * Resets the state of the interpreter, specifically the innermostEnvironmentPointer,
-		 * stallInfoStack, and stallDataStack.
+		 * stallInfoStack, and stallDataStack. The base environment of the last script is
+		 * emptied and reused if nothing else holds it.
 		 */
 		void resetState(){
-			innermostEnvironmentPointer = std::make_shared<Environment>(
-				nativeEnvironmentPointer
-			);
+			if(innermostEnvironmentPointer
+				&& innermostEnvironmentPointer.use_count() == 1
+				&& innermostEnvironmentPointer->isEnclosedBy(nativeEnvironmentPointer))
+			{
+				innermostEnvironmentPointer->clear();
+			}
+			else{
+				innermostEnvironmentPointer = std::make_shared<Environment>(
+					nativeEnvironmentPointer
+				);
+			}
 			stallInfoStack.clear();
 			stallDataStack.clear();
 			isStalled = false;
 		}
 		
 		/**
-		 * Loads the interpreter with the given script execution state. Invalidates the given
-		 * state.
+		 * Loads the interpreter with the given script execution state by swapping, leaving
+		 * the given state empty but holding the interpreter's old stacks and environment.
 		 */
-		void loadState(const ScriptExecutionState& state){
-			innermostEnvironmentPointer = std::move(state.innermostEnvironmentPointer);
-			stallInfoStack = std::move(state.stallInfoStack);
-			stallDataStack = std::move(state.stallDataStack);
-			stallingNativeFunctionCall = std::move(state.stallingNativeFunctionCall);
+		void loadState(ScriptExecutionState& state){
+			stallInfoStack.clear();
+			stallDataStack.clear();
+			stallingNativeFunctionCall.args.clear();
+			std::swap(innermostEnvironmentPointer, state.innermostEnvironmentPointer);
+			std::swap(stallInfoStack, state.stallInfoStack);
+			std::swap(stallDataStack, state.stallDataStack);
+			stallingNativeFunctionCall.stallingNativeFunction
+				= std::move(state.stallingNativeFunctionCall.stallingNativeFunction);
+			state.stallingNativeFunctionCall.stallingNativeFunction = nullptr;
+			std::swap(stallingNativeFunctionCall.args, state.stallingNativeFunctionCall.args);
+			state.stalled = false;
 			isStalled = false;
 		}
 		
@@ -2908,6 +3028,35 @@ namespace darkness{
 			std::shared_ptr<Environment> getEnclosingEnvironmentPointer(){
 				return enclosingEnvironmentPointer;
 			}
+			
+			bool isEnclosedBy(const std::shared_ptr<Environment>& environmentPointer) const{
+				return enclosingEnvironmentPointer == environmentPointer;
+			}
+			
+			//true if the only environment above this one is the native environment
+			bool isScriptLevel() const{
+				return enclosingEnvironmentPointer
+					&& !enclosingEnvironmentPointer->enclosingEnvironmentPointer;
+			}
+			
+			//removes every identifier but keeps the buckets
+			void clear(){
+				identifierMap.clear();
+			}
+			
+			//copies every environment in the chain but the native one, which is shared
+			static std::shared_ptr<Environment> copyChain(
+				const std::shared_ptr<Environment>& environmentPointer
+			){
+				if(!environmentPointer || !environmentPointer->enclosingEnvironmentPointer){
+					return environmentPointer;
+				}
+				auto copyPointer{ std::make_shared<Environment>(
+					copyChain(environmentPointer->enclosingEnvironmentPointer)
+				) };
+				copyPointer->identifierMap = environmentPointer->identifierMap;
+				return copyPointer;
+			}
 		};
 	};
 }
\ No newline at end of file
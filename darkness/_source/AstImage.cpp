@@ -0,0 +1,432 @@
+#include "AstImage.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace darkness{
+
+	namespace{
+		using namespace astimage;
+
+		constexpr std::size_t wordSize{ sizeof(std::uint32_t) };
+	}
+
+	std::vector<std::uint8_t> AstImageWriter::write(const AstNode& script){
+		nodes.clear();
+		lists.clear();
+		strings.clear();
+		stringOffsets.clear();
+
+		std::uint32_t root{ writeNode(script) };
+		const std::uint32_t header[headerWords]{
+			magic,
+			version,
+			static_cast<std::uint32_t>(nodes.size() / nodeWords),
+			static_cast<std::uint32_t>(lists.size()),
+			static_cast<std::uint32_t>(strings.size()),
+			root
+		};
+
+		std::vector<std::uint8_t> image(
+			sizeof(header) + (nodes.size() * wordSize) + (lists.size() * wordSize)
+				+ strings.size()
+		);
+		std::uint8_t* writePointer{ image.data() };
+		const auto append{ [&](const void* source, std::size_t sizeBytes){
+			if(sizeBytes > 0){
+				std::memcpy(writePointer, source, sizeBytes);
+				writePointer += sizeBytes;
+			}
+		} };
+		append(header, sizeof(header));
+		append(nodes.data(), nodes.size() * wordSize);
+		append(lists.data(), lists.size() * wordSize);
+		append(strings.data(), strings.size());
+		return image;
+	}
+
+	std::uint32_t AstImageWriter::writeNode(const AstNode& node){
+		std::uint32_t operands[nodeWords - 1]{ none, none, none };
+		switch(node.type){
+			case AstType::script:
+			case AstType::stmtBlock: {
+				const auto& data{ std::get<AstStmtBlockData>(node.dataVariant) };
+				std::vector<std::uint32_t> statementIndices{};
+				for(const AstNode& statement : data.statements){
+					statementIndices.push_back(writeNode(statement));
+				}
+				operands[0] = writeList(statementIndices);
+				break;
+			}
+			case AstType::stmtVarDeclare: {
+				const auto& data{ std::get<AstStmtVarDeclareData>(node.dataVariant) };
+				operands[0] = writeString(data.varName);
+				operands[1] = writeNodePointer(data.initializer.get());
+				break;
+			}
+			case AstType::stmtFuncDeclare: {
+				const auto& data{ std::get<AstStmtFuncDeclareData>(node.dataVariant) };
+				std::vector<std::uint32_t> paramNameOffsets{};
+				for(const std::string& paramName : data.paramNames){
+					paramNameOffsets.push_back(writeString(paramName));
+				}
+				operands[0] = writeString(data.funcName);
+				operands[1] = writeList(paramNameOffsets);
+				operands[2] = writeNodePointer(data.body.get());
+				break;
+			}
+			case AstType::stmtIf: {
+				const auto& data{ std::get<AstStmtIfData>(node.dataVariant) };
+				operands[0] = writeNodePointer(data.condition.get());
+				operands[1] = writeNodePointer(data.trueBranch.get());
+				operands[2] = writeNodePointer(data.falseBranch.get());
+				break;
+			}
+			case AstType::stmtWhile: {
+				const auto& data{ std::get<AstStmtWhileData>(node.dataVariant) };
+				operands[0] = writeNodePointer(data.condition.get());
+				operands[1] = writeNodePointer(data.body.get());
+				break;
+			}
+			case AstType::stmtReturn: {
+				const auto& data{ std::get<AstStmtReturnData>(node.dataVariant) };
+				operands[0] = data.hasValue ? 1u : 0u;
+				operands[1] = writeNodePointer(data.value.get());
+				break;
+			}
+			case AstType::stmtExpression: {
+				const auto& data{ std::get<AstStmtExpressionData>(node.dataVariant) };
+				operands[0] = writeNodePointer(data.expression.get());
+				break;
+			}
+			case AstType::binPlus:
+			case AstType::binMinus:
+			case AstType::binStar:
+			case AstType::binForwardSlash:
+			case AstType::binDualEqual:
+			case AstType::binBangEqual:
+			case AstType::binGreater:
+			case AstType::binGreaterEqual:
+			case AstType::binLess:
+			case AstType::binLessEqual:
+			case AstType::binAmpersand:
+			case AstType::binVerticalBar: {
+				const auto& data{ std::get<AstBinData>(node.dataVariant) };
+				operands[0] = writeNodePointer(data.left.get());
+				operands[1] = writeNodePointer(data.right.get());
+				break;
+			}
+			case AstType::binAssign: {
+				const auto& data{ std::get<AstAssignData>(node.dataVariant) };
+				operands[0] = writeString(data.varName);
+				operands[1] = writeNodePointer(data.right.get());
+				break;
+			}
+			case AstType::unaryBang:
+			case AstType::unaryPlus:
+			case AstType::unaryMinus: {
+				const auto& data{ std::get<AstUnaryData>(node.dataVariant) };
+				operands[0] = writeNodePointer(data.arg.get());
+				break;
+			}
+			case AstType::variable: {
+				const auto& data{ std::get<AstVariableData>(node.dataVariant) };
+				operands[0] = writeString(data.varName);
+				break;
+			}
+			case AstType::call: {
+				const auto& data{ std::get<AstCallData>(node.dataVariant) };
+				std::vector<std::uint32_t> argIndices{};
+				for(const AstNode& arg : data.args){
+					argIndices.push_back(writeNode(arg));
+				}
+				operands[0] = writeNodePointer(data.funcExpr.get());
+				operands[1] = writeList(argIndices);
+				break;
+			}
+			case AstType::litBool:
+				operands[0] = std::get<AstLitBoolData>(node.dataVariant).value ? 1u : 0u;
+				break;
+			case AstType::litInt:
+				operands[0] = static_cast<std::uint32_t>(
+					std::get<AstLitIntData>(node.dataVariant).value
+				);
+				break;
+			case AstType::litFloat: {
+				float value{ std::get<AstLitFloatData>(node.dataVariant).value };
+				std::memcpy(&operands[0], &value, sizeof(value));
+				break;
+			}
+			case AstType::litString:
+				operands[0] = writeString(std::get<AstLitStringData>(node.dataVariant).value);
+				break;
+			case AstType::parenthesis: {
+				const auto& data{ std::get<AstParenthesisData>(node.dataVariant) };
+				operands[0] = writeNodePointer(data.inside.get());
+				break;
+			}
+			case AstType::error:
+				break;
+			default:
+				throw std::runtime_error{ "Darkness ast image cannot write node type" };
+		}
+		std::uint32_t nodeIndex{ static_cast<std::uint32_t>(nodes.size() / nodeWords) };
+		nodes.push_back(static_cast<std::uint32_t>(node.type));
+		nodes.insert(nodes.end(), std::begin(operands), std::end(operands));
+		return nodeIndex;
+	}
+
+	std::uint32_t AstImageWriter::writeNodePointer(const AstNode* nodePointer){
+		return nodePointer ? writeNode(*nodePointer) : none;
+	}
+
+	std::uint32_t AstImageWriter::writeList(const std::vector<std::uint32_t>& words){
+		std::uint32_t listOffset{ static_cast<std::uint32_t>(lists.size()) };
+		lists.push_back(static_cast<std::uint32_t>(words.size()));
+		lists.insert(lists.end(), words.begin(), words.end());
+		return listOffset;
+	}
+
+	//identical strings are stored once
+	std::uint32_t AstImageWriter::writeString(const std::string& string){
+		auto found{ stringOffsets.find(string) };
+		if(found != stringOffsets.end()){
+			return found->second;
+		}
+		std::uint32_t stringOffset{ static_cast<std::uint32_t>(strings.size()) };
+		std::uint32_t length{ static_cast<std::uint32_t>(string.size()) };
+		strings.resize(strings.size() + wordSize + string.size());
+		std::memcpy(strings.data() + stringOffset, &length, wordSize);
+		std::memcpy(strings.data() + stringOffset + wordSize, string.data(), string.size());
+		stringOffsets.insert({ string, stringOffset });
+		return stringOffset;
+	}
+
+	AstNode AstImageReader::read(const std::uint8_t* image, std::size_t imageSize){
+		if(!image || reinterpret_cast<std::uintptr_t>(image) % alignof(std::uint32_t) != 0){
+			throw std::runtime_error{ "Darkness ast image is not word aligned" };
+		}
+		if(imageSize < headerWords * wordSize){
+			throw std::runtime_error{ "Darkness ast image too small for header" };
+		}
+		const auto* header{ reinterpret_cast<const std::uint32_t*>(image) };
+		if(header[0] != magic || header[1] != version){
+			throw std::runtime_error{ "Darkness ast image has wrong magic or version" };
+		}
+		nodeCount = header[2];
+		listWordCount = header[3];
+		stringByteCount = header[4];
+		std::uint32_t root{ header[5] };
+
+		std::uint64_t expectedSize{
+			(headerWords * wordSize)
+				+ (static_cast<std::uint64_t>(nodeCount) * nodeWords * wordSize)
+				+ (static_cast<std::uint64_t>(listWordCount) * wordSize)
+				+ stringByteCount
+		};
+		if(expectedSize != imageSize){
+			throw std::runtime_error{ "Darkness ast image has wrong size" };
+		}
+		if(root >= nodeCount){
+			throw std::runtime_error{ "Darkness ast image root out of range" };
+		}
+		nodes = header + headerWords;
+		lists = nodes + (static_cast<std::size_t>(nodeCount) * nodeWords);
+		strings = reinterpret_cast<const std::uint8_t*>(lists + listWordCount);
+		readNodes.assign(nodeCount, false);
+		readNodes[root] = true;
+		return readNode(root);
+	}
+
+	AstNode AstImageReader::readNode(std::uint32_t nodeIndex){
+		const std::uint32_t* record{ nodes + (static_cast<std::size_t>(nodeIndex) * nodeWords) };
+		if(record[0] >= static_cast<std::uint32_t>(AstType::numAstTypes)){
+			throw std::runtime_error{ "Darkness ast image has bad node type" };
+		}
+		AstType type{ static_cast<AstType>(record[0]) };
+		const std::uint32_t* operands{ record + 1 };
+		switch(type){
+			case AstType::script:
+			case AstType::stmtBlock:
+				return{
+					type,
+					AstStmtBlockData{ readChildList(operands[0], nodeIndex) }
+				};
+			case AstType::stmtVarDeclare:
+				return{
+					type,
+					AstStmtVarDeclareData{
+						readString(operands[0]),
+						readChildPointer(operands[1], nodeIndex)
+					}
+				};
+			case AstType::stmtFuncDeclare:
+				return{
+					type,
+					AstStmtFuncDeclareData{
+						readString(operands[0]),
+						readStringList(operands[1]),
+						std::shared_ptr<AstNode>{ readChildPointer(operands[2], nodeIndex) }
+					}
+				};
+			case AstType::stmtIf:
+				return{
+					type,
+					AstStmtIfData{
+						readChildPointer(operands[0], nodeIndex),
+						readChildPointer(operands[1], nodeIndex),
+						readChildPointer(operands[2], nodeIndex)
+					}
+				};
+			case AstType::stmtWhile:
+				return{
+					type,
+					AstStmtWhileData{
+						readChildPointer(operands[0], nodeIndex),
+						readChildPointer(operands[1], nodeIndex)
+					}
+				};
+			case AstType::stmtReturn:
+				return{
+					type,
+					AstStmtReturnData{
+						operands[0] != 0,
+						readChildPointer(operands[1], nodeIndex)
+					}
+				};
+			case AstType::stmtExpression:
+				return{
+					type,
+					AstStmtExpressionData{ readChildPointer(operands[0], nodeIndex) }
+				};
+			case AstType::binPlus:
+			case AstType::binMinus:
+			case AstType::binStar:
+			case AstType::binForwardSlash:
+			case AstType::binDualEqual:
+			case AstType::binBangEqual:
+			case AstType::binGreater:
+			case AstType::binGreaterEqual:
+			case AstType::binLess:
+			case AstType::binLessEqual:
+			case AstType::binAmpersand:
+			case AstType::binVerticalBar:
+				return{
+					type,
+					AstBinData{
+						readChildPointer(operands[0], nodeIndex),
+						readChildPointer(operands[1], nodeIndex)
+					}
+				};
+			case AstType::binAssign:
+				return{
+					type,
+					AstAssignData{
+						readString(operands[0]),
+						readChildPointer(operands[1], nodeIndex)
+					}
+				};
+			case AstType::unaryBang:
+			case AstType::unaryPlus:
+			case AstType::unaryMinus:
+				return{
+					type,
+					AstUnaryData{ readChildPointer(operands[0], nodeIndex) }
+				};
+			case AstType::variable:
+				return{ type, AstVariableData{ readString(operands[0]) } };
+			case AstType::call:
+				return{
+					type,
+					AstCallData{
+						readChildPointer(operands[0], nodeIndex),
+						readChildList(operands[1], nodeIndex)
+					}
+				};
+			case AstType::litBool:
+				return{ type, AstLitBoolData{ operands[0] != 0 } };
+			case AstType::litInt:
+				return{ type, AstLitIntData{ static_cast<int>(operands[0]) } };
+			case AstType::litFloat: {
+				float value;	//not initialized!
+				std::memcpy(&value, &operands[0], sizeof(value));
+				return{ type, AstLitFloatData{ value } };
+			}
+			case AstType::litString:
+				return{ type, AstLitStringData{ readString(operands[0]) } };
+			case AstType::parenthesis:
+				return{
+					type,
+					AstParenthesisData{ readChildPointer(operands[0], nodeIndex) }
+				};
+			case AstType::error:
+				return{};
+			default:
+				throw std::runtime_error{ "Darkness ast image has bad node type" };
+		}
+	}
+
+	AstNode AstImageReader::readChild(std::uint32_t nodeIndex, std::uint32_t parentIndex){
+		if(nodeIndex >= parentIndex){
+			throw std::runtime_error{ "Darkness ast image child not before parent" };
+		}
+		if(readNodes[nodeIndex]){
+			throw std::runtime_error{ "Darkness ast image node has two parents" };
+		}
+		readNodes[nodeIndex] = true;
+		return readNode(nodeIndex);
+	}
+
+	std::unique_ptr<AstNode> AstImageReader::readChildPointer(
+		std::uint32_t nodeIndex,
+		std::uint32_t parentIndex
+	){
+		if(nodeIndex == none){
+			return nullptr;
+		}
+		return std::make_unique<AstNode>(readChild(nodeIndex, parentIndex));
+	}
+
+	std::vector<AstNode> AstImageReader::readChildList(
+		std::uint32_t listOffset,
+		std::uint32_t parentIndex
+	){
+		const std::uint32_t* list{ getList(listOffset) };
+		std::vector<AstNode> children{};
+		children.reserve(list[0]);
+		for(std::uint32_t i{ 1 }; i <= list[0]; ++i){
+			children.push_back(readChild(list[i], parentIndex));
+		}
+		return children;
+	}
+
+	std::vector<std::string> AstImageReader::readStringList(std::uint32_t listOffset){
+		const std::uint32_t* list{ getList(listOffset) };
+		std::vector<std::string> toRet{};
+		toRet.reserve(list[0]);
+		for(std::uint32_t i{ 1 }; i <= list[0]; ++i){
+			toRet.push_back(readString(list[i]));
+		}
+		return toRet;
+	}
+
+	std::string AstImageReader::readString(std::uint32_t stringOffset){
+		if(stringOffset > stringByteCount || stringByteCount - stringOffset < wordSize){
+			throw std::runtime_error{ "Darkness ast image string out of range" };
+		}
+		std::uint32_t length;	//not initialized!
+		std::memcpy(&length, strings + stringOffset, wordSize);
+		if(length > stringByteCount - stringOffset - wordSize){
+			throw std::runtime_error{ "Darkness ast image string out of range" };
+		}
+		const char* chars{ reinterpret_cast<const char*>(strings + stringOffset + wordSize) };
+		return { chars, length };
+	}
+
+	const std::uint32_t* AstImageReader::getList(std::uint32_t listOffset){
+		if(listOffset >= listWordCount || lists[listOffset] > listWordCount - listOffset - 1){
+			throw std::runtime_error{ "Darkness ast image list out of range" };
+		}
+		return lists + listOffset;
+	}
+}
\ No newline at end of file
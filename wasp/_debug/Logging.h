@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #ifdef _DEBUG
 
 #include <iostream>
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <vector>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
 
 #include "Utility/Void.h"
 
@@ -9,12 +12,29 @@ namespace wasp::channel {
 	class ChannelBase{
 	public:
 		virtual ~ChannelBase() = default;
+
+		virtual void clear() = 0;
+
+		//the most messages this channel has held at once
+		virtual std::size_t getHighWaterMark() const = 0;
+
+		//copying, for snapshots
+
+		//makes an empty channel of the same type
+		virtual std::unique_ptr<ChannelBase> makeEmpty() const = 0;
+		//makes the other channel, which must be of the same type, equal to this one
+		virtual void copyTo(ChannelBase& other) const = 0;
 	};
 
+	//Messages are kept in a buffer which holds on to its capacity when cleared. For
+	//trivially destructible messages clearing is O(1), so once a channel has reached
+	//its high-water mark, a tick's worth of messages costs no allocation at all.
 	template <typename T = utility::Void>
 	class Channel : public ChannelBase{
 	private:
 		std::vector<T> messages{};
+		//raised as messages are added, so erasing through getMessages cannot hide it
+		std::size_t highWaterMark{};
 
 	public:
 		Channel() = default;
@@ -38,16 +58,50 @@ namespace wasp::channel {
 
 		void addMessage(const T& message) {
 			messages.push_back(message);
+			updateHighWaterMark();
 		}
 
 		template <typename... Ts>
 		void emplaceMessage(Ts&&... args) {
 			messages.emplace_back(args...);
+			updateHighWaterMark();
 		}
 
-		void clear() {
+		void clear() override {
 			messages.clear();
 		}
+
+		std::size_t getHighWaterMark() const override {
+			return highWaterMark;
+		}
+
+		//makes room for the given number of messages up front
+		void reserve(std::size_t capacity) {
+			messages.reserve(capacity);
+		}
+
+		std::unique_ptr<ChannelBase> makeEmpty() const override {
+			return std::make_unique<Channel>();
+		}
+
+		void copyTo(ChannelBase& other) const override {
+			if constexpr (std::is_copy_assignable_v<T>) {
+				auto& otherChannel{ static_cast<Channel&>(other) };
+				otherChannel.messages = messages;
+				otherChannel.updateHighWaterMark();
+			}
+			else {
+				throw std::runtime_error{ "Error copying channel of uncopyable type" };
+			}
+		}
+
+	private:
+		//helper functions
+		void updateHighWaterMark() {
+			if (messages.size() > highWaterMark) {
+				highWaterMark = messages.size();
+			}
+		}
 	};
 
 	template<>
@@ -77,8 +131,21 @@ namespace wasp::channel {
 			++messages;
 		}
 
-		void clear() {
+		void clear() override {
 			messages = 0;
 		}
+
+		//only a count is kept, which never allocates
+		std::size_t getHighWaterMark() const override {
+			return 0;
+		}
+
+		std::unique_ptr<ChannelBase> makeEmpty() const override {
+			return std::make_unique<Channel>();
+		}
+
+		void copyTo(ChannelBase& other) const override {
+			static_cast<Channel&>(other).messages = messages;
+		}
 	};
 }
\ No newline at end of file
@@ -66,5 +66,44 @@ namespace wasp::channel {
 		void clear() {
 			channels.clear();
 		}
+
+		//empties every channel but keeps the channels and their capacity
+		void clearMessages() {
+			for (auto& channelPointer : channels) {
+				if (channelPointer) {
+					channelPointer->clear();
+				}
+			}
+		}
+
+		//returns the high-water mark of every channel, indexed by topic index; 0 for
+		//topics without a channel
+		std::vector<std::size_t> getHighWaterMarks() const {
+			std::vector<std::size_t> highWaterMarks(channels.size());
+			for (std::size_t i{ 0 }; i < channels.size(); ++i) {
+				if (channels[i]) {
+					highWaterMarks[i] = channels[i]->getHighWaterMark();
+				}
+			}
+			return highWaterMarks;
+		}
+
+		//makes the other channel set equal to this one, reusing its channels
+		void copyTo(ChannelSet& other) const {
+			if (other.channels.size() < channels.size()) {
+				other.channels.resize(channels.size());
+			}
+			for (std::size_t i{ 0 }; i < other.channels.size(); ++i) {
+				auto& otherPointer{ other.channels[i] };
+				if (i >= channels.size() || !channels[i]) {
+					otherPointer = nullptr;
+					continue;
+				}
+				if (!otherPointer) {
+					otherPointer = channels[i]->makeEmpty();
+				}
+				channels[i]->copyTo(*otherPointer);
+			}
+		}
 	};
 }
\ No newline at end of file
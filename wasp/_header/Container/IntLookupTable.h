@@ -2,6 +2,14 @@
 
 #include <vector>
 #include <string>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Utility/ValueHash.h"
 
 namespace wasp::container {
 
@@ -20,11 +28,31 @@ namespace wasp::container {
 	//a non-templated base class so that we can store pointers
 	class IntLookupTableBase {
 	public:
+		//typedefs
+		using Version = std::uint64_t;
+
 		virtual ~IntLookupTableBase() = default;
 		virtual int size() const = 0;
 		virtual bool contains(int sparseIndex) const = 0;
 		virtual bool remove(int sparseIndex) = 0;
 		virtual void clear() = 0;
+
+		//copying, for snapshots
+
+		//makes an empty table of the same type
+		virtual std::unique_ptr<IntLookupTableBase> makeEmpty() const = 0;
+		//makes the other table, which must be of the same type, equal to this one
+		virtual void copyTo(IntLookupTableBase& other) const = 0;
+		//true if the table can be written to and read from raw bytes
+		virtual bool canCopyAsBytes() const = 0;
+		//appends the table to the buffer; throws if it cannot be copied as bytes
+		virtual void writeBytes(std::vector<std::byte>& buffer) const = 0;
+		//replaces the table with one written by writeBytes and returns the bytes read
+		virtual std::size_t readBytes(const std::byte* data) = 0;
+
+		//folds the value at the sparse index into the hash, or returns the hash as it
+		//is if the value's type has no utility::ValueHash
+		virtual std::uint64_t hashValue(int sparseIndex, std::uint64_t hash) const = 0;
 	};
 
 	template <typename T>
@@ -36,6 +64,10 @@ namespace wasp::container {
 		//denseIndexToSparseIndex maps a dense index back to it's corresponding sparse index
 		std::vector<int> denseIndexToSparseIndex{};
 
+		//if versioned, every value has a version, which starts at 0 and is set by users
+		std::vector<Version> denseVersions{};
+		bool versioned{};
+
 		int currentSize{};
 
 	public:
@@ -97,7 +129,46 @@ namespace wasp::container {
 		}
 
 		const T& get(int sparseIndex) const {
-			return get(sparseIndex);
+			throwIfInvalidSparseIndex(sparseIndex);
+			int denseIndex{ sparseIndices[sparseIndex] };
+
+			throwIfInvalidDenseIndex(denseIndex);
+			return denseValues[denseIndex];
+		}
+
+		//versions
+
+		//gives every value a version, starting at 0
+		void enableVersions() {
+			if (!versioned) {
+				versioned = true;
+				denseVersions.assign(currentSize, 0);
+			}
+		}
+
+		bool isVersioned() const {
+			return versioned;
+		}
+
+		//returns 0 if not versioned
+		Version getVersion(int sparseIndex) const {
+			if (!versioned) {
+				return 0;
+			}
+			throwIfInvalidSparseIndex(sparseIndex);
+			return denseVersions[sparseIndices[sparseIndex]];
+		}
+
+		void setVersion(int sparseIndex, Version version) {
+			if (versioned) {
+				throwIfInvalidSparseIndex(sparseIndex);
+				denseVersions[sparseIndices[sparseIndex]] = version;
+			}
+		}
+
+		//the version of each value in dense order, or null if not versioned
+		const Version* getVersionData() const {
+			return versioned ? denseVersions.data() : nullptr;
 		}
 
 		//returns true if an element was removed, false otherwise
@@ -129,9 +200,115 @@ namespace wasp::container {
 			clearSparseIndices();
 			clearDenseValues();
 			clearDenseIndexToSparseIndex();
+			denseVersions.clear();
 			currentSize = 0;
 		}
 
+		std::unique_ptr<IntLookupTableBase> makeEmpty() const override {
+			auto emptyPointer{ std::make_unique<IntLookupTable>() };
+			if (versioned) {
+				emptyPointer->enableVersions();
+			}
+			return emptyPointer;
+		}
+
+		void copyTo(IntLookupTableBase& other) const override {
+			if constexpr (std::is_copy_assignable_v<T>) {
+				static_cast<IntLookupTable&>(other) = *this;
+			}
+			else {
+				throw std::runtime_error{ "Error copying table of uncopyable type" };
+			}
+		}
+
+		bool canCopyAsBytes() const override {
+			return copiesAsBytes;
+		}
+
+		//the layout is the size, the sparse index count, the sparse indices, the dense
+		//values, the dense index to sparse index of each value, whether the table is
+		//versioned and then the version of each value if so
+		void writeBytes(std::vector<std::byte>& buffer) const override {
+			if constexpr (copiesAsBytes) {
+				const std::uint64_t sparseCount{ sparseIndices.size() };
+				std::size_t offset{ buffer.size() };
+				buffer.resize(offset + getByteSize());
+				offset = writeRaw(buffer, offset, &currentSize, sizeof(currentSize));
+				offset = writeRaw(buffer, offset, &sparseCount, sizeof(sparseCount));
+				offset = writeRaw(
+					buffer,
+					offset,
+					sparseIndices.data(),
+					sparseIndices.size() * sizeof(int)
+				);
+				offset = writeRaw(buffer, offset, denseValues.data(), currentSize * sizeof(T));
+				offset = writeRaw(
+					buffer,
+					offset,
+					denseIndexToSparseIndex.data(),
+					currentSize * sizeof(int)
+				);
+				offset = writeRaw(buffer, offset, &versioned, sizeof(versioned));
+				if (versioned) {
+					writeRaw(buffer, offset, denseVersions.data(), currentSize * sizeof(Version));
+				}
+			}
+			else {
+				throw std::runtime_error{ "Error writing table which is not trivially copyable" };
+			}
+		}
+
+		std::size_t readBytes(const std::byte* data) override {
+			if constexpr (copiesAsBytes) {
+				const std::byte* const begin{ data };
+				std::uint64_t sparseCount{};
+				data = readRaw(data, &currentSize, sizeof(currentSize));
+				data = readRaw(data, &sparseCount, sizeof(sparseCount));
+
+				sparseIndices.resize(static_cast<std::size_t>(sparseCount));
+				data = readRaw(data, sparseIndices.data(), sparseIndices.size() * sizeof(int));
+
+				denseValues.resize(currentSize);
+				data = readRaw(data, denseValues.data(), currentSize * sizeof(T));
+
+				if (denseIndexToSparseIndex.size() < static_cast<std::size_t>(currentSize)) {
+					denseIndexToSparseIndex.resize(currentSize);
+				}
+				data = readRaw(data, denseIndexToSparseIndex.data(), currentSize * sizeof(int));
+				std::fill(
+					denseIndexToSparseIndex.begin() + currentSize,
+					denseIndexToSparseIndex.end(),
+					invalidIndex
+				);
+
+				data = readRaw(data, &versioned, sizeof(versioned));
+				denseVersions.resize(versioned ? currentSize : 0);
+				data = readRaw(data, denseVersions.data(), denseVersions.size() * sizeof(Version));
+				return static_cast<std::size_t>(data - begin);
+			}
+			else {
+				throw std::runtime_error{ "Error reading table which is not trivially copyable" };
+			}
+		}
+
+		std::uint64_t hashValue(int sparseIndex, std::uint64_t hash) const override {
+			if constexpr (utility::isValueHashed<T>) {
+				return utility::ValueHash<T>::hash(hash, get(sparseIndex));
+			}
+			else {
+				return hash;
+			}
+		}
+
+		//the values in dense order, of which there are size()
+		T* getDenseData() {
+			return denseValues.data();
+		}
+
+		const T* getDenseData() const {
+			return denseValues.data();
+		}
+
 		class Iterator;
 
 		Iterator begin() {
@@ -167,6 +344,10 @@ namespace wasp::container {
 
 		public:
 
+			int getCurrentDenseIndex() const {
+				return currentDenseIndex;
+			}
+
 			int getCurrentSparseIndex() {
 				intLookupTablePointer->throwIfInvalidDenseIndex(currentDenseIndex);
 
@@ -215,6 +396,41 @@ namespace wasp::container {
 		};
 
 	private:
+		//constants
+		static constexpr bool copiesAsBytes{
+			std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+		};
+
+		//snapshot helpers
+		std::size_t getByteSize() const {
+			return sizeof(currentSize) + sizeof(std::uint64_t)
+				+ sparseIndices.size() * sizeof(int)
+				+ currentSize * (sizeof(T) + sizeof(int))
+				+ sizeof(versioned) + (versioned ? currentSize * sizeof(Version) : 0);
+		}
+
+		static std::size_t writeRaw(
+			std::vector<std::byte>& buffer,
+			std::size_t offset,
+			const void* source,
+			std::size_t byteCount
+		) {
+			if (byteCount > 0) {
+				std::memcpy(buffer.data() + offset, source, byteCount);
+			}
+			return offset + byteCount;
+		}
+
+		static const std::byte* readRaw(
+			const std::byte* data,
+			void* destination,
+			std::size_t byteCount
+		) {
+			if (byteCount > 0) {
+				std::memcpy(destination, data, byteCount);
+			}
+			return data + byteCount;
+		}
 
 		//clearing functions
 		void clearSparseIndices() {
@@ -234,7 +450,7 @@ namespace wasp::container {
 		void growSparseIndices(int largestSparseIndex) {
 			int newSize{ largestSparseIndex + 1 };
 			newSize = static_cast<int>(newSize * sparseIndexGrowRatio);
-			unsigned int growBy{ static_cast<unsigned int>(newSize) - sparseIndices.size() };
+			auto growBy{ static_cast<std::vector<int>::size_type>(newSize) - sparseIndices.size() };
 			sparseIndices.insert(sparseIndices.end(), growBy, invalidIndex);
 		}
 
@@ -248,7 +464,7 @@ namespace wasp::container {
 		}
 		bool isValidDenseIndex(int denseIndex) const {
 			return (denseIndex >= 0) 
-				&& (static_cast<std::vector<T>::size_type>(denseIndex) < denseValues.size());
+				&& (static_cast<typename std::vector<T>::size_type>(denseIndex) < denseValues.size());
 		}
 		bool isInvalidDenseIndex(int denseIndex) const {
 			return !isValidDenseIndex(denseIndex);
@@ -261,6 +477,9 @@ namespace wasp::container {
 			invalidateSparseIndex(denseIndexToSparseIndex[currentSize]);
 			invalidateDenseIndexToSparseIndex(currentSize);
 			removeDenseValueAtCurrentSize();
+			if (versioned) {
+				denseVersions.pop_back();
+			}
 		}
 		void invalidateSparseIndex(int sparseIndex) {
 			throwIfInvalidSparseIndex(sparseIndex);
@@ -288,6 +507,10 @@ namespace wasp::container {
 			denseValues[denseIndex] = std::move(denseValues[currentSize]);
 			//erase old B
 			removeDenseValueAtCurrentSize();
+			if (versioned) {
+				denseVersions[denseIndex] = denseVersions[currentSize];
+				denseVersions.pop_back();
+			}
 
 			int sparseIndexA{ denseIndexToSparseIndex[denseIndex] };
 			int sparseIndexB{ denseIndexToSparseIndex[currentSize] };
@@ -309,7 +532,7 @@ namespace wasp::container {
 
 		void appendToBack(int sparseIndex, const T& value) {
 			sparseIndices[sparseIndex] = currentSize;
-			if (static_cast<std::vector<T>::size_type>(currentSize) 
+			if (static_cast<typename std::vector<T>::size_type>(currentSize) 
 				< denseValues.size()) 
 			{
 				denseValues[currentSize] = std::move(value);
@@ -326,6 +549,9 @@ namespace wasp::container {
 			else {
 				denseIndexToSparseIndex.push_back(sparseIndex);
 			}
+			if (versioned) {
+				denseVersions.push_back(0);
+			}
 			++currentSize;
 		}
 
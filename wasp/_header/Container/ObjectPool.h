@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <deque>
 #include <stack>
 #include <functional>
 
@@ -9,7 +10,8 @@
 namespace wasp::container {
 
 	//NOT threadsafe
-	//NOT tested, no clue if this works or not (yet)
+	//Hands out objects which go back to the pool when their pointer is destroyed, where
+	//the reclaimer gets them ready for reuse. Objects outliving the pool are deleted.
 	template <
 		typename T, 
 		typename Allocator = std::allocator<T>
@@ -17,7 +19,7 @@ namespace wasp::container {
 	class ObjectPool {
 	private:
 		//type aliases
-		using reclaimer_type = std::function<void(T)>;
+		using reclaimer_type = std::function<void(T&)>;
 		using internal_pointer_type = std::unique_ptr<T>;
 		using internal_pointer_allocator_type =
 			typename std::allocator_traits<Allocator>::template
@@ -36,10 +38,18 @@ namespace wasp::container {
 		private:
 			std::weak_ptr<ObjectPool> poolPointer{};
 		public:
+			//deletes without a pool
+			PoolElementDeleter() = default;
+			
 			explicit PoolElementDeleter(std::weak_ptr<ObjectPool> poolPointer)
 				: poolPointer{ poolPointer } {
 			}
 
+			//null if the object has no pool or its pool is gone
+			std::shared_ptr<ObjectPool> getPool() const {
+				return poolPointer.lock();
+			}
+
 			void operator()(T* pointer) {
 				if (std::shared_ptr<ObjectPool> sharedPointer = poolPointer.lock()) {
 					try {
@@ -56,7 +66,7 @@ namespace wasp::container {
 		};
 
 		//by default do not do any reclaim operations
-		static void defaultReclaimFunction(T) {};
+		static void defaultReclaimFunction(T&) {};
 
 		//fields
 		std::weak_ptr<ObjectPool> selfPointer{};
@@ -67,16 +77,16 @@ namespace wasp::container {
 		ObjectPool() {} //private default constructor throws compile error
 		ObjectPool(size_type initialSize) {
 			for (size_type i{ 0 }; i < initialSize; ++i) {
-				storage.emplace();
+				storage.push(std::make_unique<T>());
 			}
 		}
-		ObjectPool(std::function<void(T)> reclaimer)
+		ObjectPool(reclaimer_type reclaimer)
 			: reclaimer{ reclaimer } {
 		}
-		ObjectPool(std::function<void(T)> reclaimer, size_type initialSize) 
+		ObjectPool(reclaimer_type reclaimer, size_type initialSize) 
 			: reclaimer{ reclaimer } {
 			for (size_type i{ 0 }; i < initialSize; ++i) {
-				storage.emplace();
+				storage.push(std::make_unique<T>());
 				this->reclaimer(*(storage.top().get()));
 			}
 		}
@@ -92,7 +102,7 @@ namespace wasp::container {
 		pointer_type acquire() {
 			//construct new element if necessary
 			if (storage.empty()) {
-				storage.emplace();
+				storage.push(std::make_unique<T>());
 			}
 			//package with our deleter
 			pointer_type toRet{
@@ -103,6 +113,21 @@ namespace wasp::container {
 			return toRet;
 		}
 
+		//Copy assigns the given object into one acquired from the pool it came from,
+		//so the copy goes back to that pool too. Without a pool the copy is allocated
+		//and deleted normally.
+		static pointer_type acquireCopy(const pointer_type& pointer) {
+			if (!pointer) {
+				return {};
+			}
+			if (std::shared_ptr<ObjectPool> poolPointer = pointer.get_deleter().getPool()) {
+				pointer_type toRet{ poolPointer->acquire() };
+				*toRet = *pointer;
+				return toRet;
+			}
+			return pointer_type{ new T{ *pointer }, PoolElementDeleter{} };
+		}
+
 		void reclaim(std::unique_ptr<T> uniquePointer) {
 			storage.push(std::move(uniquePointer));
 			reclaimer(*(storage.top().get()));
@@ -6,9 +6,11 @@
 
 #include "ComponentSet.h"
 #include "ComponentIndexer.h"
+#include "ChangeTracking.h"
 #include "ArchetypeIterator.h"
 #include "Container/IntLookupTable.h"
 #include "ECS/Entity/EntityID.h"
+#include "ECS/DataStorageSnapshot.h"
 
 namespace wasp::ecs::component {
 
@@ -32,6 +34,7 @@ namespace wasp::ecs::component {
 
         //fields
         const ComponentSet* const componentKeyPointer{};
+        const ChangeVersion* const changeVersionPointer{};   //the current version
         const std::size_t initEntityCapacity{};
         const std::size_t initComponentCapacity{};
         //using unique_ptr to point to base class
@@ -41,10 +44,12 @@ namespace wasp::ecs::component {
 
         Archetype(
             const ComponentSet* const componentKeyPointer,
+            const ChangeVersion* const changeVersionPointer,
             std::size_t initEntityCapacity,
             std::size_t initComponentCapacity
         ) 
             : componentKeyPointer{ componentKeyPointer }
+            , changeVersionPointer{ changeVersionPointer }
             , initEntityCapacity{ initEntityCapacity }
             , initComponentCapacity{ initComponentCapacity }
             , componentStorages(maxComponents) {
@@ -55,8 +60,11 @@ namespace wasp::ecs::component {
     public:
 
         //component access
+        
+        //counts as a change
         template <typename T>
         T& getComponent(const EntityID entityID) {
+            markChanged<T>(entityID);
             return getComponentStorage<T>().get(entityID);
         }
 
@@ -65,6 +73,18 @@ namespace wasp::ecs::component {
             return getComponentStorage<T>().get(entityID);
         }
 
+        //the components T of every entity, in the order every table shares; does
+        //not count as a change
+        template <typename T>
+        T* getDenseData() {
+            return getComponentStorage<T>().getDenseData();
+        }
+
+        template <typename T>
+        int getSize() {
+            return getComponentStorage<T>().size();
+        }
+
         template <typename T>
         bool setComponent(const EntityID entityID, T& component) {
             //this bit of code causes the compiler to generate a moveComponent func
@@ -73,13 +93,55 @@ namespace wasp::ecs::component {
                     moveComponent<T>
             };
 
-            return getComponentStorage<T>().set(entityID, component);
+            bool replaced{ getComponentStorage<T>().set(entityID, component) };
+            markChanged<T>(entityID);
+            return replaced;
+        }
+
+        //change tracking
+        template <typename T>
+        void markChanged(const EntityID entityID) {
+            if constexpr (tracksChanges<T>) {
+                getComponentStorage<T>().setVersion(
+                    static_cast<int>(entityID), 
+                    *changeVersionPointer
+                );
+            }
+        }
+
+        //the change version of each entity in iteration order
+        template <typename T>
+        const ChangeVersion* getChangeVersions() {
+            return getComponentStorage<T>().getVersionData();
         }
         
         void moveEntity(const EntityID entityID, Archetype& newArchetype);
 
         bool removeEntity(const EntityID entityID);
 
+        //snapshots
+
+        //copies every component table into the archetype snapshot, appending those
+        //which can be copied as bytes to the buffer
+        void writeSnapshot(
+            DataStorageSnapshot::ArchetypeSnapshot& archetypeSnapshot,
+            std::vector<std::byte>& buffer
+        ) const;
+
+        //replaces the tables in the archetype snapshot; others are left as they are,
+        //so they should be cleared first
+        void readSnapshot(
+            const DataStorageSnapshot::ArchetypeSnapshot& archetypeSnapshot,
+            const std::vector<std::byte>& buffer
+        );
+
+        //removes every entity but keeps the tables
+        void clearComponents();
+
+        //folds the type index and, where its type has a utility::ValueHash, the value
+        //of every component of the entity into the hash
+        std::uint64_t hashEntity(const EntityID entityID, std::uint64_t hash) const;
+
         //iteration
         template <typename... Ts>
         ArchetypeIterator<Ts...> begin() {
@@ -117,15 +179,32 @@ namespace wasp::ecs::component {
                 };
             }
             if (!componentStorages[typeIndex]) {
-                componentStorages[typeIndex] = std::make_unique<IntLookupTable<T>>(
+                auto storagePointer{ std::make_unique<IntLookupTable<T>>(
                     initEntityCapacity,
                     initComponentCapacity
-                );
+                ) };
+                if constexpr (tracksChanges<T>) {
+                    storagePointer->enableVersions();
+                }
+                componentStorages[typeIndex] = std::move(storagePointer);
             }
             IntLookupTableBase& base{ *componentStorages[typeIndex] };
             return static_cast<IntLookupTable<T>&>(base);
         }
 
+        //the const version throws instead of making the table
+        template <typename T>
+        const IntLookupTable<T>& getComponentStorage() const {
+            std::size_t typeIndex{ ComponentIndexer::getIndex<T>() };
+            if (typeIndex >= componentStorages.size() || !componentStorages[typeIndex]) {
+                throw std::runtime_error{
+                    "no component storage for type index " + std::to_string(typeIndex)
+                };
+            }
+            const IntLookupTableBase& base{ *componentStorages[typeIndex] };
+            return static_cast<const IntLookupTable<T>&>(base);
+        }
+
         //one move component function gets instantiated for every set component
         //and is placed in the move component v table
         template <typename T>
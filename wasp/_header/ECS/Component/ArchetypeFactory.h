@@ -10,6 +10,7 @@ namespace wasp::ecs::component {
     private:
         std::size_t initEntityCapacity{};
         std::size_t initComponentCapacity{};
+        const ChangeVersion* changeVersionPointer{};
 
         //throwing around raw pointers to elements in a vector is a HORRIBLE idea,
         //therefore we use shared_ptr
@@ -21,11 +22,17 @@ namespace wasp::ecs::component {
         ArchetypeFactory(
             std::size_t initEntityCapacity,
             std::size_t initComponentCapacity,
+            const ChangeVersion* changeVersionPointer,
             ComponentSetFactory& componentSetFactory
         );
 
         void clear();
 
+        //every archetype in the order it was made
+        const std::vector<std::shared_ptr<Archetype>>& getArchetypePointers() const {
+            return archetypePointers;
+        }
+
         //setting callbacks
         void setNewArchetypeCallback(
             const std::function<void(std::shared_ptr<Archetype>)>& newArchetypeCallback
@@ -39,6 +39,11 @@ namespace wasp::ecs::component {
 			return std::get<0>(innerIteratorTuple).getCurrentSparseIndex();
 		}
 
+		//every table of an archetype keeps its entities in the same order
+		int getDenseIndex() const {
+			return std::get<0>(innerIteratorTuple).getCurrentDenseIndex();
+		}
+
 		ReturnType operator*() {
 			return std::apply(
 				unpackTuple<Ts...>,
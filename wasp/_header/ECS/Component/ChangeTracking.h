@@ -0,0 +1,35 @@
+#pragma once
+
+#include <type_traits>
+
+#include "Container/IntLookupTable.h"
+
+namespace wasp::ecs::component {
+
+    //typedefs
+    using ChangeVersion = container::IntLookupTableBase::Version;
+
+    //Specialize to true_type for components which should remember when each entity's
+    //component last changed. Mutable access and setComponent count as changes.
+    template <typename T>
+    struct TracksChanges : std::false_type {};
+
+    template <typename T>
+    constexpr bool tracksChanges{ TracksChanges<T>::value };
+
+    //a filter for Group::groupIterator passing only entities in which any of the
+    //components Ts changed after the given version
+    template <typename... Ts>
+    struct ChangedSince {
+        static_assert(
+            (tracksChanges<Ts> && ...), 
+            "changedSince needs components which track changes"
+        );
+        ChangeVersion version{};
+    };
+
+    template <typename... Ts>
+    ChangedSince<Ts...> changedSince(ChangeVersion version) {
+        return ChangedSince<Ts...>{ version };
+    }
+}
\ No newline at end of file
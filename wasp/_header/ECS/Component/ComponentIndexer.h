@@ -1,19 +1,43 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
+
+#include "ComponentRegistry.h"
 
 namespace wasp::ecs::component {
     //thanks to a user named DragonSlayer0531
 
     class ComponentIndexer{
     private:
+        //typedefs
+
+        //depends on T so the game's specialization is looked up when T is used,
+        //not when this header is read
+        template <typename T>
+        using Registered = typename RegisteredComponents<std::void_t<T>>::type;
+
         static std::size_t indexCounter;
 
     public:
+        //registered types have fixed indices; the rest are numbered after them
         template <typename T>
         static std::size_t getIndex() {
-            static std::size_t typeIndex = indexCounter++;
-            return typeIndex;
+            static_assert(Registered<T>::size <= maxComponents, "too many components");
+            static_assert(Registered<T>::isUnique(), "component registered twice");
+
+            if constexpr (isRegistered<T>()) {
+                return Registered<T>::template indexOf<T>();
+            }
+            else {
+                static std::size_t typeIndex = Registered<T>::size + indexCounter++;
+                return typeIndex;
+            }
+        }
+
+        template <typename T>
+        static constexpr bool isRegistered() {
+            return Registered<T>::template contains<T>();
         }
     };
 }
\ No newline at end of file
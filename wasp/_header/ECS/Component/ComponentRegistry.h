@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace wasp::ecs::component {
+
+    constexpr std::size_t maxComponents{ 96 };
+
+    //A set of type indices which can be built at compile time.
+    struct ComponentMask {
+        //constants
+        static constexpr std::size_t bitsPerWord{ 64 };
+        static constexpr std::size_t numWords{
+            (maxComponents + bitsPerWord - 1) / bitsPerWord
+        };
+
+        //fields
+        std::array<std::uint64_t, numWords> words{};
+
+        constexpr void set(std::size_t typeIndex) {
+            words[typeIndex / bitsPerWord] |= std::uint64_t{ 1 } << (typeIndex % bitsPerWord);
+        }
+
+        constexpr bool test(std::size_t typeIndex) const {
+            return (words[typeIndex / bitsPerWord] >> (typeIndex % bitsPerWord)) & 1;
+        }
+
+        constexpr bool containsAll(const ComponentMask& other) const {
+            for (std::size_t i{ 0 }; i < numWords; ++i) {
+                if ((words[i] & other.words[i]) != other.words[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        constexpr std::size_t count() const {
+            std::size_t toRet{ 0 };
+            for (std::uint64_t word : words) {
+                for (; word != 0; word &= word - 1) {
+                    ++toRet;
+                }
+            }
+            return toRet;
+        }
+    };
+
+    //A compile time list of component types. The position of a type in the list is its
+    //type index.
+    template <typename... Ts>
+    struct ComponentList {
+        static constexpr std::size_t size{ sizeof...(Ts) };
+
+        template <typename T>
+        static constexpr bool contains() {
+            return (std::is_same_v<T, Ts> || ...);
+        }
+
+        template <typename T>
+        static constexpr std::size_t indexOf() {
+            static_assert(contains<T>(), "type is not in the component list");
+            //the extra entry keeps the array from being empty
+            constexpr bool matches[]{ std::is_same_v<T, Ts>..., false };
+            std::size_t index{ 0 };
+            while (!matches[index]) {
+                ++index;
+            }
+            return index;
+        }
+
+        template <typename... Us>
+        static constexpr ComponentMask maskOf() {
+            ComponentMask mask{};
+            (mask.set(indexOf<Us>()), ...);
+            return mask;
+        }
+
+        //true if no type is listed twice
+        static constexpr bool isUnique() {
+            return maskOf<Ts...>().count() == size;
+        }
+    };
+
+    //The component types known ahead of time. Specialize this with a ComponentList to
+    //give each type a fixed index; any other type is indexed when first used. The
+    //specialization must be visible wherever a listed type is used as a component.
+    template <typename Tag = void>
+    struct RegisteredComponents {
+        using type = ComponentList<>;
+    };
+}
\ No newline at end of file
@@ -10,8 +10,6 @@
 
 namespace wasp::ecs::component {
 
-    constexpr std::size_t maxComponents{ 96 };
-
     //forward declaration of Archetype to handle circular dependency
     class Archetype;
 
@@ -55,27 +53,21 @@ namespace wasp::ecs::component {
         ComponentSet(const std::vector<std::size_t>& typeIndices);
 
         //factory method for constructing a component set based on the 
-        //provided template component types
+        //provided template component types; the present type indices are left to
+        //be made lazily, so looking up an existing set does not allocate
         template <typename... Ts>
         static ComponentSet makeComponentSetFromVariadicTemplate() {
             std::size_t numComponents{ sizeof... (Ts) };
             Bitset bitset{};
-            std::vector<std::size_t> presentTypeIndices{};
             (bitset.set(ComponentIndexer::getIndex<Ts>()), ...);
-            (presentTypeIndices.push_back(ComponentIndexer::getIndex<Ts>()), ...);
 
-            return ComponentSet{ bitset, numComponents, presentTypeIndices };
+            return ComponentSet{ bitset, numComponents };
         }
 
         //helper constructor for the factory method
-        ComponentSet(
-            const Bitset& bitset,
-            std::size_t numComponents,
-            const std::vector<std::size_t>& presentTypeIndices
-        )
+        ComponentSet(const Bitset& bitset, std::size_t numComponents)
             : bitset{ bitset }
-            , numComponents{ numComponents }
-            , presentTypeIndices{ presentTypeIndices } {
+            , numComponents{ numComponents } {
         }
 
     public:
@@ -132,14 +124,12 @@ namespace wasp::ecs::component {
         //modifiers
         template <typename T>
         ComponentSet addComponent() const {
-            makePresentTypeIndices();   //make sure our state is good for cloning
             const std::size_t index{ ComponentIndexer::getIndex<T>() };
             //if we need to add a component
             if (!bitset[index]) {
-                ComponentSet toRet{ *this };
+                //present type indices are made lazily if this set is new
+                ComponentSet toRet{ bitset, numComponents + 1 };
                 toRet.bitset.set(index);
-                toRet.numComponents = numComponents + 1;
-                toRet.presentTypeIndices.push_back(index);
                 return toRet;
             }
             //otherwise return ourselves
@@ -168,7 +158,7 @@ namespace wasp::ecs::component {
             }
             makePresentTypeIndices();   //make sure our state is good for cloning
             std::vector<std::size_t> indicesToAdd{};
-            (indicesToAdd.push_back(ComponentIndexer.getIndex<Ts>), ...);
+            (indicesToAdd.push_back(ComponentIndexer::getIndex<Ts>()), ...);
             ComponentSet toRet{ *this };
             for (std::size_t index : indicesToAdd) {
                 if (!bitset[index]) {
@@ -186,7 +176,7 @@ namespace wasp::ecs::component {
                 throw std::runtime_error{ "zero type parameters!" };
             }
             std::vector<std::size_t> indicesToRemove{};
-            (indicesToRemove.push_back(ComponentIndexer.getIndex<Ts>), ...);
+            (indicesToRemove.push_back(ComponentIndexer::getIndex<Ts>()), ...);
             ComponentSet toRet{};
             toRet.bitset = bitset;
             for (std::size_t index : indicesToRemove) {
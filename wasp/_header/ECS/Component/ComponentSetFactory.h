@@ -1,6 +1,7 @@
 #pragma once
 
 #include <unordered_set>
+#include <vector>
 #include <functional>
 
 #include "ComponentSet.h"
@@ -41,6 +42,11 @@ namespace wasp::ecs::component {
             return getCanonicalSetAndBroadcastIfNew(ComponentSet{ typeIndex });
         }
 
+        //returns a component set with the specified type indices
+        const ComponentSet& makeSet(const std::vector<std::size_t>& typeIndices) {
+            return getCanonicalSetAndBroadcastIfNew(ComponentSet{ typeIndices });
+        }
+
         template <typename T>
         const ComponentSet& addComponent(const ComponentSet& base) {
             return getCanonicalSetAndBroadcastIfNew(base.addComponent<T>());
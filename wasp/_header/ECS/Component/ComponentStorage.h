@@ -1,8 +1,13 @@
 #pragma once
 
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
 #include "GroupFactory.h"
 #include "ECS/CriticalOrders.h"
 #include "ECS/Entity/EntityID.h"
+#include "ECS/DataStorageSnapshot.h"
 
 namespace wasp::ecs::component {
     class ComponentStorage {
@@ -12,6 +17,7 @@ namespace wasp::ecs::component {
 
         //fields
         ComponentSetFactory componentSetFactory{};
+        ChangeVersion changeVersion{ 1 };   //every archetype points to this
         ArchetypeFactory archetypeFactory;  //not initialized!
         GroupFactory groupFactory;          //not initialized!
 
@@ -23,6 +29,24 @@ namespace wasp::ecs::component {
 
         void recreate();
 
+        //removes every entity but keeps the component sets, archetypes and groups
+        void clearEntities();
+
+        //Copies every archetype into the snapshot and maps each canonical component
+        //set to the index of its archetype in the snapshot.
+        void snapshot(
+            DataStorageSnapshot& snapshot,
+            std::unordered_map<const ComponentSet*, std::uint32_t>& archetypeIndices
+        ) const;
+
+        //Replaces every component with those in the snapshot and gives the canonical
+        //component set of each archetype in the snapshot, in order. Archetypes which
+        //no longer exist are made again.
+        void restore(
+            const DataStorageSnapshot& snapshot,
+            std::vector<const ComponentSet*>& componentSetPointers
+        );
+
         template <typename... Ts>
         Group* getGroupPointer() {
             return groupFactory.getGroupPointer(componentSetFactory.makeSet<Ts...>());
@@ -34,12 +58,27 @@ namespace wasp::ecs::component {
                 ->getComponent<T>(entityID);
         }
 
+        //does not count as a change
         template <typename T>
         const T& getComponent(EntityID entityID, const ComponentSet& componentSet) 
             const 
         {
-            return componentSet.getAssociatedArchetypeWeakPointer().lock()
-                ->getComponent<T>(entityID);
+            std::shared_ptr<const Archetype> archetypePointer{
+                componentSet.getAssociatedArchetypeWeakPointer().lock()
+            };
+            return archetypePointer->getComponent<T>(entityID);
+        }
+
+        //change tracking
+        template <typename T>
+        void markChanged(EntityID entityID, const ComponentSet& componentSet) {
+            componentSet.getAssociatedArchetypeWeakPointer().lock()
+                ->markChanged<T>(entityID);
+        }
+
+        //returns the current change version and moves on to the next
+        ChangeVersion advanceChangeVersion() {
+            return changeVersion++;
         }
 
         //returns a pointer to the new component set if successful, nullptr otherwise
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdexcept>
+#include <tuple>
 #include <vector>
 
 #include "Container/IntLookupTable.h"
@@ -53,6 +54,53 @@ namespace wasp::ecs::component {
             return GroupIterator{ archetypeIterators };
         }
 
+        //only visits entities in which any of the components Us changed after the
+        //version given to changedSince
+        template <typename... Ts, typename... Us>
+        GroupIterator<Ts...> groupIterator(ChangedSince<Us...> changedSince) {
+            throwIfInvalidTypes<Ts...>();
+            throwIfInvalidTypes<Us...>();
+            std::vector<std::pair<ArchetypeIterator<Ts...>, ArchetypeIterator<Ts...>>> 
+                archetypeIterators{};
+            std::vector<const ChangeVersion*> changeVersionPointers{};
+            for (std::shared_ptr<Archetype>& archetypePointer : archetypePointers) {
+                archetypeIterators.push_back(
+                    { 
+                        archetypePointer->begin<Ts...>(), 
+                        archetypePointer->end<Ts...>() 
+                    }
+                );
+                (changeVersionPointers.push_back(
+                    archetypePointer->getChangeVersions<Us>()
+                ), ...);
+            }
+            return GroupIterator<Ts...>{
+                std::move(archetypeIterators),
+                std::move(changeVersionPointers),
+                sizeof...(Us),
+                changedSince.version
+            };
+        }
+
+        //Calls function once per archetype holding any entities, with a pointer to the
+        //first component of each type Ts and then the number of entities. Entity i of
+        //an archetype has the ith component of every array. This lets a system run a
+        //tight loop over contiguous memory; it does not count as a change.
+        template <typename... Ts, typename Function>
+        void forEachArchetype(Function&& function) {
+            throwIfInvalidTypes<Ts...>();
+            using FirstType = std::tuple_element_t<0, std::tuple<Ts...>>;
+            for (std::shared_ptr<Archetype>& archetypePointer : archetypePointers) {
+                int size{ archetypePointer->getSize<FirstType>() };
+                if (size > 0) {
+                    function(
+                        archetypePointer->getDenseData<Ts>()...,
+                        static_cast<std::size_t>(size)
+                    );
+                }
+            }
+        }
+
     private:
         void addChildGroup(Group* childGroupPointer);
 
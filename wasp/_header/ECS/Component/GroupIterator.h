@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "ArchetypeIterator.h"
+#include "ChangeTracking.h"
 
 namespace wasp::ecs::component {
 
@@ -22,6 +23,12 @@ namespace wasp::ecs::component {
 		//held in pairs of current/end iterators
 		InnerIteratorVectorType innerIterators;
 
+		//if filtering by change, holds the change versions of each filtered component
+		//for each archetype, in that order
+		std::vector<const ChangeVersion*> changeVersionPointers{};
+		std::size_t changedCount{};
+		ChangeVersion sinceVersion{};
+
 	public:
 		GroupIterator(InnerIteratorVectorType innerIterators)
 			: currentIteratorPairIndex{ 0 }
@@ -30,9 +37,34 @@ namespace wasp::ecs::component {
 			skipToNextValidArchetype();
 		}
 
+		//only visits entities with a filtered component changed after sinceVersion
+		GroupIterator(
+			InnerIteratorVectorType innerIterators,
+			std::vector<const ChangeVersion*> changeVersionPointers,
+			std::size_t changedCount,
+			ChangeVersion sinceVersion
+		)
+			: currentIteratorPairIndex{ 0 }
+			, innerIterators{ std::move(innerIterators) }
+			, changeVersionPointers{ std::move(changeVersionPointers) }
+			, changedCount{ changedCount }
+			, sinceVersion{ sinceVersion }
+		{
+			skipToNextValidArchetype();
+		}
+
+		//also skips entities which do not pass the change filter
 		void skipToNextValidArchetype() {
-			while (isValid() && (getCurrentIterator() == getCurrentEndIterator())) {
-				++currentIteratorPairIndex;
+			while (isValid()) {
+				if (getCurrentIterator() == getCurrentEndIterator()) {
+					++currentIteratorPairIndex;
+				}
+				else if (!hasCurrentChanged()) {
+					++getCurrentIterator();
+				}
+				else {
+					break;
+				}
 			}
 		}
 
@@ -72,5 +104,19 @@ namespace wasp::ecs::component {
 		InnerIteratorType& getCurrentEndIterator() {
 			return std::get<1>(innerIterators[currentIteratorPairIndex]);
 		}
+
+		bool hasCurrentChanged() {
+			if (changedCount == 0) {
+				return true;
+			}
+			int denseIndex{ getCurrentIterator().getDenseIndex() };
+			std::size_t begin{ currentIteratorPairIndex * changedCount };
+			for (std::size_t i{ begin }; i < begin + changedCount; ++i) {
+				if (changeVersionPointers[i][denseIndex] > sinceVersion) {
+					return true;
+				}
+			}
+			return false;
+		}
 	};
 }
\ No newline at end of file
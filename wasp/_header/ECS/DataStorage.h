@@ -1,8 +1,11 @@
 #pragma once
 
+#include <optional>
+
 #include "ECS/Component/ComponentStorage.h"
 #include "ECS/Entity/EntityMetadataStorage.h"
 #include "ECS/Entity/EntityID.h"
+#include "ECS/DataStorageSnapshot.h"
 
 namespace wasp::ecs {
     class DataStorage {
@@ -15,11 +18,17 @@ namespace wasp::ecs {
         using ComponentStorage = component::ComponentStorage;
         using ComponentSet = component::ComponentSet;
         using Group = component::Group;
+        using ChangeVersion = component::ChangeVersion;
 
         //fields (not initialized!)
         EntityMetadataStorage entityMetadataStorage;
         ComponentStorage componentStorage;
 
+        //counts up across every data storage
+        static std::uint64_t groupEpochCounter;
+
+        std::uint64_t groupEpoch{ ++groupEpochCounter };
+
     public:
 
         //constructs a DataStorage with the specified initial entity capacity
@@ -32,8 +41,33 @@ namespace wasp::ecs {
         void recreate() {
             entityMetadataStorage.clear();
             componentStorage.recreate();
+            groupEpoch = ++groupEpochCounter;
         }
 
+        //Removes every entity like recreate, but keeps every archetype and group along
+        //with the capacity of their tables, so refilling allocates nothing new.
+        void clearEntities() {
+            entityMetadataStorage.clear();
+            componentStorage.clearEntities();
+        }
+
+        //snapshots
+
+        //Copies every entity and component into the snapshot, reusing its memory.
+        //Components which are not trivially copyable must be copy assignable.
+        void snapshot(DataStorageSnapshot& snapshot) const;
+
+        //Makes this data storage equal to the one the snapshot was taken from.
+        //Existing groups are kept, and see the restored entities.
+        //Handles made after the snapshot are dead afterwards, even if their
+        //entity ID is reused.
+        void restore(const DataStorageSnapshot& snapshot);
+
+        //Returns a hash of every live entity: its ID, generation, relations, component
+        //types, and the values of those components with a utility::ValueHash. The
+        //hash depends on nothing but those, so two runs in step hash the same.
+        std::uint64_t getHash() const;
+
         //data query functions
         //the overloads that take an EntityHandle check for generation matching
 
@@ -43,6 +77,13 @@ namespace wasp::ecs {
             return componentStorage.getGroupPointer<Ts...>();
         }
 
+        //Returns a number no other data storage shares, which changes only when
+        //recreate throws away the groups. Group pointers may be kept as long as it
+        //stays the same.
+        std::uint64_t getGroupEpoch() const {
+            return groupEpoch;
+        }
+
         //checks if the given entityID is alive and matches the generation
         bool isAlive(EntityHandle entityHandle) const {
             return entityMetadataStorage.isAlive(entityHandle);
@@ -130,7 +171,8 @@ namespace wasp::ecs {
         }
 
         //retrieves the specified component for the given entity handle, throwing
-        //if the entity either does not have that component or is dead
+        //if the entity either does not have that component or is dead. The non-const
+        //versions count as a change to the component
         template <typename T>
         T& getComponent(EntityHandle entityHandle) {
             if (isAlive(entityHandle)) {
@@ -209,10 +251,94 @@ namespace wasp::ecs {
             throw std::runtime_error{ "tried to get component of dead entity!" };
         }
 
+        //change tracking, for components which specialize TracksChanges
+
+        //Marks the specified component of the given entityID as changed, for writes
+        //made through group iterators. Throws like getComponent.
+        template <typename T>
+        void markChanged(EntityID entityID) {
+            if (!containsComponent<T>(entityID)) {
+                throw std::runtime_error{ "tried to mark missing component as changed!" };
+            }
+            componentStorage.markChanged<T>(entityID, *getComponentSetPointer(entityID));
+        }
+
+        //Returns a version to give changedSince later; every change made after this
+        //call is newer than the version returned.
+        ChangeVersion advanceChangeVersion() {
+            return componentStorage.advanceChangeVersion();
+        }
+
         //Returns an entity handle for the entity with the specified entityID of the
         //current generation. Throws runtime_error if there is no such alive entity.
         EntityHandle makeHandle(EntityID entityID) const;
 
+        //entity relations
+        //an entity has at most one parent; removing an entity removes it from its
+        //parent and leaves its children without one
+
+        //Makes the parent the parent of the child, replacing any parent the child had.
+        //Returns false if either entity is dead. Throws runtime_error if the child is
+        //the parent or one of its ancestors.
+        bool setParent(EntityHandle childHandle, EntityHandle parentHandle);
+
+        //returns true if the child had a parent to remove, false otherwise
+        bool removeParent(EntityHandle childHandle);
+
+        //returns the parent of the given entity, or nothing if it has none or is dead
+        std::optional<EntityHandle> getParent(EntityHandle entityHandle) const;
+
+        //Calls the function with the handle of each child of the given entity, most
+        //recently added first. The function must not change any relation or remove
+        //any entity.
+        template <typename Function>
+        void forEachChild(EntityHandle entityHandle, Function&& function) const {
+            if (isDead(entityHandle)) {
+                return;
+            }
+            EntityID childID{
+                entityMetadataStorage.getRelations(entityHandle.entityID).firstChildID
+            };
+            while (childID != entity::noEntityID) {
+                function(makeHandle(childID));
+                childID = entityMetadataStorage.getRelations(childID).nextSiblingID;
+            }
+        }
+
+        //Calls the function with the handle of every descendant of the given entity,
+        //each before its own children, under the same rules as forEachChild.
+        template <typename Function>
+        void forEachDescendant(EntityHandle entityHandle, Function&& function) const {
+            if (isDead(entityHandle)) {
+                return;
+            }
+            const EntityID rootID{ entityHandle.entityID };
+            EntityID currentID{ entityMetadataStorage.getRelations(rootID).firstChildID };
+            while (currentID != entity::noEntityID) {
+                function(makeHandle(currentID));
+
+                //walk down if possible, otherwise across, otherwise back up and across
+                const auto& relations{ entityMetadataStorage.getRelations(currentID) };
+                if (relations.firstChildID != entity::noEntityID) {
+                    currentID = relations.firstChildID;
+                    continue;
+                }
+                while (currentID != rootID) {
+                    const auto& currentRelations{
+                        entityMetadataStorage.getRelations(currentID)
+                    };
+                    if (currentRelations.nextSiblingID != entity::noEntityID) {
+                        currentID = currentRelations.nextSiblingID;
+                        break;
+                    }
+                    currentID = currentRelations.parentID;
+                }
+                if (currentID == rootID) {
+                    return;
+                }
+            }
+        }
+
         //data modification functions
 
         //returns true if successfully added component, false otherwise
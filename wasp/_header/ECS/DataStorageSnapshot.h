@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+
+#include "Container/IntLookupTable.h"
+#include "ECS/Entity/EntityRelations.h"
+
+namespace wasp::ecs {
+
+    //Everything a DataStorage holds, as captured by DataStorage::snapshot. Tables of
+    //trivially copyable components are written back to back into one byte buffer;
+    //tables of other components are copied into tables of their own. Taking a new
+    //snapshot into an old one reuses its memory. Type indices are handed out as types
+    //are first used, so a snapshot only means something to the process which took it.
+    struct DataStorageSnapshot {
+        //constants
+        static constexpr std::uint32_t noArchetype{
+            std::numeric_limits<std::uint32_t>::max()
+        };
+
+        struct ColumnSnapshot {
+            std::size_t typeIndex{};
+            bool isCopiedAsBytes{};
+            std::size_t byteOffset{};   //into the buffer, if copied as bytes
+            //the copied table, or an empty table of the same type if copied as bytes
+            std::unique_ptr<container::IntLookupTableBase> tablePointer{};
+        };
+
+        struct ArchetypeSnapshot {
+            std::vector<std::size_t> typeIndices{};   //of the component set
+            std::vector<ColumnSnapshot> columns{};
+        };
+
+        struct EntitySnapshot {
+            std::uint32_t archetypeIndex{ noArchetype };  //noArchetype if dead
+            int generation{};
+            entity::EntityRelations relations{};
+        };
+
+        //fields
+        std::vector<std::byte> buffer{};
+        std::vector<ArchetypeSnapshot> archetypes{};    //only archetypeCount are in use
+        std::size_t archetypeCount{};
+        std::vector<EntitySnapshot> entities{};
+        std::vector<bool> liveEntityIDs{};
+        std::size_t nextEntityIDPosition{};
+        std::uint64_t hash{};   //DataStorage::getHash at the time of the snapshot
+
+        //Returns the hash of the data storage the snapshot was taken from, for
+        //checking that two runs are in step
+        std::uint64_t getHash() const {
+            return hash;
+        }
+    };
+}
\ No newline at end of file
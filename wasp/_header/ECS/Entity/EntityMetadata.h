@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ECS/Component/ComponentSet.h"
+#include "EntityRelations.h"
 
 namespace wasp::ecs::entity {
     class EntityMetadata {
@@ -11,6 +12,8 @@ namespace wasp::ecs::entity {
         //fields
         const ComponentSet* componentSetPointer{};
         int generation{};   //it's almost certainly fine for generation to overflow
+        EntityRelations relations{};    //kept by EntityMetadataStorage
+        int highestIssuedGeneration{ -1 };  //never rolled back by a restore
 
     public:
         EntityMetadata()
@@ -18,6 +21,21 @@ namespace wasp::ecs::entity {
             , generation{ 0 } {
         }
 
+        EntityMetadata(const ComponentSet* componentSetPointer, int generation)
+            : componentSetPointer{ componentSetPointer }
+            , generation{ generation } {
+        }
+
+        EntityMetadata(
+            const ComponentSet* componentSetPointer,
+            int generation,
+            const EntityRelations& relations
+        )
+            : componentSetPointer{ componentSetPointer }
+            , generation{ generation }
+            , relations{ relations } {
+        }
+
         //getters
         const ComponentSet* getComponentSetPointer() const {
             return componentSetPointer;
@@ -25,13 +43,38 @@ namespace wasp::ecs::entity {
         int getGeneration() const {
             return generation;
         }
+        const EntityRelations& getRelations() const {
+            return relations;
+        }
+        EntityRelations& getRelations() {
+            return relations;
+        }
+        int getHighestIssuedGeneration() const {
+            return highestIssuedGeneration;
+        }
 
         //setters
         void setComponentSetPointer(const ComponentSet* componentSetPointer) {
             this->componentSetPointer = componentSetPointer;
         }
+        void setHighestIssuedGeneration(int highestIssuedGeneration) {
+            this->highestIssuedGeneration = highestIssuedGeneration;
+        }
+        //records that a handle with the current generation has been given out
+        void markIssued() {
+            if (generation > highestIssuedGeneration) {
+                highestIssuedGeneration = generation;
+            }
+        }
+        //skips every generation already given out, so a restored entity that
+        //dies again can never reuse the generation of a handle made after
+        //the snapshot
         void newGeneration() {
             componentSetPointer = nullptr;
+            relations = {};
+            if (highestIssuedGeneration > generation) {
+                generation = highestIssuedGeneration;
+            }
             ++generation;
         }
     };
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <vector>
+#include <unordered_map>
+#include <cstdint>
 
 #include "EntityHandle.h"
 #include "EntityMetadata.h"
 #include "FreeEntityIDStorage.h"
+#include "ECS/DataStorageSnapshot.h"
 
 namespace wasp::ecs::entity {
 
@@ -43,8 +46,45 @@ namespace wasp::ecs::entity {
 
         const EntityMetadata getMetadata(EntityID entityID) const;
 
+        //every live entity ID is below this
+        std::size_t getCapacity() const {
+            return entityMetadataList.size();
+        }
+
+        //entity relations; the caller checks that the entities are alive
+
+        //Makes the child the first child of the parent, taking it from any parent it
+        //had before.
+        void setParent(EntityID childID, EntityID parentID);
+
+        //takes the entity from its parent, if it has one
+        void removeParent(EntityID childID);
+
+        const EntityRelations& getRelations(EntityID entityID) const;
+
+        //snapshots
+
+        //copies every entity into the snapshot, using the archetype indices given
+        //by ComponentStorage::snapshot
+        void snapshot(
+            DataStorageSnapshot& snapshot,
+            const std::unordered_map<const component::ComponentSet*, std::uint32_t>&
+                archetypeIndices
+        ) const;
+
+        //replaces every entity with those in the snapshot, using the component sets
+        //given by ComponentStorage::restore; generations are never rolled back
+        //into ones handed out after the snapshot, so newer handles stay dead
+        void restore(
+            const DataStorageSnapshot& snapshot,
+            const std::vector<const component::ComponentSet*>& componentSetPointers
+        );
+
     private:
         //helper functions
         void resizeIfNecessary(EntityID entityID) const;
+
+        //leaves the children of the entity without a parent
+        void orphanChildren(EntityID parentID);
     };
 }
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <limits>
+
+#include "EntityID.h"
+
+namespace wasp::ecs::entity {
+
+    //stands in for an entity in relations which have none
+    constexpr EntityID noEntityID{ std::numeric_limits<EntityID>::max() };
+
+    //An entity's place in the parent to children relation. Each entity knows only
+    //its first child, and the children of one parent link to each other, so walking
+    //the children of an entity costs one step per child and nothing is allocated.
+    struct EntityRelations {
+        EntityID parentID{ noEntityID };
+        EntityID firstChildID{ noEntityID };
+        EntityID nextSiblingID{ noEntityID };
+        EntityID previousSiblingID{ noEntityID };
+    };
+}
\ No newline at end of file
@@ -30,6 +30,18 @@ namespace wasp::ecs::entity {
 
         void reclaimID(EntityID entityID);
 
+        //snapshots
+        const std::vector<bool>& getEntityIDSet() const {
+            return entityIDSet;
+        }
+
+        std::size_t getCurrentPos() const {
+            return currentPos;
+        }
+
+        //takes an entity ID set and position from the getters above
+        void restore(const std::vector<bool>& entityIDSet, std::size_t currentPos);
+
     private:
         void resizeIfNecessary();
     };
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "DataStorage.h"
+
+namespace wasp::ecs {
+
+    //Names the group of the components Ts. A system keeps one as a member; the group
+    //is looked up once per data storage and remembered after that.
+    template <typename... Ts>
+    class Query {
+    private:
+        //typedefs
+        using Group = component::Group;
+
+        struct CachedGroup {
+            std::uint64_t groupEpoch{};
+            Group* groupPointer{};
+        };
+
+        //fields
+        std::vector<CachedGroup> cachedGroups{};    //one per data storage seen
+        std::size_t lastIndex{};
+
+    public:
+        Group* getGroupPointer(DataStorage& dataStorage) {
+            static_assert(sizeof...(Ts) > 0, "query of no components");
+            if constexpr ((component::ComponentIndexer::isRegistered<Ts>() && ...)) {
+                using Registered = typename component::RegisteredComponents<
+                    std::void_t<Ts...>
+                >::type;
+                static_assert(
+                    Registered::template maskOf<Ts...>().count() == sizeof...(Ts),
+                    "component queried twice"
+                );
+            }
+
+            const std::uint64_t groupEpoch{ dataStorage.getGroupEpoch() };
+            //a system usually runs on the same scene many ticks in a row
+            if (lastIndex < cachedGroups.size()
+                && cachedGroups[lastIndex].groupEpoch == groupEpoch
+            ) {
+                return cachedGroups[lastIndex].groupPointer;
+            }
+            for (std::size_t i{ 0 }; i < cachedGroups.size(); ++i) {
+                if (cachedGroups[i].groupEpoch == groupEpoch) {
+                    lastIndex = i;
+                    return cachedGroups[i].groupPointer;
+                }
+            }
+            lastIndex = cachedGroups.size();
+            cachedGroups.push_back({ groupEpoch, dataStorage.getGroupPointer<Ts...>() });
+            return cachedGroups.back().groupPointer;
+        }
+
+    };
+}
\ No newline at end of file
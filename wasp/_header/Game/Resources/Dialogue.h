@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "ShapedText.h"
+
 //not sure where to put this
 namespace wasp::game::resources {
 	
@@ -17,10 +21,47 @@ namespace wasp::game::resources {
 			end                //ends dialogue
 		} command {};
 		
-		std::wstring data {};
+		//the argument, as a range of the dialogue's string pool
+		std::uint32_t dataOffset {};
+		std::uint32_t dataLength {};
+		//setText only; the argument shaped into the dialogue's glyph pool
+		std::uint32_t glyphOffset {};
+		std::uint32_t glyphCount {};
 	};
 	
-	using Dialogue = std::vector<DialogueCommand>;
+	//Every argument of a dialogue lives in one pooled buffer, and every line of text is
+	//shaped once when loaded, so playing a dialogue never copies or lays out a string.
+	struct Dialogue {
+		std::uint32_t id {};	//unique among the dialogues parsed so far, never 0
+		std::vector<DialogueCommand> commands {};
+		std::wstring stringPool {};
+		std::vector<ShapedGlyph> glyphPool {};
+		
+		std::wstring_view getData(const DialogueCommand& dialogueCommand) const {
+			return std::wstring_view { stringPool }.substr(
+				dialogueCommand.dataOffset,
+				dialogueCommand.dataLength
+			);
+		}
+		
+		//null if the command has no glyphs
+		const ShapedGlyph* getGlyphs(const DialogueCommand& dialogueCommand) const {
+			if( dialogueCommand.glyphCount == 0 ) {
+				return nullptr;
+			}
+			return glyphPool.data() + dialogueCommand.glyphOffset;
+		}
+		
+		//Names a command's text for as long as the process runs, unlike the glyph
+		//pointer, which a reparsed dialogue may hand out again. Never 0.
+		std::uint64_t getTextID(const DialogueCommand& dialogueCommand) const {
+			auto commandIndex { static_cast<std::uint64_t>(
+				&dialogueCommand - commands.data()
+			) };
+			return (static_cast<std::uint64_t>(id) << 32u) | commandIndex;
+		}
+	};
 	
-	Dialogue parseDialogueFile(const std::wstring& fileName);
+	//text is wrapped after the given number of columns
+	Dialogue parseDialogueFile(const std::wstring& fileName, int textColumns);
 }
\ No newline at end of file
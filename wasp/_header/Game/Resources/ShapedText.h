@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace wasp::game::resources {
+	
+	//A symbol placed in a cell of a text box whose size is known ahead of time. Which
+	//sprite draws the symbol and how far apart cells are is left to the renderer.
+	struct ShapedGlyph {
+		wchar_t symbol {};
+		std::uint16_t column {};
+		std::uint16_t row {};
+	};
+	
+	//how many cells of the given spacing start before the right bound
+	constexpr int getColumnCount(int width, int horizontalSpacing) {
+		return (width + horizontalSpacing - 1) / horizontalSpacing;
+	}
+	
+	//Appends the glyphs of text to glyphPool, wrapping after the given number of
+	//columns. Spaces and tabs only move the cursor, and a new line starts a new row.
+	void shapeText(
+		std::wstring_view text,
+		int columns,
+		std::vector<ShapedGlyph>& glyphPool
+	);
+}
\ No newline at end of file
@@ -40,7 +40,9 @@ namespace wasp::math {
 		}
 		
 		//conversion to Vector2
-		operator Vector2() const;
+		operator Vector2() const {
+			return vector2Representation;
+		}
 	
 	private:
 		void updateVector2Representation();
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+
+#include "MathUtil.h"
+#include "Vector2.h"
+
+namespace wasp::math {
+	
+	//Trigonometry for the simulation, done with polynomials on a reduced range rather
+	//than the standard library. Only adds, multiplies and divides in a fixed order are
+	//used, so results are the same on every machine and every run as long as the
+	//compiler does not fuse them; CMakeLists.txt sets /fp:precise or -ffp-contract=off.
+	
+	struct SinCos {
+		float sin {};
+		float cos {};
+	};
+	
+	//within 1e-7 of the true values for angles up to ten turns either way
+	constexpr SinCos sinCosDegrees(float degrees) {
+		//reduce to [-45, 45] around the nearest multiple of 90
+		float rounded { degrees * (1.0f / 90.0f) + 0.5f };
+		int quadrant { static_cast<int>(rounded) };
+		quadrant -= rounded < static_cast<float>(quadrant);	//floor for negative angles
+		float x { toRadians(degrees - static_cast<float>(quadrant) * 90.0f) };
+		float z { x * x };
+		
+		//minimax coefficients from the Cephes library
+		float sin { x + x * z * ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z
+			- 1.6666654611e-1f) };
+		float cos { 1.0f - 0.5f * z + z * z * ((2.443315711809948e-5f * z
+			- 1.388731625493765e-3f) * z + 4.166664568298827e-2f) };
+		
+		//the quadrant selects and signs the results without branching; multiplying by
+		//exactly 0 or 1 and adding keeps the chosen value exact
+		float swap { static_cast<float>(quadrant & 1) };
+		float keep { 1.0f - swap };
+		float sinSign { static_cast<float>(1 - (quadrant & 2)) };
+		float cosSign { static_cast<float>(1 - ((quadrant + 1) & 2)) };
+		return {
+			(sin * keep + cos * swap) * sinSign,
+			(cos * keep + sin * swap) * cosSign
+		};
+	}
+	
+	//the angle of the vector (x, y) from the positive x axis, in [-180, 180] degrees;
+	//within 3e-5 degrees of the true value
+	constexpr float atan2Degrees(float y, float x) {
+		float absX { x < 0.0f ? -x : x };
+		float absY { y < 0.0f ? -y : y };
+		if( absX == 0.0f && absY == 0.0f ) {
+			return 0.0f;
+		}
+		
+		//reduce to an angle in [0, 45] degrees, then to [-22.5, 22.5]
+		bool swap { absY > absX };
+		float t { swap ? absX / absY : absY / absX };
+		float base { 0.0f };
+		if( t > 0.4142135623730950f ) {	//tan(pi / 8)
+			base = pi / 4.0f;
+			t = (t - 1.0f) / (t + 1.0f);
+		}
+		float z { t * t };
+		
+		//minimax coefficients from the Cephes library
+		float radians { base + ((((8.05374449538e-2f * z - 1.38776856032e-1f) * z
+			+ 1.99777106478e-1f) * z - 3.33329491539e-1f) * z * t + t) };
+		
+		if( swap ) {
+			radians = pi / 2.0f - radians;
+		}
+		if( x < 0.0f ) {
+			radians = pi - radians;
+		}
+		if( y < 0.0f ) {
+			radians = -radians;
+		}
+		return toDegrees(radians);
+	}
+	
+	//Converts count polar vectors, given as magnitudes and angles in degrees, to
+	//Vector2 with y pointing down as in PolarVector. The loop has no branches, so the
+	//compiler is free to vectorize it; each result matches a single conversion.
+	void toVector2s(
+		const float* magnitudes,
+		const float* degrees,
+		Vector2* vectors,
+		std::size_t count
+	);
+}
\ No newline at end of file
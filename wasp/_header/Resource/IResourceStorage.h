@@ -2,6 +2,7 @@
 
 #include <string>
 #include <stdexcept>
+#include <cstddef>
 
 namespace wasp::resource {
 	
@@ -20,5 +21,10 @@ namespace wasp::resource {
 		virtual void write(const std::wstring& id) const {
 			throw std::runtime_error { "Error resource write unsupported" };
 		};
+		
+		//roughly how many bytes a loaded resource holds, for residency reports
+		virtual std::size_t getMemoryUsage(const std::wstring& id) const {
+			return 0;
+		}
 	};
 }
\ No newline at end of file
@@ -1,10 +1,18 @@
 #pragma once
 
 #include "ECS/DataStorage.h"
+#include "ECS/DataStorageSnapshot.h"
 #include "Channel/ChannelSet.h"
+#include "Logging.h"
 
 namespace wasp::scene {
 
+	//the entities and channels of a scene, as captured by Scene::snapshot
+	struct SceneSnapshot {
+		ecs::DataStorageSnapshot dataStorageSnapshot{};
+		channel::ChannelSet channelSet{};
+	};
+
 	//SystemCallEnumClass is the enum class used to identify different system chains
 	//SceneNameEnumClass is the enum class used to identify different scenes
 	template <typename SystemChainIDEnumClass, typename SceneNameEnumClass>
@@ -77,13 +85,45 @@ namespace wasp::scene {
 			return refresh;
 		}
 
+		//empties the scene, keeping its archetypes, groups, channels and capacity
 		void refreshScene() {
-			dataStorage.recreate();
-			channelSet.clear();
+			logChannelHighWaterMarks();
+			dataStorage.clearEntities();
+			channelSet.clearMessages();
+		}
+
+		//copies every entity and channel into the snapshot, reusing its memory
+		void snapshot(SceneSnapshot& sceneSnapshot) const {
+			dataStorage.snapshot(sceneSnapshot.dataStorageSnapshot);
+			channelSet.copyTo(sceneSnapshot.channelSet);
+		}
+
+		//puts the scene back as it was when the snapshot was taken
+		void restore(const SceneSnapshot& sceneSnapshot) {
+			dataStorage.restore(sceneSnapshot.dataStorageSnapshot);
+			sceneSnapshot.channelSet.copyTo(channelSet);
 		}
 
 	private:
 		//helper methods
+
+		//In debug builds, reports the most messages each channel held during the last
+		//visit. Reserving that much up front keeps the scene from ever allocating
+		//for messages.
+		void logChannelHighWaterMarks() const {
+			#ifdef _DEBUG
+			std::vector<std::size_t> highWaterMarks{ channelSet.getHighWaterMarks() };
+			for (std::size_t i{ 0 }; i < highWaterMarks.size(); ++i) {
+				if (highWaterMarks[i] > 0) {
+					debug::log(
+						"scene " + std::to_string(static_cast<int>(name))
+						+ " topic " + std::to_string(i)
+						+ " high-water mark " + std::to_string(highWaterMarks[i])
+					);
+				}
+			}
+			#endif
+		}
 		void setSystemChainTransparency(
 			SystemChainIDEnumClass systemChainID,
 			bool transparency
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace wasp::sound::midi {
+	//Where a sequencer sends its output. Calls come from the sequencer's timing thread.
+	class IMidiOut {
+	public:
+		virtual ~IMidiOut() = default;
+		
+		virtual void outputShortMsg(uint32_t output) = 0;
+		
+		//data includes the leading F0 if the message has one
+		virtual void outputSystemExclusive(const uint8_t* data, uint32_t byteLength) = 0;
+		
+		//silences every channel and resets the receiver
+		virtual void outputReset() = 0;
+	};
+}
\ No newline at end of file
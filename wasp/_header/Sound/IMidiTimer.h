@@ -0,0 +1,26 @@
+#pragma once
+
+#include <chrono>
+
+namespace wasp::sound::midi {
+	//How a sequencer's timing thread sleeps. A wait returns early once wake is called;
+	//a wake with no wait in progress cuts the next wait short instead.
+	class IMidiTimer {
+	public:
+		//typedefs
+		using clockType = std::chrono::steady_clock;
+		using timePointType = clockType::time_point;
+		
+		virtual ~IMidiTimer() = default;
+		
+		//called once from the timing thread before its first wait
+		virtual void enterTimingThread() {}
+		
+		virtual void waitUntil(timePointType wakeTime) = 0;
+		
+		virtual void wait() = 0;
+		
+		//may be called from any thread
+		virtual void wake() = 0;
+	};
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "MidiOut.h"
 #include "MidiSequencer.h"
+#include "WaitableMidiTimer.h"
 
 namespace wasp::sound::midi {
 	
@@ -8,6 +10,7 @@ namespace wasp::sound::midi {
 	private:
 		//fields
 		MidiOut midiOut {};
+		WaitableMidiTimer midiTimer {};
 		MidiSequencer midiSequencer;    //not initialized!
 		bool muted {};
 	
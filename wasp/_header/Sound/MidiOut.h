@@ -5,8 +5,11 @@
 #include "windowsInclude.h"
 #include "mmeInclude.h"
 
+#include "IMidiOut.h"
+
 namespace wasp::sound::midi {
-	class MidiOut {
+	//The Windows MIDI mapper
+	class MidiOut : public IMidiOut {
 	private:
 		HMIDIOUT midiOutHandle {};
 	
@@ -15,7 +18,7 @@ namespace wasp::sound::midi {
 		MidiOut();
 		
 		//destructor
-		~MidiOut();
+		~MidiOut() override;
 		
 		//delete copy and assignment
 		MidiOut(const MidiOut& other) = delete;
@@ -23,15 +26,15 @@ namespace wasp::sound::midi {
 		void operator=(const MidiOut& other) = delete;
 		
 		//output wrapper functions
-		void outputShortMsg(uint32_t output);
+		void outputShortMsg(uint32_t output) override;
 		
 		void outputShortMsgOnAllChannels(uint32_t output);
 		
 		void outputControlChangeOnAllChannels(uint32_t data);
 		
-		void outputSystemExclusive(MIDIHDR* midiHDR);
+		void outputSystemExclusive(const uint8_t* data, uint32_t byteLength) override;
 		
-		void outputReset();
+		void outputReset() override;
 	
 	private:
 		void openMidiOut();
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "IMidiSequencer.h"
+#include "MidiSequence.h"
+
+namespace wasp::sound::midi {
+	//Plays a sequence as fast as it can decode into a log of timed events rather than
+	//to a device. start renders the whole sequence before it returns, so the result
+	//is the same on every machine. Looping sequences are cut off at a maximum length.
+	class MidiRenderer : public IMidiSequencer {
+	public:
+		struct RenderedEvent {
+			std::chrono::nanoseconds time {};
+			uint32_t shortMsg {};
+			bool isSystemExclusive {};
+			//the data is kept in one buffer owned by the renderer
+			uint32_t systemExclusiveIndex {};
+			uint32_t systemExclusiveLength {};
+		};
+	
+	private:
+		//fields
+		std::chrono::nanoseconds maxLength {};
+		
+		//render fields
+		std::vector<RenderedEvent> renderedEvents {};
+		std::vector<uint8_t> systemExclusiveBuffer {};
+		std::chrono::nanoseconds length {};
+		std::size_t loopCount {};
+		bool cutOff {};
+	
+	public:
+		explicit MidiRenderer(std::chrono::nanoseconds maxLength);
+		
+		//replaces the previous render
+		void start(std::shared_ptr<MidiSequence> midiSequencePointer) override;
+		
+		//discards the previous render
+		void stop() override;
+		
+		const std::vector<RenderedEvent>& getRenderedEvents() const {
+			return renderedEvents;
+		}
+		
+		const uint8_t* getSystemExclusiveData(const RenderedEvent& renderedEvent) const {
+			return systemExclusiveBuffer.data() + renderedEvent.systemExclusiveIndex;
+		}
+		
+		//the time of the last rendered event
+		std::chrono::nanoseconds getLength() const {
+			return length;
+		}
+		
+		std::size_t getLoopCount() const {
+			return loopCount;
+		}
+		
+		//true if the render hit the maximum length before the sequence ended
+		bool wasCutOff() const {
+			return cutOff;
+		}
+	};
+}
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 namespace wasp::sound::midi {
 	
+	//Stream parsers. Multi track files are loaded track by track and then merged.
 	MidiSequence parseMidiFile(
 		const std::wstring& fileName
 	);
@@ -13,4 +14,16 @@ namespace wasp::sound::midi {
 		int64_t loopStart = 0,
 		int64_t loopEnd = -1
 	);
+	
+	//Span parsers over a whole file already in memory, such as a mapped file. Every track
+	//is pre scanned to size the compiled track, then merged into it directly; payloads
+	//are copied from the span exactly once. Throws on malformed or truncated data.
+	MidiSequence parseMidiData(const uint8_t* data, std::size_t size);
+	
+	MidiSequence parseLoopedMidiData(
+		const uint8_t* data,
+		std::size_t size,
+		int64_t loopStart = 0,
+		int64_t loopEnd = -1
+	);
 }
\ No newline at end of file
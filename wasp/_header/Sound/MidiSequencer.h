@@ -1,46 +1,72 @@
 #pragma once
 
+#include <array>
 #include <chrono>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
-#include "windowsInclude.h"
-#include "mmeInclude.h"
+#include <thread>
 
 #include "MidiConstants.h"
 #include "IMidiSequencer.h"
+#include "IMidiOut.h"
+#include "IMidiTimer.h"
 #include "MidiSequence.h"
-#include "MidiOut.h"
-#include "Utility/Scheduling.h"
+#include "MidiTimeline.h"
+#include "Utility/SpscQueue.h"
 
 namespace wasp::sound::midi {
-	//NOT threadsafe
+	//Plays sequences on a timing thread which lives as long as the sequencer. The thread
+	//reads ahead to give upcoming events absolute times, then sleeps until each is due
+	//and sends it through the given timer. start and stop only queue a command, so they
+	//never wait on playback; if the queue is full they block until the thread drains it.
+	//start and stop must be called from one thread at a time.
 	class MidiSequencer : public IMidiSequencer {
 	private:
 		//typedefs
 		
-		//on Windows, steady_clock wraps the performance counter
-		using clockType = std::chrono::steady_clock;
-		using timePointType = clockType::time_point;
-		
-		using EventUnitTrack = MidiSequence::EventUnitTrack;
-		
-		MidiOut* midiOutPointer {};
-		
-		//playback fields
+		using clockType = IMidiTimer::clockType;
+		using timePointType = IMidiTimer::timePointType;
+		using TimedEvent = MidiTimeline::TimedEvent;
+		
+		struct Command {
+			enum class Types {
+				none,
+				start,
+				stop,
+				shutdown
+			};
+			
+			Types type { Types::none };
+			std::shared_ptr<MidiSequence> midiSequencePointer {};
+		};
+		
+		//constants
+		static constexpr std::size_t commandCapacity { 16 };
+		static constexpr std::size_t lookaheadCapacity { 256 };
+		
+		//fields
+		IMidiOut* midiOutPointer {};
+		IMidiTimer* midiTimerPointer {};
+		utility::SpscQueue<Command, commandCapacity> commandQueue {};
+		//producers wait here while the command queue is full
+		std::mutex commandSpaceMutex {};
+		std::condition_variable commandSpaceCondition {};
+		
+		//timing thread fields
 		std::shared_ptr<MidiSequence> midiSequencePointer {};
-		EventUnitTrack::iterator iter {};
-		EventUnitTrack::iterator loopPointIter {};
-		uint32_t microsecondsPerBeat { defaultMicrosecondsPerBeat };
-		uint32_t timePerTick100ns {};
-		
-		//threading fields
-		std::thread playbackThread {};
-		utility::EventHandle wakeupSwitch {};
-		std::atomic_bool running { false };        //our flag, synchronizes our threads
+		MidiTimeline timeline {};
+		bool timelineEnded { true };
+		timePointType playbackStart {};
+		//ring of decoded events waiting to be sent
+		std::array<TimedEvent, lookaheadCapacity> lookahead {};
+		std::size_t lookaheadBegin {};
+		std::size_t lookaheadSize {};
+		
+		std::thread timingThread {};    //started last, once everything it uses exists
 	
 	public:
-		MidiSequencer(MidiOut* midiOutPointer)
-			: midiOutPointer { midiOutPointer } {
-		}
+		MidiSequencer(IMidiOut* midiOutPointer, IMidiTimer* midiTimerPointer);
 		
 		//delete copy constructor and assignment operator
 		MidiSequencer(const MidiSequencer& other) = delete;
@@ -54,18 +80,23 @@ namespace wasp::sound::midi {
 		void stop() override;
 	
 	private:
-		void playback();
+		//helper functions
+		void pushCommand(Command command);
+		
+		//timing thread functions
+		void timingLoop();
 		
-		void outputMidiEvent();
+		//returns false on shutdown
+		bool handleCommands();
 		
-		void outputSystemExclusiveEvent();
+		void beginPlayback(std::shared_ptr<MidiSequence> midiSequencePointer);
 		
-		void handleMetaEvent();
+		void endPlayback();
 		
-		void stopPlaybackThread();
+		void fillLookahead(std::chrono::nanoseconds horizon);
 		
-		void resetPlaybackFields();
+		void outputEvent(const TimedEvent& timedEvent);
 		
-		static timePointType getCurrentTime();
+		std::chrono::nanoseconds getPlaybackTime() const;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "MidiSequence.h"
+
+namespace wasp::sound::midi {
+	//Walks a compiled track in order and gives each output its time since the start of
+	//playback. Tempo changes and loop points are applied as they are reached. Time is
+	//kept in whole nanoseconds with the remainder carried, so it never drifts no matter
+	//how many times a track loops.
+	class MidiTimeline {
+	public:
+		struct TimedEvent {
+			std::chrono::nanoseconds time {};
+			uint32_t shortMsg {};
+			const uint8_t* systemExclusiveData {};	//null for short messages
+			uint32_t systemExclusiveLength {};
+		};
+	
+	private:
+		//typedefs
+		using EventUnit = MidiSequence::EventUnit;
+		
+		//fields
+		const EventUnit* currentPointer {};
+		const EventUnit* endPointer {};
+		const EventUnit* loopPointPointer {};	//null until the loop start is reached
+		std::size_t outputsSinceLoopPoint {};
+		std::size_t loopCount {};
+		
+		//a tick lasts tickNumerator / tickDenominator nanoseconds
+		uint64_t tickNumerator {};
+		uint64_t tickDenominator { 1 };
+		bool isTempoFixed {};	//SMPTE time ignores tempo events
+		
+		std::chrono::nanoseconds currentTime {};
+		uint64_t remainder {};	//less than tickDenominator
+	
+	public:
+		MidiTimeline() = default;
+		
+		//the sequence must outlive the timeline
+		explicit MidiTimeline(const MidiSequence& midiSequence);
+		
+		//Sets the next output and returns true, or returns false once the track ends.
+		//A loop containing no outputs ends the track rather than spinning forever.
+		bool next(TimedEvent& timedEvent);
+		
+		//the time of the last event read
+		std::chrono::nanoseconds getCurrentTime() const {
+			return currentTime;
+		}
+		
+		//how many times playback has jumped back to the loop start
+		std::size_t getLoopCount() const {
+			return loopCount;
+		}
+	
+	private:
+		//helper functions
+		void advanceTime(uint32_t deltaTime);
+		
+		//returns false if this was a loop end with nothing to loop over
+		bool handleMetaEvent(
+			uint8_t metaEventStatus,
+			uint32_t byteLength,
+			uint32_t indexLength,
+			const uint8_t* data
+		);
+	};
+}
\ No newline at end of file
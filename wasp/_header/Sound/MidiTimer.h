@@ -0,0 +1,25 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+#include "IMidiTimer.h"
+
+namespace wasp::sound::midi {
+	//Waits on a condition variable, so it runs anywhere the standard library does. How
+	//late it wakes depends on the system's timer resolution.
+	class MidiTimer : public IMidiTimer {
+	private:
+		//fields
+		std::mutex wakeMutex {};
+		std::condition_variable wakeCondition {};
+		bool wakePending {};    //guarded by wakeMutex
+	
+	public:
+		void waitUntil(timePointType wakeTime) override;
+		
+		void wait() override;
+		
+		void wake() override;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "IMidiOut.h"
+#include "MidiSequence.h"
+
+namespace wasp::sound::midi {
+	//Keeps every output with the time it arrived instead of playing it, so a sequencer
+	//can be checked without a sound device.
+	class RecordingMidiOut : public IMidiOut {
+	public:
+		//typedefs
+		using clockType = std::chrono::steady_clock;
+		
+		struct Record {
+			clockType::time_point time {};
+			uint32_t shortMsg {};
+			std::vector<uint8_t> systemExclusiveData {};
+			bool isReset {};
+		};
+		
+		struct TimingError {
+			std::size_t eventCount {};
+			std::chrono::nanoseconds mean {};
+			std::chrono::nanoseconds max {};
+		};
+	
+	private:
+		//fields
+		std::mutex recordMutex {};
+		std::vector<Record> records {};
+	
+	public:
+		void outputShortMsg(uint32_t output) override;
+		
+		void outputSystemExclusive(const uint8_t* data, uint32_t byteLength) override;
+		
+		void outputReset() override;
+		
+		//returns everything recorded so far and starts over
+		std::vector<Record> takeRecords();
+		
+		//Compares records against the times the sequence asks for. Playback is taken to
+		//start at the first reset, and every output after it must match the sequence in
+		//order. Error is measured as lateness; an early output counts as its magnitude.
+		static TimingError measureTimingError(
+			const std::vector<Record>& records,
+			const MidiSequence& midiSequence
+		);
+	
+	private:
+		void addRecord(Record&& record);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "IMidiTimer.h"
+#include "Utility/Scheduling.h"
+
+namespace wasp::sound::midi {
+	//Waits on a high resolution Windows waitable timer, and raises the timing thread's
+	//priority, so events wake within a fraction of a millisecond.
+	class WaitableMidiTimer : public IMidiTimer {
+	private:
+		//fields
+		utility::EventHandle wakeupSwitch {};
+	
+	public:
+		void enterTimingThread() override;
+		
+		void waitUntil(timePointType wakeTime) override;
+		
+		void wait() override;
+		
+		void wake() override;
+	};
+}
\ No newline at end of file
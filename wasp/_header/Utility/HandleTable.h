@@ -0,0 +1,83 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <optional>
+#include <cstdint>
+
+namespace wasp::utility {
+
+	//Interns string names as dense integer handles into an array of values. Resolving a
+	//name hashes it once; holding on to the handle afterwards costs a single index. The
+	//most recently found name is remembered, so a loop looking up one name repeatedly
+	//compares strings instead of hashing them.
+	template <typename T>
+	class HandleTable {
+	public:
+		//typedefs
+		using Handle = std::uint32_t;
+
+	private:
+		//fields
+		std::vector<T> values {};
+		std::unordered_map<std::string, Handle> handleMap {};
+		std::string lastName {};
+		Handle lastHandle {};
+		bool hasLast {};
+
+	public:
+		//Returns the handle of the given name, or nothing if it was never added
+		std::optional<Handle> find(const std::string& name) {
+			if( hasLast && name == lastName ) {
+				return lastHandle;
+			}
+			auto found { handleMap.find(name) };
+			if( found == handleMap.end() ) {
+				return std::nullopt;
+			}
+			remember(found->first, found->second);
+			return found->second;
+		}
+
+		bool contains(const std::string& name) const {
+			return handleMap.find(name) != handleMap.end();
+		}
+
+		//Adds a value under a name not yet in the table and returns its handle
+		Handle add(const std::string& name, T value) {
+			Handle handle { static_cast<Handle>(values.size()) };
+			values.push_back(std::move(value));
+			handleMap.emplace(name, handle);
+			remember(name, handle);
+			return handle;
+		}
+
+		T& operator[](Handle handle) {
+			return values[handle];
+		}
+
+		const T& operator[](Handle handle) const {
+			return values[handle];
+		}
+
+		std::size_t size() const {
+			return values.size();
+		}
+
+		void clear() {
+			values.clear();
+			handleMap.clear();
+			lastName.clear();
+			hasLast = false;
+		}
+
+	private:
+		//helper functions
+		void remember(const std::string& name, Handle handle) {
+			lastName = name;
+			lastHandle = handle;
+			hasLast = true;
+		}
+	};
+}
\ No newline at end of file
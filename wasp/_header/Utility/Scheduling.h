@@ -22,5 +22,11 @@ namespace wasp::utility {
 	
 	void sleep100ns(long long time100ns);
 	
+	//returns early if the event is signaled
 	void sleep100nsWithEvent(long long time100ns, EventHandle& eventHandle);
+	
+	void waitForEvent(EventHandle& eventHandle);
+	
+	//for threads which must wake on time, such as the midi sequencer
+	void raiseCurrentThreadPriority();
 }
\ No newline at end of file
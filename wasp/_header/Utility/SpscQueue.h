@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace wasp::utility {
+	
+	//A bounded single producer single consumer queue. Neither side takes a lock; a push
+	//to a full queue or a pop from an empty one fails instead of waiting.
+	template <typename T, std::size_t capacity>
+	class SpscQueue {
+	private:
+		static_assert(
+			capacity >= 2 && (capacity & (capacity - 1)) == 0,
+			"capacity must be a power of 2"
+		);
+		static constexpr std::size_t indexMask { capacity - 1 };
+		
+		//fields
+		std::array<T, capacity> slots {};
+		//both count up forever; a slot is the count modulo capacity
+		alignas(64) std::atomic<std::size_t> readCount { 0 };	//written by the consumer
+		alignas(64) std::atomic<std::size_t> writeCount { 0 };	//written by the producer
+	
+	public:
+		//producer side
+		
+		//returns false if the queue is full
+		bool tryPush(T value) {
+			std::size_t write { writeCount.load(std::memory_order_relaxed) };
+			if( write - readCount.load(std::memory_order_acquire) == capacity ) {
+				return false;
+			}
+			slots[write & indexMask] = std::move(value);
+			writeCount.store(write + 1, std::memory_order_release);
+			return true;
+		}
+		
+		//consumer side
+		
+		//returns false if the queue is empty; the slot is cleared so it owns nothing
+		bool tryPop(T& value) {
+			std::size_t read { readCount.load(std::memory_order_relaxed) };
+			if( read == writeCount.load(std::memory_order_acquire) ) {
+				return false;
+			}
+			T& slot { slots[read & indexMask] };
+			value = std::move(slot);
+			slot = T {};
+			readCount.store(read + 1, std::memory_order_release);
+			return true;
+		}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace wasp::utility {
+	
+	//Runs batches of independent tasks on a fixed set of worker threads. The thread
+	//calling run works through the batch as well, so a pool of zero workers is serial.
+	class ThreadPool {
+	private:
+		//fields
+		std::vector<std::thread> workers {};
+		std::mutex mutex {};
+		std::condition_variable workAvailable {};
+		std::condition_variable workDone {};
+		
+		//guarded by mutex
+		std::vector<std::function<void()>>* tasksPointer {};
+		std::size_t nextTaskIndex {};
+		std::size_t unfinishedTaskCount {};
+		std::exception_ptr firstExceptionPointer {};
+		bool stopping {};
+	
+	public:
+		explicit ThreadPool(std::size_t workerCount);
+		
+		~ThreadPool();
+		
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		
+		//Runs every task and returns once all are done. Tasks start in order but may
+		//finish in any order. If any task throws, the first exception is rethrown
+		//after the rest of the batch finishes.
+		void run(std::vector<std::function<void()>>& tasks);
+		
+		std::size_t getWorkerCount() const {
+			return workers.size();
+		}
+	
+	private:
+		void workerLoop();
+		
+		//returns false if there was no task left to start
+		bool runNextTask(std::unique_lock<std::mutex>& lock);
+		
+		bool hasTaskToStart() const {
+			return tasksPointer && nextTaskIndex < tasksPointer->size();
+		}
+	};
+}
\ No newline at end of file
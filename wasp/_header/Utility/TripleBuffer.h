@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace wasp::utility {
+
+	//A single producer single consumer triple buffer. The writer fills its buffer and
+	//publishes it, the reader swaps in the most recently published buffer. Neither side
+	//ever waits on the other; the reader skips any buffers published in between reads.
+	template <typename T>
+	class TripleBuffer {
+	private:
+		//typedefs
+		using StateType = std::uint_fast8_t;
+
+		//bitmasks
+		static constexpr StateType indexMask { 0b0011 };
+		static constexpr StateType freshBit { 0b0100 };    //middle buffer not yet read
+
+		//fields
+		std::array<T, 3> buffers {};
+		std::atomic<StateType> middleState { 1 };
+		StateType writeIndex { 0 };    //only touched by the writer
+		StateType readIndex { 2 };     //only touched by the reader
+
+	public:
+		//writer side
+		T& getWriteBuffer() {
+			return buffers[writeIndex];
+		}
+
+		//Hands the write buffer to the reader and takes back the middle buffer
+		void publish() {
+			StateType oldMiddleState {
+				middleState.exchange(writeIndex | freshBit, std::memory_order_acq_rel)
+			};
+			writeIndex = oldMiddleState & indexMask;
+		}
+
+		//reader side
+
+		//Swaps in the last published buffer, returns false if nothing new was published
+		bool updateReadBuffer() {
+			if( !(middleState.load(std::memory_order_relaxed) & freshBit) ) {
+				return false;
+			}
+			StateType oldMiddleState {
+				middleState.exchange(readIndex, std::memory_order_acq_rel)
+			};
+			readIndex = oldMiddleState & indexMask;
+			return true;
+		}
+
+		const T& getReadBuffer() const {
+			return buffers[readIndex];
+		}
+	};
+}
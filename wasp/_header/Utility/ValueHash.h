@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+namespace wasp::utility {
+
+	//constants for 64 bit FNV-1a
+	constexpr std::uint64_t hashOffsetBasis{ 14695981039346656037ull };
+	constexpr std::uint64_t hashPrime{ 1099511628211ull };
+
+	//folds raw bytes into the hash; only for data without padding or pointers
+	inline std::uint64_t hashBytes(std::uint64_t hash, const void* data, std::size_t count) {
+		const auto* bytes{ static_cast<const unsigned char*>(data) };
+		for( std::size_t i{ 0 }; i < count; ++i ) {
+			hash ^= bytes[i];
+			hash *= hashPrime;
+		}
+		return hash;
+	}
+
+	//folds a single number or enum into the hash
+	template <typename T>
+	std::uint64_t hashValue(std::uint64_t hash, const T& value) {
+		static_assert(
+			std::is_arithmetic_v<T> || std::is_enum_v<T>,
+			"hash compound values field by field"
+		);
+		return hashBytes(hash, &value, sizeof(T));
+	}
+
+	//Specialize with a static function hash(std::uint64_t hash, const T& value) which
+	//folds each field of the value in with hashValue, for values which should count
+	//towards a state hash. Raw bytes are never hashed for compound values, as padding
+	//and pointers differ between runs; types holding pointers should simply not be
+	//specialized.
+	template <typename T>
+	struct ValueHash {};
+
+	template <typename T, typename = void>
+	struct IsValueHashed : std::false_type {};
+
+	template <typename T>
+	struct IsValueHashed<T, std::void_t<decltype(&ValueHash<T>::hash)>> : std::true_type {};
+
+	template <typename T>
+	constexpr bool isValueHashed{ IsValueHashed<T>::value };
+}
\ No newline at end of file
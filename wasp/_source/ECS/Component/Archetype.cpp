@@ -33,6 +33,83 @@ namespace wasp::ecs::component {
         return wasAnyComponentRemoved;
     }
 
+    void Archetype::writeSnapshot(
+        DataStorageSnapshot::ArchetypeSnapshot& archetypeSnapshot,
+        std::vector<std::byte>& buffer
+    ) const {
+        auto& columns{ archetypeSnapshot.columns };
+        std::size_t columnCount{ 0 };
+        for (std::size_t typeIndex : componentKeyPointer->getPresentTypeIndices()) {
+            if (typeIndex >= componentStorages.size() || !componentStorages[typeIndex]) {
+                continue;
+            }
+            //empty tables need not be copied; readSnapshot relies on a cleared table
+            const IntLookupTableBase& storage{ *componentStorages[typeIndex] };
+            if (storage.size() == 0) {
+                continue;
+            }
+            if (columnCount == columns.size()) {
+                columns.emplace_back();
+            }
+            auto& column{ columns[columnCount++] };
+            //an old table of another type cannot be reused
+            if (column.typeIndex != typeIndex || !column.tablePointer) {
+                column.typeIndex = typeIndex;
+                column.tablePointer = storage.makeEmpty();
+            }
+            column.isCopiedAsBytes = storage.canCopyAsBytes();
+            if (column.isCopiedAsBytes) {
+                column.byteOffset = buffer.size();
+                storage.writeBytes(buffer);
+            }
+            else {
+                storage.copyTo(*column.tablePointer);
+            }
+        }
+        columns.erase(columns.begin() + columnCount, columns.end());
+    }
+
+    void Archetype::readSnapshot(
+        const DataStorageSnapshot::ArchetypeSnapshot& archetypeSnapshot,
+        const std::vector<std::byte>& buffer
+    ) {
+        for (const auto& column : archetypeSnapshot.columns) {
+            std::unique_ptr<IntLookupTableBase>& storagePointer =
+                componentStorages[column.typeIndex];
+
+            if (!storagePointer) {
+                storagePointer = column.tablePointer->makeEmpty();
+            }
+            if (column.isCopiedAsBytes) {
+                storagePointer->readBytes(buffer.data() + column.byteOffset);
+            }
+            else {
+                column.tablePointer->copyTo(*storagePointer);
+            }
+        }
+    }
+
+    void Archetype::clearComponents() {
+        for (std::unique_ptr<IntLookupTableBase>& storagePointer : componentStorages) {
+            if (storagePointer) {
+                storagePointer->clear();
+            }
+        }
+    }
+
+    std::uint64_t Archetype::hashEntity(const EntityID entityID, std::uint64_t hash) const {
+        for (std::size_t typeIndex : componentKeyPointer->getPresentTypeIndices()) {
+            hash = utility::hashValue(hash, static_cast<std::uint64_t>(typeIndex));
+            if (typeIndex < componentStorages.size() && componentStorages[typeIndex]) {
+                hash = componentStorages[typeIndex]->hashValue(
+                    static_cast<int>(entityID),
+                    hash
+                );
+            }
+        }
+        return hash;
+    }
+
     //initializing the move component function vtable
     std::vector<std::function<void(const entity::EntityID, Archetype&, Archetype&)>>
         Archetype::moveComponentVTable{ maxComponents };
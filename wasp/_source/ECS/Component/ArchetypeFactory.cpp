@@ -5,10 +5,12 @@ namespace wasp::ecs::component {
     ArchetypeFactory::ArchetypeFactory(
         std::size_t initEntityCapacity,
         std::size_t initComponentCapacity,
+        const ChangeVersion* changeVersionPointer,
         ComponentSetFactory& componentSetFactory
     )
         : initEntityCapacity{ initEntityCapacity }
         , initComponentCapacity{ initComponentCapacity }
+        , changeVersionPointer{ changeVersionPointer }
     {
         componentSetFactory.setNewComponentSetCallback(
             [&](const ComponentSet& componentSet) {
@@ -25,6 +27,7 @@ namespace wasp::ecs::component {
         archetypePointers.emplace_back(
             new Archetype{
                 &componentSet,
+                changeVersionPointer,
                 initEntityCapacity,
                 initComponentCapacity
             }
@@ -9,6 +9,7 @@ namespace wasp::ecs::component {
         , archetypeFactory{
             initEntityCapacity,
             initComponentCapacity,
+            &changeVersion,
             componentSetFactory
     }
         , groupFactory{ componentSetFactory, archetypeFactory } {
@@ -20,6 +21,58 @@ namespace wasp::ecs::component {
         groupFactory.recreate(componentSetFactory);
     }
 
+    void ComponentStorage::clearEntities() {
+        for (const auto& archetypePointer : archetypeFactory.getArchetypePointers()) {
+            archetypePointer->clearComponents();
+        }
+    }
+
+    void ComponentStorage::snapshot(
+        DataStorageSnapshot& snapshot,
+        std::unordered_map<const ComponentSet*, std::uint32_t>& archetypeIndices
+    ) const {
+        const auto& archetypePointers{ archetypeFactory.getArchetypePointers() };
+        if (snapshot.archetypes.size() < archetypePointers.size()) {
+            snapshot.archetypes.resize(archetypePointers.size());
+        }
+        snapshot.archetypeCount = archetypePointers.size();
+        archetypeIndices.clear();
+
+        for (std::size_t i{ 0 }; i < archetypePointers.size(); ++i) {
+            const Archetype& archetype{ *archetypePointers[i] };
+            auto& archetypeSnapshot{ snapshot.archetypes[i] };
+
+            archetypeSnapshot.typeIndices 
+                = archetype.getComponentKeyPointer()->getPresentTypeIndices();
+            archetype.writeSnapshot(archetypeSnapshot, snapshot.buffer);
+            archetypeIndices[archetype.getComponentKeyPointer()] 
+                = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    void ComponentStorage::restore(
+        const DataStorageSnapshot& snapshot,
+        std::vector<const ComponentSet*>& componentSetPointers
+    ) {
+        for (const auto& archetypePointer : archetypeFactory.getArchetypePointers()) {
+            archetypePointer->clearComponents();
+        }
+        componentSetPointers.clear();
+        componentSetPointers.reserve(snapshot.archetypeCount);
+
+        for (std::size_t i{ 0 }; i < snapshot.archetypeCount; ++i) {
+            const auto& archetypeSnapshot{ snapshot.archetypes[i] };
+            const ComponentSet& componentSet{
+                componentSetFactory.makeSet(archetypeSnapshot.typeIndices)
+            };
+            componentSet.getAssociatedArchetypeWeakPointer().lock()->readSnapshot(
+                archetypeSnapshot, 
+                snapshot.buffer
+            );
+            componentSetPointers.push_back(&componentSet);
+        }
+    }
+
     void ComponentStorage::removeEntity(
         const RemoveEntityOrder& removeEntityOrder,
         const ComponentSet& componentSet
@@ -2,6 +2,8 @@
 
 namespace wasp::ecs {
 
+    std::uint64_t DataStorage::groupEpochCounter{ 0 };
+
     //Returns an entity handle for the entity with the specified entityID of the
     //current generation. Throws runtime_error if there is no such alive entity.
     DataStorage::EntityHandle DataStorage::makeHandle(EntityID entityID) const {
@@ -11,6 +13,53 @@ namespace wasp::ecs {
         throw std::runtime_error{ "tried to make handle of dead entity!" };
     }
 
+    bool DataStorage::setParent(EntityHandle childHandle, EntityHandle parentHandle) {
+        if (isDead(childHandle) || isDead(parentHandle)) {
+            return false;
+        }
+        //walk up from the parent to make sure no cycle is made
+        EntityID ancestorID{ parentHandle.entityID };
+        while (ancestorID != entity::noEntityID) {
+            if (ancestorID == childHandle.entityID) {
+                throw std::runtime_error{
+                    "tried to make entity " + std::to_string(childHandle.entityID)
+                    + " its own ancestor!"
+                };
+            }
+            ancestorID = entityMetadataStorage.getRelations(ancestorID).parentID;
+        }
+        entityMetadataStorage.setParent(childHandle.entityID, parentHandle.entityID);
+        return true;
+    }
+
+    bool DataStorage::removeParent(EntityHandle childHandle) {
+        if (isDead(childHandle)) {
+            return false;
+        }
+        if (entityMetadataStorage.getRelations(childHandle.entityID).parentID
+            == entity::noEntityID
+        ) {
+            return false;
+        }
+        entityMetadataStorage.removeParent(childHandle.entityID);
+        return true;
+    }
+
+    std::optional<DataStorage::EntityHandle> DataStorage::getParent(
+        EntityHandle entityHandle
+    ) const {
+        if (isDead(entityHandle)) {
+            return std::nullopt;
+        }
+        EntityID parentID{
+            entityMetadataStorage.getRelations(entityHandle.entityID).parentID
+        };
+        if (parentID == entity::noEntityID) {
+            return std::nullopt;
+        }
+        return makeHandle(parentID);
+    }
+
     //returns true if successfully removed entity, false otherwise
     bool DataStorage::removeEntity(RemoveEntityOrder removeEntityOrder) {
         if (isAlive(removeEntityOrder.entityHandle)) {
@@ -27,6 +76,45 @@ namespace wasp::ecs {
         return false;
     }
 
+    void DataStorage::snapshot(DataStorageSnapshot& snapshot) const {
+        std::unordered_map<const ComponentSet*, std::uint32_t> archetypeIndices{};
+        snapshot.buffer.clear();
+        componentStorage.snapshot(snapshot, archetypeIndices);
+        entityMetadataStorage.snapshot(snapshot, archetypeIndices);
+        snapshot.hash = getHash();
+    }
+
+    void DataStorage::restore(const DataStorageSnapshot& snapshot) {
+        std::vector<const ComponentSet*> componentSetPointers{};
+        componentStorage.restore(snapshot, componentSetPointers);
+        entityMetadataStorage.restore(snapshot, componentSetPointers);
+    }
+
+    std::uint64_t DataStorage::getHash() const {
+        std::uint64_t hash{ utility::hashOffsetBasis };
+        const std::size_t entityCount{ entityMetadataStorage.getCapacity() };
+        for (EntityID entityID{ 0 }; entityID < entityCount; ++entityID) {
+            if (isDead(entityID)) {
+                continue;
+            }
+            const EntityMetadata metadata{ getMetadata(entityID) };
+            const entity::EntityRelations& relations{ metadata.getRelations() };
+            hash = utility::hashValue(hash, entityID);
+            hash = utility::hashValue(hash, metadata.getGeneration());
+            hash = utility::hashValue(hash, relations.parentID);
+            hash = utility::hashValue(hash, relations.firstChildID);
+            hash = utility::hashValue(hash, relations.nextSiblingID);
+            hash = utility::hashValue(hash, relations.previousSiblingID);
+
+            const ComponentSet* componentSetPointer{ metadata.getComponentSetPointer() };
+            if (componentSetPointer) {
+                hash = componentSetPointer->getAssociatedArchetypeWeakPointer().lock()
+                    ->hashEntity(entityID, hash);
+            }
+        }
+        return hash;
+    }
+
     void DataStorage::setComponentSetPointer(
         EntityID entityID,
         const ComponentSet* componentSetPointer
@@ -26,11 +26,14 @@ namespace wasp::ecs::entity {
     EntityHandle EntityMetadataStorage::createEntity() {
         EntityID entityID{ freeEntityIDStorage.retrieveID() };
         resizeIfNecessary(entityID);
-        auto generation{ entityMetadataList[entityID].getGeneration() };
-        return { entityID, generation };
+        EntityMetadata& metadata{ entityMetadataList[entityID] };
+        metadata.markIssued();
+        return { entityID, metadata.getGeneration() };
     }
 
     void EntityMetadataStorage::reclaimEntity(EntityID entityID) {
+        removeParent(entityID);
+        orphanChildren(entityID);
         entityMetadataList[entityID].newGeneration();
         freeEntityIDStorage.reclaimID(entityID);
     }
@@ -56,6 +59,119 @@ namespace wasp::ecs::entity {
         return entityMetadataList[entityID];
     }
 
+    void EntityMetadataStorage::setParent(EntityID childID, EntityID parentID) {
+        removeParent(childID);
+        resizeIfNecessary(parentID);
+        EntityRelations& childRelations{ entityMetadataList[childID].getRelations() };
+        EntityRelations& parentRelations{ entityMetadataList[parentID].getRelations() };
+
+        if (parentRelations.firstChildID != noEntityID) {
+            entityMetadataList[parentRelations.firstChildID]
+                .getRelations().previousSiblingID = childID;
+        }
+        childRelations.parentID = parentID;
+        childRelations.nextSiblingID = parentRelations.firstChildID;
+        childRelations.previousSiblingID = noEntityID;
+        parentRelations.firstChildID = childID;
+    }
+
+    void EntityMetadataStorage::removeParent(EntityID childID) {
+        resizeIfNecessary(childID);
+        EntityRelations& childRelations{ entityMetadataList[childID].getRelations() };
+        if (childRelations.parentID == noEntityID) {
+            return;
+        }
+
+        if (childRelations.previousSiblingID != noEntityID) {
+            entityMetadataList[childRelations.previousSiblingID]
+                .getRelations().nextSiblingID = childRelations.nextSiblingID;
+        }
+        else {
+            entityMetadataList[childRelations.parentID]
+                .getRelations().firstChildID = childRelations.nextSiblingID;
+        }
+        if (childRelations.nextSiblingID != noEntityID) {
+            entityMetadataList[childRelations.nextSiblingID]
+                .getRelations().previousSiblingID = childRelations.previousSiblingID;
+        }
+        childRelations.parentID = noEntityID;
+        childRelations.nextSiblingID = noEntityID;
+        childRelations.previousSiblingID = noEntityID;
+    }
+
+    const EntityRelations& EntityMetadataStorage::getRelations(EntityID entityID) const {
+        resizeIfNecessary(entityID);
+        return entityMetadataList[entityID].getRelations();
+    }
+
+    void EntityMetadataStorage::snapshot(
+        DataStorageSnapshot& snapshot,
+        const std::unordered_map<const component::ComponentSet*, std::uint32_t>&
+            archetypeIndices
+    ) const {
+        snapshot.entities.resize(entityMetadataList.size());
+        for (std::size_t i{ 0 }; i < entityMetadataList.size(); ++i) {
+            const EntityMetadata& metadata{ entityMetadataList[i] };
+            auto& entitySnapshot{ snapshot.entities[i] };
+
+            entitySnapshot.archetypeIndex = DataStorageSnapshot::noArchetype;
+            if (metadata.getComponentSetPointer()) {
+                entitySnapshot.archetypeIndex 
+                    = archetypeIndices.at(metadata.getComponentSetPointer());
+            }
+            entitySnapshot.generation = metadata.getGeneration();
+            entitySnapshot.relations = metadata.getRelations();
+        }
+        snapshot.liveEntityIDs = freeEntityIDStorage.getEntityIDSet();
+        snapshot.nextEntityIDPosition = freeEntityIDStorage.getCurrentPos();
+    }
+
+    void EntityMetadataStorage::restore(
+        const DataStorageSnapshot& snapshot,
+        const std::vector<const component::ComponentSet*>& componentSetPointers
+    ) {
+        //slots past the end of the snapshot are dead in it but may have been
+        //handed out since, so they are kept
+        if (snapshot.entities.size() > entityMetadataList.size()) {
+            entityMetadataList.resize(snapshot.entities.size());
+        }
+        for (std::size_t i{ 0 }; i < entityMetadataList.size(); ++i) {
+            EntityMetadata& metadata{ entityMetadataList[i] };
+            int highestIssuedGeneration{ metadata.getHighestIssuedGeneration() };
+
+            const component::ComponentSet* componentSetPointer{ nullptr };
+            int generation{ metadata.getGeneration() };
+            EntityRelations relations{};
+            bool liveInSnapshot{ false };
+            if (i < snapshot.entities.size()) {
+                const auto& entitySnapshot{ snapshot.entities[i] };
+                if (entitySnapshot.archetypeIndex != DataStorageSnapshot::noArchetype) {
+                    componentSetPointer 
+                        = componentSetPointers[entitySnapshot.archetypeIndex];
+                }
+                generation = entitySnapshot.generation;
+                relations = entitySnapshot.relations;
+                liveInSnapshot = i < snapshot.liveEntityIDs.size()
+                    && snapshot.liveEntityIDs[i];
+            }
+
+            //an entity live in the snapshot keeps its generation so handles
+            //stored inside the restored components stay valid; a dead slot
+            //whose generation was given out after the snapshot is moved past
+            //it, so those newer handles cannot match the next entity there
+            if (!liveInSnapshot && highestIssuedGeneration >= generation) {
+                generation = highestIssuedGeneration + 1;
+            }
+
+            metadata = EntityMetadata{ componentSetPointer, generation, relations };
+            metadata.setHighestIssuedGeneration(highestIssuedGeneration);
+        }
+        freeEntityIDStorage.restore(
+            snapshot.liveEntityIDs, 
+            snapshot.nextEntityIDPosition
+        );
+    }
+
     void EntityMetadataStorage::resizeIfNecessary(EntityID entityID) const {
         if (entityID >= entityMetadataList.size()) {
             entityMetadataList.resize(
@@ -63,4 +179,17 @@ namespace wasp::ecs::entity {
             );
         }
     }
+
+    void EntityMetadataStorage::orphanChildren(EntityID parentID) {
+        EntityRelations& parentRelations{ entityMetadataList[parentID].getRelations() };
+        EntityID childID{ parentRelations.firstChildID };
+        while (childID != noEntityID) {
+            EntityRelations& childRelations{ entityMetadataList[childID].getRelations() };
+            childID = childRelations.nextSiblingID;
+            childRelations.parentID = noEntityID;
+            childRelations.nextSiblingID = noEntityID;
+            childRelations.previousSiblingID = noEntityID;
+        }
+        parentRelations.firstChildID = noEntityID;
+    }
 }
\ No newline at end of file
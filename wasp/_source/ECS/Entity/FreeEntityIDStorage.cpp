@@ -1,5 +1,7 @@
 #include "ECS/Entity/FreeEntityIDStorage.h"
 
+#include <algorithm>
+
 namespace wasp::ecs::entity {
 
     namespace {
@@ -67,6 +69,17 @@ namespace wasp::ecs::entity {
         }
     }
 
+    void FreeEntityIDStorage::restore(
+        const std::vector<bool>& entityIDSet, 
+        std::size_t currentPos
+    ) {
+        this->entityIDSet = entityIDSet;
+        currentLiveEntities = static_cast<std::vector<bool>::size_type>(
+            std::count(entityIDSet.begin(), entityIDSet.end(), true)
+        );
+        this->currentPos = currentPos;
+    }
+
     void FreeEntityIDStorage::resizeIfNecessary() {
         float usageCapacity{
             static_cast<float>(currentLiveEntities) / entityIDSet.size()
@@ -1,5 +1,6 @@
 #include "Game/Resources/Dialogue.h"
 
+#include <atomic>
 #include <fstream>
 #include <sstream>
 #include <unordered_map>
@@ -24,7 +25,7 @@ namespace wasp::game::resources {
 		}
 	}
 	
-	DialogueCommand parseDialogueLine(const std::wstring& line) {
+	void parseDialogueLine(const std::wstring& line, int textColumns, Dialogue& dialogue) {
 		std::wstringstream stringStream { line };
 		
 		std::wstring commandString {};
@@ -33,21 +34,42 @@ namespace wasp::game::resources {
 		std::wstring data {};
 		std::getline(stringStream, data, L']');
 		
-		return { parseCommandString(commandString), data };
+		DialogueCommand dialogueCommand { parseCommandString(commandString) };
+		dialogueCommand.dataOffset = static_cast<std::uint32_t>(dialogue.stringPool.size());
+		dialogueCommand.dataLength = static_cast<std::uint32_t>(data.size());
+		dialogue.stringPool += data;
+		
+		if( dialogueCommand.command == DialogueCommand::Commands::setText ) {
+			dialogueCommand.glyphOffset = static_cast<std::uint32_t>(
+				dialogue.glyphPool.size()
+			);
+			shapeText(data, textColumns, dialogue.glyphPool);
+			dialogueCommand.glyphCount = static_cast<std::uint32_t>(
+				dialogue.glyphPool.size() - dialogueCommand.glyphOffset
+			);
+		}
+		dialogue.commands.push_back(dialogueCommand);
 	}
 	
-	Dialogue parseDialogueFile(const std::wstring& fileName) {
+	Dialogue parseDialogueFile(const std::wstring& fileName, int textColumns) {
+		//dialogues may be parsed on several loading threads at once
+		static std::atomic<std::uint32_t> nextID { 1 };
 		
 		Dialogue dialogue {};
+		dialogue.id = nextID.fetch_add(1, std::memory_order_relaxed);
 		
 		std::wifstream inStream { fileName };
 		std::wstring line {};
 		
 		while( std::getline(inStream, line) ) {
-			dialogue.push_back(parseDialogueLine(line));
+			parseDialogueLine(line, textColumns, dialogue);
 		}
 		
 		inStream.close();
+		
+		dialogue.commands.shrink_to_fit();
+		dialogue.stringPool.shrink_to_fit();
+		dialogue.glyphPool.shrink_to_fit();
 		return dialogue;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "Game/Resources/ShapedText.h"
+
+#include <stdexcept>
+
+namespace wasp::game::resources {
+	
+	void shapeText(
+		std::wstring_view text,
+		int columns,
+		std::vector<ShapedGlyph>& glyphPool
+	) {
+		if( columns <= 0 ) {
+			throw std::runtime_error { "Error shaping text without columns" };
+		}
+		int column { 0 };
+		int row { 0 };
+		const auto stepCursor { [&]() {
+			++column;
+			if( column >= columns ) {
+				column = 0;
+				++row;
+			}
+		} };
+		for( wchar_t symbol : text ) {
+			switch( symbol ) {
+				case L' ':
+					stepCursor();
+					break;
+				case L'\t':
+					stepCursor();
+					stepCursor();
+					stepCursor();
+					break;
+				case L'\n':
+					column = 0;
+					++row;
+					break;
+				default:
+					glyphPool.push_back({
+						symbol,
+						static_cast<std::uint16_t>(column),
+						static_cast<std::uint16_t>(row)
+					});
+					stepCursor();
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include <cmath>
 
+#include "Math/Trigonometry.h"
+
 namespace wasp::math {
 	
 	PolarVector::PolarVector(float magnitude, Angle angle)
@@ -26,18 +28,26 @@ namespace wasp::math {
 		updateVector2Representation();
 	}
 	
-	PolarVector::operator Vector2() const {
-		return vector2Representation;
-	}
-	
+	//WASP_EXACT_TRIG switches back to the standard library, which is more precise but
+	//may differ between machines
 	void PolarVector::updateVector2Representation() {
+		#ifdef WASP_EXACT_TRIG
 		float radians { angle.getAngleRadians() };
 		vector2Representation.x = magnitude * std::cosf(radians);
 		vector2Representation.y = -1 * magnitude * std::sinf(radians);
+		#else
+		SinCos sinCos { sinCosDegrees(angle.getAngle()) };
+		vector2Representation.x = magnitude * sinCos.cos;
+		vector2Representation.y = -1 * magnitude * sinCos.sin;
+		#endif
 	}
 	
 	Angle getAngle(const Vector2& vector) {
 		//atan2 takes (y, x) and not (x, y)
+		#ifdef WASP_EXACT_TRIG
 		return Angle { toDegrees(std::atan2f(-vector.y, vector.x)) };
+		#else
+		return Angle { atan2Degrees(-vector.y, vector.x) };
+		#endif
 	}
 }
\ No newline at end of file
@@ -0,0 +1,17 @@
+#include "Math/Trigonometry.h"
+
+namespace wasp::math {
+	
+	void toVector2s(
+		const float* magnitudes,
+		const float* degrees,
+		Vector2* vectors,
+		std::size_t count
+	) {
+		for( std::size_t i { 0 }; i < count; ++i ) {
+			SinCos sinCos { sinCosDegrees(degrees[i]) };
+			vectors[i].x = magnitudes[i] * sinCos.cos;
+			vectors[i].y = -1 * magnitudes[i] * sinCos.sin;
+		}
+	}
+}
\ No newline at end of file
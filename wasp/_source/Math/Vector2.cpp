@@ -42,6 +42,6 @@ namespace wasp::math {
 	
 	//utility functions
 	float getMagnitude(const Vector2& vector) {
-		return std::sqrtf((vector.x * vector.x) + (vector.y * vector.y));
+		return std::sqrt((vector.x * vector.x) + (vector.y * vector.y));
 	}
 }
\ No newline at end of file
@@ -3,7 +3,7 @@
 namespace wasp::sound::midi {
 	
 	MidiHub::MidiHub(bool muted)
-		: midiOut {}, midiSequencer { &midiOut }, muted { muted } {
+		: midiOut {}, midiTimer {}, midiSequencer { &midiOut, &midiTimer }, muted { muted } {
 	}
 	
 	void MidiHub::start(std::shared_ptr<MidiSequence> midiSequencePointer) {
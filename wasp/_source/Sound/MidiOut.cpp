@@ -66,7 +66,14 @@ namespace wasp::sound::midi {
 		);
 	}
 	
-	void MidiOut::outputSystemExclusive(MIDIHDR* midiHDRPointer) {
+	void MidiOut::outputSystemExclusive(const uint8_t* data, uint32_t byteLength) {
+		//the mapper only reads the buffer
+		MIDIHDR midiHDR {};
+		midiHDR.lpData = const_cast<char*>(reinterpret_cast<const char*>(data));
+		midiHDR.dwBufferLength = byteLength;
+		midiHDR.dwBytesRecorded = byteLength;
+		MIDIHDR* midiHDRPointer { &midiHDR };
+		
 		auto result { midiOutPrepareHeader(midiOutHandle, midiHDRPointer, sizeof(MIDIHDR)) };
 		if( result != MMSYSERR_NOERROR ) {
 			throw std::runtime_error { "Error preparing sysEx" };
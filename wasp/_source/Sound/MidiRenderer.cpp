@@ -0,0 +1,54 @@
+#include "Sound/MidiRenderer.h"
+
+#include <stdexcept>
+
+#include "Sound/MidiTimeline.h"
+
+namespace wasp::sound::midi {
+	
+	MidiRenderer::MidiRenderer(std::chrono::nanoseconds maxLength)
+		: maxLength { maxLength } {
+	}
+	
+	void MidiRenderer::start(std::shared_ptr<MidiSequence> midiSequencePointer) {
+		stop();
+		if( !midiSequencePointer ) {
+			throw std::runtime_error { "Error rendering null MIDI sequence" };
+		}
+		
+		//a sequence has at most one output per unit before it loops
+		renderedEvents.reserve(midiSequencePointer->compiledTrack.size());
+		
+		MidiTimeline timeline { *midiSequencePointer };
+		MidiTimeline::TimedEvent timedEvent {};
+		while( timeline.next(timedEvent) ) {
+			if( timedEvent.time > maxLength ) {
+				cutOff = true;
+				break;
+			}
+			RenderedEvent renderedEvent { timedEvent.time, timedEvent.shortMsg };
+			if( timedEvent.systemExclusiveData ) {
+				renderedEvent.isSystemExclusive = true;
+				renderedEvent.systemExclusiveIndex
+					= static_cast<uint32_t>(systemExclusiveBuffer.size());
+				renderedEvent.systemExclusiveLength = timedEvent.systemExclusiveLength;
+				systemExclusiveBuffer.insert(
+					systemExclusiveBuffer.end(),
+					timedEvent.systemExclusiveData,
+					timedEvent.systemExclusiveData + timedEvent.systemExclusiveLength
+				);
+			}
+			renderedEvents.push_back(renderedEvent);
+			length = timedEvent.time;
+		}
+		loopCount = timeline.getLoopCount();
+	}
+	
+	void MidiRenderer::stop() {
+		renderedEvents.clear();
+		systemExclusiveBuffer.clear();
+		length = {};
+		loopCount = 0;
+		cutOff = false;
+	}
+}
\ No newline at end of file
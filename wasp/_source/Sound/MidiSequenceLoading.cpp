@@ -1,10 +1,14 @@
 #include "Sound/MidiSequenceLoading.h"
 
 #include <fstream>
+#include <filesystem>
+#include <cstring>
+#include <algorithm>
+#include <limits>
 
-#include "Utility\ByteUtil.h"
-#include "Math\MathUtil.h"
-#include "Sound\MidiConstants.h"
+#include "Utility/ByteUtil.h"
+#include "Math/MathUtil.h"
+#include "Sound/MidiConstants.h"
 
 namespace wasp::sound::midi {
 	
@@ -594,6 +598,11 @@ namespace wasp::sound::midi {
 		}
 		//1 track left, append all into our compiled track
 		auto& individualTrack { individualTracks[0] };
+		//its next delta time counts from the last event we inserted, not its own
+		if( indices[0] < individualTrack.size() ) {
+			compiledTrack[compiledIndex] = individualTrack[indices[0]++];
+			compiledTrack[compiledIndex++].deltaTime = deltaTimes[0];
+		}
 		while( indices[0] < individualTrack.size() ) {
 			compiledTrack[compiledIndex++] = individualTrack[indices[0]++];
 		}
@@ -624,7 +633,7 @@ namespace wasp::sound::midi {
 		//where we are along each individual track
 		std::vector<size_t> indices(individualTracks.size());
 		//where we are on our compiled track
-		size_t compiledIndex { 0 };
+		uint32_t compiledIndex { 0 };
 		
 		//find and insert events by chronological depth
 		bool placedLoopStart { false };
@@ -659,7 +668,7 @@ namespace wasp::sound::midi {
 			}
 			if( loopEnd != -1 && !placedLoopEnd ) {
 				//case where loop end is directly after loop start is handled
-				placedLoopStart = insertLoopEventIfNecessary(
+				placedLoopEnd = insertLoopEventIfNecessary(
 					compiledTrack,
 					compiledIndex,
 					loopEnd,
@@ -733,8 +742,405 @@ namespace wasp::sound::midi {
 		return compiledTrack;
 	}
 	
+	//span parsing
+	
+	namespace {
+		//Reads big endian values and variable length quantities from a span of bytes,
+		//throwing rather than reading past the end.
+		class ByteSpanReader {
+		private:
+			//fields
+			const uint8_t* current {};
+			const uint8_t* end {};
+		
+		public:
+			ByteSpanReader(const uint8_t* begin, const uint8_t* end)
+				: current { begin }
+				, end { end } {
+			}
+			
+			bool isAtEnd() const {
+				return current >= end;
+			}
+			
+			uint8_t readByte() {
+				throwIfFewerThan(1);
+				return *current++;
+			}
+			
+			uint16_t readBigEndian16() {
+				throwIfFewerThan(2);
+				uint16_t toRet { static_cast<uint16_t>((current[0] << 8) | current[1]) };
+				current += 2;
+				return toRet;
+			}
+			
+			uint32_t readBigEndian32() {
+				throwIfFewerThan(4);
+				uint32_t toRet {
+					(static_cast<uint32_t>(current[0]) << 24)
+					| (static_cast<uint32_t>(current[1]) << 16)
+					| (static_cast<uint32_t>(current[2]) << 8)
+					| static_cast<uint32_t>(current[3])
+				};
+				current += 4;
+				return toRet;
+			}
+			
+			uint32_t readVariableLength() {
+				uint32_t toRet {};
+				uint8_t byte {};
+				do {
+					byte = readByte();
+					toRet = (toRet << 7) + (byte & 0b0111'1111);
+				} while( byte & 0b1000'0000 );
+				return toRet;
+			}
+			
+			//returns a pointer to the skipped bytes
+			const uint8_t* skip(std::size_t byteCount) {
+				throwIfFewerThan(byteCount);
+				const uint8_t* toRet { current };
+				current += byteCount;
+				return toRet;
+			}
+		
+		private:
+			void throwIfFewerThan(std::size_t byteCount) const {
+				if( static_cast<std::size_t>(end - current) < byteCount ) {
+					throw std::runtime_error { "Error MIDI data truncated" };
+				}
+			}
+		};
+		
+		//One event as it lies in the file. Length events point at their payload in
+		//place, so it can be copied straight into the compiled track.
+		struct SpanEvent {
+			enum class Kind {
+				midi,
+				meta,
+				systemExclusive,
+				endOfTrack
+			};
+			
+			Kind kind {};
+			uint32_t event {};	//the first block minus its delta time
+			const uint8_t* payload {};
+			uint32_t length {};
+			bool insertSystemExclusiveStart {};
+			
+			//byte length as stored in the length block
+			uint32_t getStoredLength() const {
+				return (insertSystemExclusiveStart && length > 0) ? length + 1 : length;
+			}
+			
+			//blocks taken in the compiled track; see loadMetaEvent and loadSystemExclusiveEvent
+			std::size_t getUnitCount() const {
+				switch( kind ) {
+					case Kind::midi:
+						return 1;
+					case Kind::endOfTrack:
+						return 0;
+					default:
+						return 2 + ceilingIntegerDivide(
+							getStoredLength(),
+							static_cast<uint32_t>(sizeof(EventUnit))
+						);
+				}
+			}
+		};
+		
+		//reads the status and body of an event; the delta time is already read
+		SpanEvent readSpanEvent(ByteSpanReader& reader, uint8_t& lastStatus) {
+			uint8_t status { reader.readByte() };
+			uint8_t firstDataByte {};
+			bool isRunningStatus { status < 0b1000'0000 };
+			if( isRunningStatus ) {
+				if( lastStatus == 0 ) {
+					throw std::runtime_error { "Error MIDI running status without status" };
+				}
+				firstDataByte = status;
+				status = lastStatus;
+			}
+			
+			SpanEvent spanEvent {};
+			uint8_t maskedStatus { static_cast<uint8_t>(status & statusMask) };
+			if( maskedStatus != metaEventOrSystemExclusive ) {
+				if( !isRunningStatus ) {
+					firstDataByte = reader.readByte();
+				}
+				spanEvent.kind = SpanEvent::Kind::midi;
+				spanEvent.event = static_cast<uint32_t>(status)
+					| (static_cast<uint32_t>(firstDataByte) << 8);
+				if( maskedStatus != programChange && maskedStatus != channelPressure ) {
+					spanEvent.event |= static_cast<uint32_t>(reader.readByte()) << 16;
+				}
+				lastStatus = status;
+				return spanEvent;
+			}
+			
+			if( status == metaEvent ) {
+				uint8_t metaEventStatus { reader.readByte() };
+				spanEvent.kind = metaEventStatus == endOfTrack
+					? SpanEvent::Kind::endOfTrack
+					: SpanEvent::Kind::meta;
+				spanEvent.event = (static_cast<uint32_t>(metaEventStatus) << 8) | status;
+			}
+			else if( status == systemExclusiveStart || status == systemExclusiveEnd ) {
+				spanEvent.kind = SpanEvent::Kind::systemExclusive;
+				spanEvent.event = status;
+				spanEvent.insertSystemExclusiveStart = status == systemExclusiveStart;
+			}
+			else {
+				throw std::runtime_error { "Error MIDI unexpected status in file" };
+			}
+			spanEvent.length = reader.readVariableLength();
+			spanEvent.payload = reader.skip(spanEvent.length);
+			lastStatus = 0;
+			return spanEvent;
+		}
+		
+		//writes an event at the given index and returns the index after it
+		std::size_t writeSpanEvent(
+			EventUnitTrack& track,
+			std::size_t index,
+			uint32_t deltaTime,
+			const SpanEvent& spanEvent
+		) {
+			track[index++] = { deltaTime, spanEvent.event };
+			if( spanEvent.kind == SpanEvent::Kind::midi ) {
+				return index;
+			}
+			track[index] = encodeLength(spanEvent.getStoredLength());
+			uint32_t indexLength { track[index++].event };
+			if( spanEvent.length > 0 ) {
+				auto* destination { reinterpret_cast<uint8_t*>(&track[index]) };
+				if( spanEvent.insertSystemExclusiveStart ) {
+					*destination++ = systemExclusiveStart;
+				}
+				std::memcpy(destination, spanEvent.payload, spanEvent.length);
+				index += indexLength;
+			}
+			return index;
+		}
+		
+		std::size_t writeSpanLoopEvent(
+			EventUnitTrack& track,
+			std::size_t index,
+			uint32_t deltaTime
+		) {
+			track[index++] = { deltaTime, (static_cast<uint32_t>(tempo) << 8) | metaEvent };
+			track[index++] = MidiSequence::loopEncoding;
+			return index;
+		}
+		
+		struct SpanTrack {
+			const uint8_t* begin {};
+			const uint8_t* end {};
+		};
+		
+		struct SpanFile {
+			uint16_t format {};
+			uint16_t ticks {};
+			std::vector<SpanTrack> tracks {};
+			std::size_t unitCount {};	//blocks needed by every event of every track
+		};
+		
+		//walks every event of a track once to find how much of the compiled track it fills
+		std::size_t countSpanTrackUnits(const SpanTrack& spanTrack) {
+			ByteSpanReader reader { spanTrack.begin, spanTrack.end };
+			uint8_t lastStatus { 0 };
+			std::size_t unitCount { 0 };
+			while( !reader.isAtEnd() ) {
+				reader.readVariableLength();
+				SpanEvent spanEvent { readSpanEvent(reader, lastStatus) };
+				if( spanEvent.kind == SpanEvent::Kind::endOfTrack ) {
+					break;
+				}
+				unitCount += spanEvent.getUnitCount();
+			}
+			return unitCount;
+		}
+		
+		SpanFile preScanMidiData(const uint8_t* data, std::size_t size) {
+			ByteSpanReader reader { data, data + size };
+			SpanFile spanFile {};
+			
+			if( reader.readBigEndian32() != requiredHeaderID ) {
+				throw std::runtime_error { "Error MIDI file invalid header identifier" };
+			}
+			uint32_t headerSize { reader.readBigEndian32() };
+			if( headerSize < minimumHeaderSize ) {
+				throw std::runtime_error { "Error MIDI file header too small" };
+			}
+			spanFile.format = reader.readBigEndian16();
+			uint16_t trackCount { reader.readBigEndian16() };
+			spanFile.ticks = reader.readBigEndian16();
+			reader.skip(headerSize - minimumHeaderSize);
+			
+			if( spanFile.format == formatSingleTrack ) {
+				trackCount = 1;
+			}
+			else if( spanFile.format != formatMultiTrackSync ) {
+				throw std::runtime_error { "Error unsupported MIDI format" };
+			}
+			
+			spanFile.tracks.reserve(trackCount);
+			for( uint16_t i { 0 }; i < trackCount; ++i ) {
+				if( reader.readBigEndian32() != requiredTrackHeaderID ) {
+					throw std::runtime_error { "Error MIDI file invalid track identifier" };
+				}
+				uint32_t length { reader.readBigEndian32() };
+				const uint8_t* begin { reader.skip(length) };
+				spanFile.tracks.push_back({ begin, begin + length });
+				spanFile.unitCount += countSpanTrackUnits(spanFile.tracks.back());
+			}
+			return spanFile;
+		}
+		
+		//the next event of one track during the merge
+		struct SpanTrackCursor {
+			ByteSpanReader reader;	//not initialized!
+			uint8_t lastStatus {};
+			int64_t time {};	//absolute time of the pending event
+			SpanEvent pendingEvent {};
+			
+			explicit SpanTrackCursor(const SpanTrack& spanTrack)
+				: reader { spanTrack.begin, spanTrack.end } {
+			}
+			
+			//returns false once the track has ended
+			bool advance() {
+				if( reader.isAtEnd() ) {
+					return false;
+				}
+				time += reader.readVariableLength();
+				pendingEvent = readSpanEvent(reader, lastStatus);
+				return pendingEvent.kind != SpanEvent::Kind::endOfTrack;
+			}
+		};
+		
+		//Merges every track straight into one compiled track sized by the pre scan. Ties
+		//go to the lower track, as in compileTracks.
+		EventUnitTrack compileSpanTracks(
+			const SpanFile& spanFile,
+			bool isLooped,
+			int64_t loopStart,
+			int64_t loopEnd
+		) {
+			//a looped track gains a loop start and a loop end, 2 blocks each
+			EventUnitTrack compiledTrack(spanFile.unitCount + (isLooped ? 4 : 0));
+			std::size_t index { 0 };
+			
+			std::vector<SpanTrackCursor> cursors {};
+			cursors.reserve(spanFile.tracks.size());
+			//min heap of cursor indices on time then track
+			std::vector<std::size_t> heap {};
+			heap.reserve(spanFile.tracks.size());
+			auto isLater { [&cursors](std::size_t left, std::size_t right) {
+				if( cursors[left].time != cursors[right].time ) {
+					return cursors[left].time > cursors[right].time;
+				}
+				return left > right;
+			} };
+			for( const SpanTrack& spanTrack : spanFile.tracks ) {
+				SpanTrackCursor& cursor { cursors.emplace_back(spanTrack) };
+				if( cursor.advance() ) {
+					heap.push_back(cursors.size() - 1);
+				}
+			}
+			std::make_heap(heap.begin(), heap.end(), isLater);
+			
+			int64_t realTime { 0 };
+			bool placedLoopStart { false };
+			bool placedLoopEnd { false };
+			auto placeLoopIfReached { [&](int64_t loopTime, int64_t eventTime, bool& placed) {
+				if( !placed && eventTime >= loopTime ) {
+					index = writeSpanLoopEvent(
+						compiledTrack,
+						index,
+						static_cast<uint32_t>(loopTime - realTime)
+					);
+					realTime = loopTime;
+					placed = true;
+				}
+			} };
+			
+			while( !heap.empty() ) {
+				std::pop_heap(heap.begin(), heap.end(), isLater);
+				SpanTrackCursor& cursor { cursors[heap.back()] };
+				if( isLooped ) {
+					placeLoopIfReached(loopStart, cursor.time, placedLoopStart);
+					if( loopEnd != -1 ) {
+						placeLoopIfReached(loopEnd, cursor.time, placedLoopEnd);
+					}
+				}
+				index = writeSpanEvent(
+					compiledTrack,
+					index,
+					static_cast<uint32_t>(cursor.time - realTime),
+					cursor.pendingEvent
+				);
+				realTime = cursor.time;
+				if( cursor.advance() ) {
+					std::push_heap(heap.begin(), heap.end(), isLater);
+				}
+				else {
+					heap.pop_back();
+				}
+			}
+			
+			if( isLooped ) {
+				if( !placedLoopStart ) {
+					//only possible with no events at all
+					if( loopStart != 0 ) {
+						throw std::runtime_error { "Error loop start too high " };
+					}
+					index = writeSpanLoopEvent(compiledTrack, index, 0);
+				}
+				if( loopEnd == -1 ) {
+					index = writeSpanLoopEvent(compiledTrack, index, 0);
+				}
+				else if( !placedLoopEnd ) {
+					index = writeSpanLoopEvent(
+						compiledTrack,
+						index,
+						static_cast<uint32_t>(loopEnd - realTime)
+					);
+				}
+			}
+			
+			//the pre scan decoded the same events, so only loop blocks can be left over
+			compiledTrack.resize(index);
+			return compiledTrack;
+		}
+	}
+	
+	MidiSequence parseMidiData(const uint8_t* data, std::size_t size) {
+		SpanFile spanFile { preScanMidiData(data, size) };
+		MidiSequence midiSequence {};
+		midiSequence.ticks = spanFile.ticks;
+		midiSequence.compiledTrack = compileSpanTracks(spanFile, false, 0, -1);
+		return midiSequence;
+	}
+	
+	MidiSequence parseLoopedMidiData(
+		const uint8_t* data,
+		std::size_t size,
+		int64_t loopStart,
+		int64_t loopEnd
+	) {
+		throwIfInvalidLoopPoints(loopStart, loopEnd);
+		
+		SpanFile spanFile { preScanMidiData(data, size) };
+		MidiSequence midiSequence {};
+		midiSequence.ticks = spanFile.ticks;
+		midiSequence.compiledTrack = compileSpanTracks(spanFile, true, loopStart, loopEnd);
+		return midiSequence;
+	}
+	
 	MidiSequence parseMidiFile(const std::wstring& fileName) {
-		std::ifstream inStream { fileName, std::ios::binary };
+		std::ifstream inStream { std::filesystem::path { fileName }, std::ios::binary };
 		MidiSequence midiSequence {};
 		
 		//read in header file
@@ -767,7 +1173,7 @@ namespace wasp::sound::midi {
 	) {
 		throwIfInvalidLoopPoints(loopStart, loopEnd);
 		
-		std::ifstream inStream { fileName, std::ios::binary };
+		std::ifstream inStream { std::filesystem::path { fileName }, std::ios::binary };
 		MidiSequence midiSequence {};
 		
 		//read in header file
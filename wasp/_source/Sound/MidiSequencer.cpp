@@ -1,55 +1,43 @@
-#include "Sound\MidiSequencer.h"
+#include "Sound/MidiSequencer.h"
 
 #include <stdexcept>
-#include <thread>
-#include <mutex>
-#include <condition_variable>
-#include <chrono>
-
-#include "Utility\ByteUtil.h"
-#include "Utility\Scheduling.h"
+#include <cstdlib>
 
 #include "Logging.h"
 
 namespace wasp::sound::midi {
 	
-	constexpr uint64_t ratio100nsToSeconds { 10'000'000ull };
-	
-	using wasp::utility::byteSwap32;
-	using wasp::utility::getByte;
-	using wasp::utility::sleep100ns;
-	
-	//helper functions
 	namespace {
-		uint32_t convertMicrosecondsPerBeatToTimePerTick100ns(
-			uint32_t microsecondsPerBeat,
-			uint16_t ticks
-		) {
-			return (10 * microsecondsPerBeat) / ticks;
-		}
-		
-		uint32_t calculateInitialTimePerTick100ns(uint16_t ticks) {
-			//a leading 1 means SMPTE FPS time
-			if( ticks & 0b1000'0000'0000'0000 ) {
-				uint32_t fps { smpteFpsDecode(getByte(ticks, 2)) };
-				uint8_t subframeResolution { static_cast<uint8_t>(ticks) };
-				auto subframesPerSecond { fps * subframeResolution };
-				return ratio100nsToSeconds / subframesPerSecond;
-			}
-				//a leading 0 means ticks per beat
-			else {
-				return convertMicrosecondsPerBeatToTimePerTick100ns(
-					defaultMicrosecondsPerBeat,
-					ticks
-				);
+		//how far ahead of playback events are decoded
+		constexpr std::chrono::nanoseconds lookaheadWindow { std::chrono::milliseconds { 50 } };
+		//the last stretch before an event is spun through, since sleeps wake late
+		constexpr std::chrono::nanoseconds spinWindow { std::chrono::microseconds { 500 } };
+	}
+	
+	MidiSequencer::MidiSequencer(IMidiOut* midiOutPointer, IMidiTimer* midiTimerPointer)
+		: midiOutPointer { midiOutPointer }
+		, midiTimerPointer { midiTimerPointer } {
+		timingThread = std::thread {
+			[&] {
+				try {
+					this->timingLoop();
+				}
+				catch( const std::exception& exception ) {
+					debug::log(exception.what());
+					std::exit(1);
+				}
+				catch( ... ) {
+					debug::log("Exception of unknown type caught on midi timing thread");
+					std::exit(1);
+				}
 			}
-		}
+		};
 	}
 	
 	MidiSequencer::~MidiSequencer() {
-		//try to stop and turn off all notes
+		//the timing thread turns off all notes as it exits
 		try {
-			stop();
+			pushCommand({ Command::Types::shutdown });
 		}
 		catch( const std::exception& error ) {
 			//swallow error
@@ -59,221 +47,159 @@ namespace wasp::sound::midi {
 			//swallow error
 			debug::log("Exception caught of unknown type in MidiSequencer destructor");
 		}
+		if( timingThread.joinable() ) {
+			timingThread.join();
+		}
 	}
 	
 	void MidiSequencer::start(std::shared_ptr<MidiSequence> midiSequencePointer) {
-		stopPlaybackThread();
-		this->midiSequencePointer = midiSequencePointer;
-		running.store(true);
-		playbackThread = std::thread {
-			[&] {
-				try {
-					this->playback();
-				}
-				catch( const std::exception& exception ) {
-					debug::log(exception.what());
-					std::exit(1);
-				}
-				catch( ... ) {
-					debug::log("Exception of unknown type caught on midi playback thread");
-					std::exit(1);
-				}
+		pushCommand({ Command::Types::start, std::move(midiSequencePointer) });
+	}
+	
+	void MidiSequencer::stop() {
+		pushCommand({ Command::Types::stop });
+	}
+	
+	void MidiSequencer::pushCommand(Command command) {
+		//the timing thread drains the queue every time it wakes, so a full queue only
+		//means it has yet to see the wakeup
+		{
+			std::unique_lock lock { commandSpaceMutex };
+			while( !commandQueue.tryPush(command) ) {
+				midiTimerPointer->wake();
+				commandSpaceCondition.wait(lock);
 			}
-		};
+		}
+		midiTimerPointer->wake();
 	}
 	
-	void MidiSequencer::playback() {
-		using ratioTimePointTo100ns = std::ratio<
-			clockType::period::num * ratio100nsToSeconds,
-			clockType::period::den
-		>;
-		
-		midiOutPointer->outputReset();
+	void MidiSequencer::timingLoop() {
+		midiTimerPointer->enterTimingThread();
 		
-		//timing variables
-		microsecondsPerBeat = defaultMicrosecondsPerBeat;
-		timePerTick100ns = calculateInitialTimePerTick100ns(
-			midiSequencePointer->ticks
-		);
-		
-		timePointType prevTimeStamp { getCurrentTime() };
-		timePointType currentTimeStamp {};
-		
-		long long previousSleepDuration100ns { 0 };
-		
-		//loop variables
-		iter = midiSequencePointer->compiledTrack.begin();
-		auto endIter { midiSequencePointer->compiledTrack.end() };
-		loopPointIter = endIter;
-		
-		//helper function for calculating sleep duration
-		auto calculateSleepDuration100ns {
-			[&]() {
-				//calculate how long we should wait
-				long long sleepDuration100ns {
-					static_cast<long long>(iter->deltaTime) * timePerTick100ns
-				};
-				
-				//account for the time we spent already
-				currentTimeStamp = getCurrentTime();
-				long long timeElapsed {
-					((currentTimeStamp - prevTimeStamp).count()
-						* ratioTimePointTo100ns::num)
-						/ ratioTimePointTo100ns::den
-				};
-				long long timeLost { timeElapsed - previousSleepDuration100ns };
-				sleepDuration100ns -= timeLost;
-				
-				prevTimeStamp = currentTimeStamp;
-				return sleepDuration100ns;
+		while( true ) {
+			//a command pushed after this leaves a wake pending, so the next wait returns
+			if( !handleCommands() ) {
+				return;
 			}
-		};
-		
-		//begin playback
-		while( iter != endIter ) {
-			//sleep for delta time
-			if( iter->deltaTime != 0 ) {
-				long long sleepDuration100ns {
-					calculateSleepDuration100ns()
-				};
-				previousSleepDuration100ns = sleepDuration100ns;
-				
-				//check to see if need to exit before sleep
-				if( !running.load() ) {
-					//do not output reset in this case
-					resetPlaybackFields();
-					return;
-				}
-				
-				sleep100ns(sleepDuration100ns);
-				
-				//also check after sleep
-				if( !running.load() ) {
-					//do not output reset in this case
-					resetPlaybackFields();
-					return;
+			
+			fillLookahead(getPlaybackTime() + lookaheadWindow);
+			
+			//nothing playing, or the sequence is over
+			if( lookaheadSize == 0 ) {
+				if( midiSequencePointer ) {
+					//output reset if we finish naturally
+					endPlayback();
 				}
+				midiTimerPointer->wait();
+				continue;
 			}
 			
-			//handle event
-			uint8_t status { getByte(iter->event, 1) };
-			//midi event case
-			if( (status & statusMask) != metaEventOrSystemExclusive ) {
-				outputMidiEvent();
+			const TimedEvent& nextEvent { lookahead[lookaheadBegin] };
+			std::chrono::nanoseconds timeUntilEvent { nextEvent.time - getPlaybackTime() };
+			if( timeUntilEvent > spinWindow ) {
+				//wake a little early; commands also wake us
+				midiTimerPointer->waitUntil(
+					clockType::now() + (timeUntilEvent - spinWindow)
+				);
+				continue;
 			}
-				//meta event or system exclusive cases
-			else {
-				switch( status ) {
-					case metaEvent:
-						//may change tempo or loop back
-						handleMetaEvent();
-						break;
-						//continuation events and escape sequences start with sysEx end
-						//the data is encoded the same way
-					case systemExclusiveStart:
-					case systemExclusiveEnd: outputSystemExclusiveEvent();
-						break;
-					default: throw std::runtime_error { "Error unrecognized MIDI status" };
-				}
+			while( getPlaybackTime() < nextEvent.time ) {
+				std::this_thread::yield();
+			}
+			
+			//send everything now due
+			std::chrono::nanoseconds playbackTime { getPlaybackTime() };
+			while( lookaheadSize > 0 && lookahead[lookaheadBegin].time <= playbackTime ) {
+				outputEvent(lookahead[lookaheadBegin]);
+				lookaheadBegin = (lookaheadBegin + 1) % lookaheadCapacity;
+				--lookaheadSize;
 			}
 		}
-		
-		//output reset if we finish naturally
-		midiOutPointer->outputReset();
-		resetPlaybackFields();
-		running.store(false);
 	}
 	
-	void MidiSequencer::stop() {
-		stopPlaybackThread();
-		midiOutPointer->outputReset();
+	bool MidiSequencer::handleCommands() {
+		Command command {};
+		while( commandQueue.tryPop(command) ) {
+			//a producer may be waiting for the slot just freed; taking the lock orders
+			//this after its failed push, so the notification cannot be missed
+			{
+				std::lock_guard lock { commandSpaceMutex };
+			}
+			commandSpaceCondition.notify_one();
+			
+			switch( command.type ) {
+				case Command::Types::start:
+					beginPlayback(std::move(command.midiSequencePointer));
+					break;
+				case Command::Types::stop:
+					endPlayback();
+					break;
+				case Command::Types::shutdown:
+					endPlayback();
+					return false;
+				default:
+					throw std::runtime_error { "Error unknown MIDI sequencer command" };
+			}
+		}
+		return true;
 	}
 	
-	void MidiSequencer::outputMidiEvent() {
-		midiOutPointer->outputShortMsg((iter++)->event);
+	void MidiSequencer::beginPlayback(std::shared_ptr<MidiSequence> midiSequencePointer) {
+		midiOutPointer->outputReset();
+		
+		lookaheadBegin = 0;
+		lookaheadSize = 0;
+		this->midiSequencePointer = std::move(midiSequencePointer);
+		timeline = MidiTimeline { *(this->midiSequencePointer) };
+		timelineEnded = false;
+		playbackStart = clockType::now();
 	}
 	
-	void MidiSequencer::outputSystemExclusiveEvent() {
-		++iter;
-		//index now points to the length block
-		
-		uint32_t byteLength { iter->deltaTime };
-		uint32_t indexLength { iter->event };
-		++iter;
-		//index now points to the first data entry
-		
-		//prepare data to be output from MIDIHDR
-		MIDIHDR midiHDR {};
-		midiHDR.lpData = reinterpret_cast<char*>(&(*iter)); //probably UB
-		midiHDR.dwBufferLength = byteLength;
-		midiHDR.dwBytesRecorded = byteLength;
-		
-		iter += indexLength;
-		
-		midiOutPointer->outputSystemExclusive(&midiHDR);
+	void MidiSequencer::endPlayback() {
+		lookaheadBegin = 0;
+		lookaheadSize = 0;
+		timeline = {};
+		timelineEnded = true;
+		midiSequencePointer = {};
 		
-		//index now points to 1 past the last data entry
+		midiOutPointer->outputReset();
 	}
 	
-	void MidiSequencer::handleMetaEvent() {
-		//the status is the second byte (following 0xFF)
-		uint8_t metaEventStatus { getByte(iter->event, 2) };
-		++iter;
-		//index now points to the length block
-		
-		uint32_t byteLength { iter->deltaTime };
-		uint32_t indexLength { iter->event };
-		++iter;
-		//index now points to the first data entry
-		
-		if( metaEventStatus == tempo ) {
-			//test if this is actually a loop event
+	void MidiSequencer::fillLookahead(std::chrono::nanoseconds horizon) {
+		while( !timelineEnded && lookaheadSize < lookaheadCapacity ) {
+			//stop once an event past the horizon is already waiting
 			if(
-				(byteLength == MidiSequence::loopEncoding.deltaTime)
-					&& (indexLength == MidiSequence::loopEncoding.event)
-				) {
-				//if this is the loop start, set it
-				if( loopPointIter == midiSequencePointer->compiledTrack.end() ) {
-					loopPointIter = iter;
-				}
-					//if this is the loop end, bring us back to the loop start
-				else {
-					iter = loopPointIter;
-				}
+				lookaheadSize > 0
+				&& lookahead[(lookaheadBegin + lookaheadSize - 1) % lookaheadCapacity].time
+					> horizon
+			) {
+				return;
+			}
+			TimedEvent& timedEvent {
+				lookahead[(lookaheadBegin + lookaheadSize) % lookaheadCapacity]
+			};
+			if( timeline.next(timedEvent) ) {
+				++lookaheadSize;
 			}
-				//otherwise this is a real tempo event
 			else {
-				microsecondsPerBeat = byteSwap32(iter->deltaTime) >> 8;
-				timePerTick100ns = convertMicrosecondsPerBeatToTimePerTick100ns(
-					microsecondsPerBeat,
-					midiSequencePointer->ticks
-				);
+				timelineEnded = true;
 			}
 		}
-		
-		iter += indexLength;
-		//index now points to 1 past the last data entry
 	}
 	
-	void MidiSequencer::stopPlaybackThread() {
-		running.store(false);
-		if( playbackThread.joinable() ) {
-			wakeupSwitch.signal();
-			playbackThread.join();
-			wakeupSwitch.unsignal();
+	void MidiSequencer::outputEvent(const TimedEvent& timedEvent) {
+		if( timedEvent.systemExclusiveData ) {
+			midiOutPointer->outputSystemExclusive(
+				timedEvent.systemExclusiveData,
+				timedEvent.systemExclusiveLength
+			);
+		}
+		else {
+			midiOutPointer->outputShortMsg(timedEvent.shortMsg);
 		}
 	}
 	
-	void MidiSequencer::resetPlaybackFields() {
-		midiSequencePointer = {};
-		iter = {};
-		loopPointIter = {};
-		microsecondsPerBeat = defaultMicrosecondsPerBeat;
-		timePerTick100ns = 0;
-	}
-	
-	//static
-	MidiSequencer::timePointType MidiSequencer::getCurrentTime() {
-		return clockType::now();
+	std::chrono::nanoseconds MidiSequencer::getPlaybackTime() const {
+		return clockType::now() - playbackStart;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "Sound/MidiTimeline.h"
+
+#include <stdexcept>
+
+#include "Utility/ByteUtil.h"
+#include "Sound/MidiConstants.h"
+
+namespace wasp::sound::midi {
+	
+	using wasp::utility::getByte;
+	
+	namespace {
+		constexpr uint64_t nanosecondsPerMicrosecond { 1'000ull };
+		constexpr uint64_t nanosecondsPerSecond { 1'000'000'000ull };
+	}
+	
+	MidiTimeline::MidiTimeline(const MidiSequence& midiSequence)
+		: currentPointer { midiSequence.compiledTrack.data() }
+		, endPointer { midiSequence.compiledTrack.data() + midiSequence.compiledTrack.size() } {
+		
+		uint16_t ticks { midiSequence.ticks };
+		//a leading 1 means SMPTE FPS time
+		if( ticks & 0b1000'0000'0000'0000 ) {
+			uint32_t fps { smpteFpsDecode(getByte(ticks, 2)) };
+			uint32_t subframeResolution { static_cast<uint8_t>(ticks) };
+			tickNumerator = nanosecondsPerSecond;
+			tickDenominator = fps * subframeResolution;
+			isTempoFixed = true;
+		}
+		//a leading 0 means ticks per beat
+		else {
+			tickNumerator = defaultMicrosecondsPerBeat * nanosecondsPerMicrosecond;
+			tickDenominator = ticks;
+		}
+		if( tickDenominator == 0 ) {
+			throw std::runtime_error { "Error MIDI sequence has no time division" };
+		}
+	}
+	
+	bool MidiTimeline::next(TimedEvent& timedEvent) {
+		while( currentPointer < endPointer ) {
+			advanceTime(currentPointer->deltaTime);
+			
+			uint8_t status { getByte(currentPointer->event, 1) };
+			//midi event case
+			if( (status & statusMask) != metaEventOrSystemExclusive ) {
+				timedEvent = { currentTime, currentPointer->event };
+				++currentPointer;
+				++outputsSinceLoopPoint;
+				return true;
+			}
+			
+			//meta event or system exclusive cases
+			uint8_t metaEventStatus { getByte(currentPointer->event, 2) };
+			++currentPointer;
+			//now pointing to the length block
+			uint32_t byteLength { currentPointer->deltaTime };
+			uint32_t indexLength { currentPointer->event };
+			++currentPointer;
+			//now pointing to the first data entry
+			const uint8_t* data { reinterpret_cast<const uint8_t*>(currentPointer) };
+			
+			switch( status ) {
+				case metaEvent:
+					//may change tempo or loop back
+					if( !handleMetaEvent(metaEventStatus, byteLength, indexLength, data) ) {
+						currentPointer = endPointer;
+						return false;
+					}
+					break;
+				//continuation events and escape sequences start with sysEx end
+				//the data is encoded the same way
+				case systemExclusiveStart:
+				case systemExclusiveEnd:
+					currentPointer += indexLength;
+					timedEvent = { currentTime, 0, data, byteLength };
+					++outputsSinceLoopPoint;
+					return true;
+				default:
+					throw std::runtime_error { "Error unrecognized MIDI status" };
+			}
+		}
+		return false;
+	}
+	
+	void MidiTimeline::advanceTime(uint32_t deltaTime) {
+		uint64_t total { (deltaTime * tickNumerator) + remainder };
+		currentTime += std::chrono::nanoseconds { total / tickDenominator };
+		remainder = total % tickDenominator;
+	}
+	
+	bool MidiTimeline::handleMetaEvent(
+		uint8_t metaEventStatus,
+		uint32_t byteLength,
+		uint32_t indexLength,
+		const uint8_t* data
+	) {
+		if( metaEventStatus == tempo ) {
+			//test if this is actually a loop event
+			if(
+				(byteLength == MidiSequence::loopEncoding.deltaTime)
+					&& (indexLength == MidiSequence::loopEncoding.event)
+			) {
+				//if this is the loop start, set it
+				if( !loopPointPointer ) {
+					loopPointPointer = currentPointer;
+					outputsSinceLoopPoint = 0;
+				}
+				//if this is the loop end, bring us back to the loop start
+				else {
+					if( outputsSinceLoopPoint == 0 ) {
+						return false;
+					}
+					currentPointer = loopPointPointer;
+					outputsSinceLoopPoint = 0;
+					++loopCount;
+				}
+				return true;
+			}
+			//otherwise this is a real tempo event, 3 big endian bytes
+			if( !isTempoFixed && byteLength >= 3 ) {
+				uint32_t microsecondsPerBeat {
+					(static_cast<uint32_t>(data[0]) << 16)
+					| (static_cast<uint32_t>(data[1]) << 8)
+					| static_cast<uint32_t>(data[2])
+				};
+				tickNumerator = microsecondsPerBeat * nanosecondsPerMicrosecond;
+			}
+		}
+		currentPointer += indexLength;
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#include "Sound/MidiTimer.h"
+
+namespace wasp::sound::midi {
+	
+	void MidiTimer::waitUntil(timePointType wakeTime) {
+		std::unique_lock lock { wakeMutex };
+		wakeCondition.wait_until(lock, wakeTime, [&] { return wakePending; });
+		wakePending = false;
+	}
+	
+	void MidiTimer::wait() {
+		std::unique_lock lock { wakeMutex };
+		wakeCondition.wait(lock, [&] { return wakePending; });
+		wakePending = false;
+	}
+	
+	void MidiTimer::wake() {
+		{
+			std::lock_guard lock { wakeMutex };
+			wakePending = true;
+		}
+		wakeCondition.notify_one();
+	}
+}
\ No newline at end of file
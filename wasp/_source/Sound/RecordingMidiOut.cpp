@@ -0,0 +1,89 @@
+#include "Sound/RecordingMidiOut.h"
+
+#include <stdexcept>
+#include <algorithm>
+
+#include "Sound/MidiTimeline.h"
+
+namespace wasp::sound::midi {
+	
+	void RecordingMidiOut::outputShortMsg(uint32_t output) {
+		addRecord({ clockType::now(), output });
+	}
+	
+	void RecordingMidiOut::outputSystemExclusive(const uint8_t* data, uint32_t byteLength) {
+		addRecord({ clockType::now(), 0, { data, data + byteLength } });
+	}
+	
+	void RecordingMidiOut::outputReset() {
+		addRecord({ clockType::now(), 0, {}, true });
+	}
+	
+	std::vector<RecordingMidiOut::Record> RecordingMidiOut::takeRecords() {
+		std::lock_guard lock { recordMutex };
+		std::vector<Record> toRet { std::move(records) };
+		records = {};
+		return toRet;
+	}
+	
+	RecordingMidiOut::TimingError RecordingMidiOut::measureTimingError(
+		const std::vector<Record>& records,
+		const MidiSequence& midiSequence
+	) {
+		auto recordIter {
+			std::find_if(
+				records.begin(),
+				records.end(),
+				[](const Record& record) { return record.isReset; }
+			)
+		};
+		if( recordIter == records.end() ) {
+			throw std::runtime_error { "Error no playback recorded" };
+		}
+		clockType::time_point playbackStart { recordIter->time };
+		++recordIter;
+		
+		TimingError timingError {};
+		std::chrono::nanoseconds totalError {};
+		MidiTimeline timeline { midiSequence };
+		MidiTimeline::TimedEvent timedEvent {};
+		for( ; recordIter != records.end() && !recordIter->isReset; ++recordIter ) {
+			if( !timeline.next(timedEvent) ) {
+				throw std::runtime_error { "Error recorded more outputs than the sequence has" };
+			}
+			bool matches {
+				timedEvent.systemExclusiveData
+					? std::equal(
+						recordIter->systemExclusiveData.begin(),
+						recordIter->systemExclusiveData.end(),
+						timedEvent.systemExclusiveData,
+						timedEvent.systemExclusiveData + timedEvent.systemExclusiveLength
+					)
+					: recordIter->systemExclusiveData.empty()
+						&& recordIter->shortMsg == timedEvent.shortMsg
+			};
+			if( !matches ) {
+				throw std::runtime_error { "Error recorded output does not match the sequence" };
+			}
+			
+			std::chrono::nanoseconds error {
+				(recordIter->time - playbackStart) - timedEvent.time
+			};
+			if( error < std::chrono::nanoseconds::zero() ) {
+				error = -error;
+			}
+			totalError += error;
+			timingError.max = std::max(timingError.max, error);
+			++timingError.eventCount;
+		}
+		if( timingError.eventCount > 0 ) {
+			timingError.mean = totalError / static_cast<long long>(timingError.eventCount);
+		}
+		return timingError;
+	}
+	
+	void RecordingMidiOut::addRecord(Record&& record) {
+		std::lock_guard lock { recordMutex };
+		records.push_back(std::move(record));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#include "Sound/WaitableMidiTimer.h"
+
+namespace wasp::sound::midi {
+	
+	namespace {
+		using duration100ns = std::chrono::duration<long long, std::ratio<1, 10'000'000>>;
+	}
+	
+	void WaitableMidiTimer::enterTimingThread() {
+		utility::raiseCurrentThreadPriority();
+	}
+	
+	//the switch is reset after each wait rather than before, so a wake that lands
+	//between the sequencer reading its commands and waiting is never lost
+	void WaitableMidiTimer::waitUntil(timePointType wakeTime) {
+		utility::sleep100nsWithEvent(
+			std::chrono::duration_cast<duration100ns>(wakeTime - clockType::now()).count(),
+			wakeupSwitch
+		);
+		wakeupSwitch.unsignal();
+	}
+	
+	void WaitableMidiTimer::wait() {
+		utility::waitForEvent(wakeupSwitch);
+		wakeupSwitch.unsignal();
+	}
+	
+	void WaitableMidiTimer::wake() {
+		wakeupSwitch.signal();
+	}
+}
\ No newline at end of file
@@ -1,17 +1,31 @@
-#include "Utility\ByteUtil.h"
+#include "Utility/ByteUtil.h"
 
+#ifdef _MSC_VER
 #include <intrin.h>
+#endif
 
 namespace wasp::utility {
 	uint16_t byteSwap16(uint16_t i) {
+		#ifdef _MSC_VER
 		return _byteswap_ushort(i);
+		#else
+		return __builtin_bswap16(i);
+		#endif
 	}
 	
 	uint32_t byteSwap32(uint32_t i) {
+		#ifdef _MSC_VER
 		return _byteswap_ulong(i);
+		#else
+		return __builtin_bswap32(i);
+		#endif
 	}
 	
 	uint64_t byteSwap64(uint64_t i) {
+		#ifdef _MSC_VER
 		return _byteswap_uint64(i);
+		#else
+		return __builtin_bswap64(i);
+		#endif
 	}
 }
\ No newline at end of file
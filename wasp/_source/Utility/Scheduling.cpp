@@ -12,10 +12,23 @@ namespace wasp::utility {
 	//not visible outside this translation unit
 	class TimerHandle100ns {
 	private:
+		//CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, which older SDKs do not define
+		static constexpr DWORD highResolutionFlag { 0x00000002 };
+		
 		HANDLE timerHandle {};
 	public:
+		//high resolution timers wake within a fraction of a millisecond instead of on the
+		//next system tick; they need Windows 10 1803, so fall back to a normal timer
 		TimerHandle100ns()
-			: timerHandle { CreateWaitableTimer(NULL, TRUE, NULL) } {
+			: timerHandle { CreateWaitableTimerExW(
+				NULL,
+				NULL,
+				CREATE_WAITABLE_TIMER_MANUAL_RESET | highResolutionFlag,
+				TIMER_ALL_ACCESS
+			) } {
+			if( !timerHandle ) {
+				timerHandle = CreateWaitableTimer(NULL, TRUE, NULL);
+			}
 			if( !timerHandle ) {
 				throw std::runtime_error { "Error failed to open timer handle" };
 			}
@@ -113,4 +126,14 @@ namespace wasp::utility {
 		
 		timerHandle.wait100nsWithEvent(time100ns, eventHandle);
 	}
+	
+	void waitForEvent(EventHandle& eventHandle) {
+		WaitForSingleObject(*(eventHandle.get()), INFINITE);
+	}
+	
+	void raiseCurrentThreadPriority() {
+		if( !SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) ) {
+			debug::log("failed to raise thread priority");
+		}
+	}
 }
\ No newline at end of file
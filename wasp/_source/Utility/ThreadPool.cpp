@@ -0,0 +1,76 @@
+#include "Utility\ThreadPool.h"
+
+namespace wasp::utility {
+	
+	ThreadPool::ThreadPool(std::size_t workerCount) {
+		workers.reserve(workerCount);
+		for( std::size_t i { 0 }; i < workerCount; ++i ) {
+			workers.emplace_back([this] { workerLoop(); });
+		}
+	}
+	
+	ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard lock { mutex };
+			stopping = true;
+		}
+		workAvailable.notify_all();
+		for( std::thread& worker : workers ) {
+			worker.join();
+		}
+	}
+	
+	void ThreadPool::run(std::vector<std::function<void()>>& tasks) {
+		std::unique_lock lock { mutex };
+		tasksPointer = &tasks;
+		nextTaskIndex = 0;
+		unfinishedTaskCount = tasks.size();
+		firstExceptionPointer = nullptr;
+		workAvailable.notify_all();
+		
+		while( runNextTask(lock) ) {}
+		workDone.wait(lock, [&] { return unfinishedTaskCount == 0; });
+		
+		tasksPointer = nullptr;
+		std::exception_ptr exceptionPointer { firstExceptionPointer };
+		firstExceptionPointer = nullptr;
+		lock.unlock();
+		if( exceptionPointer ) {
+			std::rethrow_exception(exceptionPointer);
+		}
+	}
+	
+	void ThreadPool::workerLoop() {
+		std::unique_lock lock { mutex };
+		while( true ) {
+			workAvailable.wait(lock, [&] { return stopping || hasTaskToStart(); });
+			if( stopping ) {
+				return;
+			}
+			runNextTask(lock);
+		}
+	}
+	
+	bool ThreadPool::runNextTask(std::unique_lock<std::mutex>& lock) {
+		if( !hasTaskToStart() ) {
+			return false;
+		}
+		std::function<void()>& task { (*tasksPointer)[nextTaskIndex++] };
+		lock.unlock();
+		std::exception_ptr exceptionPointer {};
+		try {
+			task();
+		}
+		catch( ... ) {
+			exceptionPointer = std::current_exception();
+		}
+		lock.lock();
+		if( exceptionPointer && !firstExceptionPointer ) {
+			firstExceptionPointer = exceptionPointer;
+		}
+		if( --unfinishedTaskCount == 0 ) {
+			workDone.notify_all();
+		}
+		return true;
+	}
+}
\ No newline at end of file